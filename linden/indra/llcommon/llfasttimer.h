@@ -166,6 +166,10 @@ public:
 		FTM_REFRESH,
 		FTM_SORT,
 		FTM_PICK,
+
+		// job system
+		FTM_JOBS, // summed over all job threads, see LLJobSystem::updateFastTimers()
+		FTM_JOB_WAIT,
 		
 		// Temp
 		FTM_TEMP1,
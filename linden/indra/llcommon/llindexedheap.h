@@ -0,0 +1,192 @@
+/** 
+ * @file llindexedheap.h
+ * @date 2009-07
+ * @brief A d-ary heap that can reprioritize its elements in place.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLINDEXEDHEAP_H
+#define LL_LLINDEXEDHEAP_H
+
+#include <vector>
+
+// A d-ary heap of pointers that keeps track of where each element lives, so
+// an element can be removed or re-sorted after its key changes in O(log n)
+// without searching for it.
+//
+// Type must have an S32 mHeapIndex member visible to LLIndexedHeap
+// (initialize it to -1). An element may only be in one heap at a time.
+// Compare(a, b) returns true if a belongs closer to the top than b.
+// A wider heap (larger ARITY) is shallower, which makes push() and update()
+// cheaper at the cost of more compares in pop().
+
+template <typename Type, typename Compare, U32 ARITY = 4>
+class LLIndexedHeap
+{
+public:
+	typedef std::vector<Type*> container_t;
+	typedef typename container_t::const_iterator const_iterator;
+
+	bool empty() const { return mHeap.empty(); }
+	U32 size() const { return mHeap.size(); }
+
+	// Iterates in heap order, NOT sorted order
+	const_iterator begin() const { return mHeap.begin(); }
+	const_iterator end() const { return mHeap.end(); }
+
+	Type* top() const
+	{
+		return mHeap.empty() ? NULL : mHeap.front();
+	}
+
+	bool contains(const Type* elem) const
+	{
+		S32 idx = elem->mHeapIndex;
+		return idx >= 0 && idx < (S32)mHeap.size() && mHeap[idx] == elem;
+	}
+
+	void push(Type* elem)
+	{
+		mHeap.push_back(elem);
+		elem->mHeapIndex = mHeap.size() - 1;
+		siftUp(mHeap.size() - 1);
+	}
+
+	Type* pop()
+	{
+		if (mHeap.empty())
+		{
+			return NULL;
+		}
+		Type* res = mHeap.front();
+		removeAt(0);
+		return res;
+	}
+
+	void erase(Type* elem)
+	{
+		llassert(contains(elem));
+		removeAt(elem->mHeapIndex);
+	}
+
+	// Call after changing the sort key of an element already in the heap
+	void update(Type* elem)
+	{
+		llassert(contains(elem));
+		U32 idx = elem->mHeapIndex;
+		if (idx > 0 && mCompare(elem, mHeap[(idx - 1) / ARITY]))
+		{
+			siftUp(idx);
+		}
+		else
+		{
+			siftDown(idx);
+		}
+	}
+
+	void clear()
+	{
+		for (U32 i = 0; i < mHeap.size(); i++)
+		{
+			mHeap[i]->mHeapIndex = -1;
+		}
+		mHeap.clear();
+	}
+
+private:
+	void place(Type* elem, U32 idx)
+	{
+		mHeap[idx] = elem;
+		elem->mHeapIndex = idx;
+	}
+
+	void removeAt(U32 idx)
+	{
+		Type* elem = mHeap[idx];
+		Type* last = mHeap.back();
+		mHeap.pop_back();
+		elem->mHeapIndex = -1;
+		if (elem != last)
+		{
+			place(last, idx);
+			update(last);
+		}
+	}
+
+	void siftUp(U32 idx)
+	{
+		Type* elem = mHeap[idx];
+		while (idx > 0)
+		{
+			U32 parent = (idx - 1) / ARITY;
+			if (!mCompare(elem, mHeap[parent]))
+			{
+				break;
+			}
+			place(mHeap[parent], idx);
+			idx = parent;
+		}
+		place(elem, idx);
+	}
+
+	void siftDown(U32 idx)
+	{
+		Type* elem = mHeap[idx];
+		const U32 count = mHeap.size();
+		while (1)
+		{
+			U32 first = idx * ARITY + 1;
+			if (first >= count)
+			{
+				break;
+			}
+			U32 last = llmin(first + ARITY, count);
+			U32 best = first;
+			for (U32 child = first + 1; child < last; child++)
+			{
+				if (mCompare(mHeap[child], mHeap[best]))
+				{
+					best = child;
+				}
+			}
+			if (!mCompare(mHeap[best], elem))
+			{
+				break;
+			}
+			place(mHeap[best], idx);
+			idx = best;
+		}
+		place(elem, idx);
+	}
+
+private:
+	container_t mHeap;
+	Compare mCompare;
+};
+
+#endif // LL_LLINDEXEDHEAP_H
@@ -0,0 +1,354 @@
+/** 
+ * @file lljobsystem.cpp
+ * @date 2009-07
+ * @brief Work-stealing job threads for short per-frame tasks.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "lljobsystem.h"
+
+#include "llfasttimer.h"
+
+//============================================================================
+
+LLJob::LLJob()
+	: mWaitCount(1),
+	  mCounter(NULL),
+	  mSubmitted(false)
+{
+}
+
+LLJob::~LLJob()
+{
+}
+
+void LLJob::addDependency(LLJob* prereq)
+{
+	llassert_always(!mSubmitted && !prereq->mSubmitted);
+	mWaitCount++;
+	prereq->mContinuations.push_back(this);
+}
+
+//============================================================================
+
+class LLJobThread : public LLThread
+{
+public:
+	LLJobThread(LLJobSystem* system, S32 queue_idx)
+	:	LLThread("Job Worker"),
+		mSystem(system),
+		mQueueIdx(queue_idx)
+	{
+	}
+
+protected:
+	/*virtual*/ bool runCondition()
+	{
+		return mSystem->hasWork();
+	}
+
+	/*virtual*/ void run()
+	{
+		mSystem->mThreadIDs[mQueueIdx] = LLThread::currentID();
+		U64 ticks = 0;
+		U32 jobs_run = 0;
+		while (1)
+		{
+			// sleeps until runCondition() says there are jobs queued
+			checkPause();
+
+			if (isQuitting())
+			{
+				break;
+			}
+
+			LLJob* job;
+			while ((job = mSystem->getJob(mQueueIdx, ticks, jobs_run)))
+			{
+				U64 start = get_cpu_clock_count();
+				mSystem->runJob(job);
+				ticks = get_cpu_clock_count() - start;
+				jobs_run = 1;
+			}
+			ticks = 0;
+			jobs_run = 0;
+		}
+	}
+
+private:
+	LLJobSystem* mSystem;
+	S32 mQueueIdx;
+};
+
+//============================================================================
+
+LLJobSystem* LLJobSystem::sInstance = NULL;
+
+//static
+void LLJobSystem::initClass(S32 num_threads)
+{
+	if (!sInstance)
+	{
+		sInstance = new LLJobSystem(llclamp(num_threads, 0, 16));
+	}
+}
+
+//static
+void LLJobSystem::cleanupClass()
+{
+	delete sInstance;
+	sInstance = NULL;
+}
+
+LLJobSystem::LLJobSystem(S32 num_threads)
+	: mQueuedJobs(0)
+{
+	for (S32 i = 0; i <= num_threads; i++)
+	{
+		mQueues.push_back(new JobQueue);
+		mThreadIDs.push_back(0);
+	}
+	mThreadIDs[0] = LLThread::currentID();
+
+	for (S32 i = 1; i <= num_threads; i++)
+	{
+		LLJobThread* thread = new LLJobThread(this, i);
+		mThreads.push_back(thread);
+		thread->start();
+	}
+	llinfos << "Started " << num_threads << " job threads" << llendl;
+}
+
+LLJobSystem::~LLJobSystem()
+{
+	// ~LLThread() stops each thread
+	for (U32 i = 0; i < mThreads.size(); i++)
+	{
+		delete mThreads[i];
+	}
+	mThreads.clear();
+	for (U32 i = 0; i < mQueues.size(); i++)
+	{
+		if (!mQueues[i]->mJobs.empty())
+		{
+			llwarns << "~LLJobSystem() called with queued jobs" << llendl;
+		}
+		delete mQueues[i];
+	}
+	mQueues.clear();
+}
+
+// Threads that aren't job threads (the main thread included) share queue 0
+S32 LLJobSystem::getQueueIndex()
+{
+	U32 id = LLThread::currentID();
+	for (U32 i = 1; i < mThreadIDs.size(); i++)
+	{
+		if (mThreadIDs[i] == id)
+		{
+			return i;
+		}
+	}
+	return 0;
+}
+
+void LLJobSystem::submit(LLJob* job, LLJobCounter& counter)
+{
+	std::vector<LLJob*> jobs(1, job);
+	submit(jobs, counter);
+}
+
+void LLJobSystem::submit(std::vector<LLJob*>& jobs, LLJobCounter& counter)
+{
+	S32 queue_idx = getQueueIndex();
+	bool queued = false;
+	for (U32 i = 0; i < jobs.size(); i++)
+	{
+		LLJob* job = jobs[i];
+		llassert_always(!job->mSubmitted);
+		job->mSubmitted = true;
+		job->mCounter = &counter.mCount;
+		counter.mCount++;
+		// drop the submission reference; the job is ready if that was the
+		// last one (LLAtomic32's postfix -- returns zero once it reaches zero)
+		if (job->mWaitCount-- == 0)
+		{
+			enqueue(job, queue_idx);
+			queued = true;
+		}
+	}
+	if (queued)
+	{
+		wakeThreads();
+	}
+}
+
+void LLJobSystem::enqueue(LLJob* job, S32 queue_idx)
+{
+	JobQueue* queue = mQueues[queue_idx];
+	queue->mMutex.lock();
+	queue->mJobs.push_back(job);
+	mQueuedJobs++;
+	queue->mMutex.unlock();
+}
+
+void LLJobSystem::wakeThreads()
+{
+	for (U32 i = 0; i < mThreads.size(); i++)
+	{
+		mThreads[i]->wake();
+	}
+}
+
+LLJob* LLJobSystem::getJob(S32 queue_idx, U64 ticks, U32 jobs_run)
+{
+	LLJob* job = NULL;
+
+	// newest job from our own queue first, it is most likely still in cache
+	JobQueue* queue = mQueues[queue_idx];
+	queue->mMutex.lock();
+	queue->mTicks += ticks;
+	queue->mJobsRun += jobs_run;
+	if (!queue->mJobs.empty())
+	{
+		job = queue->mJobs.back();
+		queue->mJobs.pop_back();
+	}
+	queue->mMutex.unlock();
+
+	// then the oldest job from anybody else
+	for (U32 i = 1; !job && i < mQueues.size() && hasWork(); i++)
+	{
+		JobQueue* victim = mQueues[(queue_idx + i) % mQueues.size()];
+		victim->mMutex.lock();
+		if (!victim->mJobs.empty())
+		{
+			job = victim->mJobs.front();
+			victim->mJobs.pop_front();
+		}
+		victim->mMutex.unlock();
+	}
+
+	if (job)
+	{
+		mQueuedJobs--;
+	}
+	return job;
+}
+
+void LLJobSystem::runJob(LLJob* job)
+{
+	job->run();
+
+	// queue whatever was only waiting on this job, on this thread's queue
+	// so it is likely to run here next
+	bool queued = false;
+	for (U32 i = 0; i < job->mContinuations.size(); i++)
+	{
+		LLJob* next = job->mContinuations[i];
+		if (next->mWaitCount-- == 0)
+		{
+			enqueue(next, getQueueIndex());
+			queued = true;
+		}
+	}
+	if (queued)
+	{
+		wakeThreads();
+	}
+
+	// last thing we touch: the job may be destroyed as soon as this drops
+	(*job->mCounter)--;
+}
+
+void LLJobSystem::wait(LLJobCounter& counter)
+{
+	if (counter.isDone())
+	{
+		return;
+	}
+
+	S32 queue_idx = getQueueIndex();
+	bool main_thread = (LLThread::currentID() == mThreadIDs[0]);
+	if (main_thread)
+	{
+		// LLFastTimer is not thread safe, only the main thread may use it
+		LLFastTimer t(LLFastTimer::FTM_JOB_WAIT);
+		while (!counter.isDone())
+		{
+			LLJob* job = getJob(queue_idx, 0, 0);
+			if (job)
+			{
+				LLFastTimer t2(LLFastTimer::FTM_JOBS);
+				runJob(job);
+			}
+			else
+			{
+				LLThread::yield();
+			}
+		}
+	}
+	else
+	{
+		while (!counter.isDone())
+		{
+			LLJob* job = getJob(queue_idx, 0, 0);
+			if (job)
+			{
+				runJob(job);
+			}
+			else
+			{
+				LLThread::yield();
+			}
+		}
+	}
+}
+
+void LLJobSystem::run(std::vector<LLJob*>& jobs)
+{
+	LLJobCounter counter;
+	submit(jobs, counter);
+	wait(counter);
+}
+
+void LLJobSystem::updateFastTimers()
+{
+	for (U32 i = 1; i < mQueues.size(); i++)
+	{
+		JobQueue* queue = mQueues[i];
+		queue->mMutex.lock();
+		LLFastTimer::sCounter[LLFastTimer::FTM_JOBS] += queue->mTicks;
+		LLFastTimer::sCalls[LLFastTimer::FTM_JOBS] += queue->mJobsRun;
+		queue->mTicks = 0;
+		queue->mJobsRun = 0;
+		queue->mMutex.unlock();
+	}
+}
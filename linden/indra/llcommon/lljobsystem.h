@@ -0,0 +1,192 @@
+/** 
+ * @file lljobsystem.h
+ * @date 2009-07
+ * @brief Work-stealing job threads for short per-frame tasks.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLJOBSYSTEM_H
+#define LL_LLJOBSYSTEM_H
+
+#include <deque>
+#include <vector>
+
+#include "llthread.h"
+
+class LLJobSystem;
+class LLJobThread;
+
+// A unit of work for LLJobSystem.  Jobs are owned by whoever submits them
+// and must outlive the wait() on their counter.
+class LLJob
+{
+	friend class LLJobSystem;
+
+public:
+	LLJob();
+	virtual ~LLJob();
+
+	// Called on a job thread, or on a thread that is waiting in wait()
+	virtual void run() = 0;
+
+	// Don't start this job until prereq has finished.  Only call this
+	// before either job has been submitted.  A dependent job still has to
+	// be submitted; it is queued once its last prerequisite finishes.
+	void addDependency(LLJob* prereq);
+
+private:
+	LLAtomicS32 mWaitCount; // unfinished prerequisites, +1 until submitted
+	std::vector<LLJob*> mContinuations;
+	LLAtomicS32* mCounter;
+	bool mSubmitted;
+};
+
+// Counts outstanding jobs so a thread can wait() on them.
+class LLJobCounter
+{
+	friend class LLJobSystem;
+
+public:
+	LLJobCounter() : mCount(0) {}
+	bool isDone() { return mCount == 0; }
+
+private:
+	LLAtomicS32 mCount;
+};
+
+// A fixed set of threads, each with its own deque of jobs.  A thread runs
+// the newest job in its own deque first and, when that is empty, steals the
+// oldest job from another thread's deque.  A thread waiting on a counter runs
+// jobs too, so waiting from inside a job is fine.
+//
+// Job time on the job threads is added to LLFastTimer::FTM_JOBS by
+// updateFastTimers(); the main thread's own time waiting or helping shows up
+// under FTM_JOB_WAIT and FTM_JOBS as it happens.
+class LLJobSystem
+{
+	friend class LLJobThread;
+
+public:
+	// num_threads is the number of job threads besides the main thread;
+	// with 0 every job runs on whichever thread waits for it.
+	static void initClass(S32 num_threads);
+	static void cleanupClass();
+	static LLJobSystem* getInstance() { return sInstance; }
+
+	void submit(LLJob* job, LLJobCounter& counter);
+	void submit(std::vector<LLJob*>& jobs, LLJobCounter& counter);
+	// Runs jobs until every job counted by counter has finished
+	void wait(LLJobCounter& counter);
+	// submit() and wait()
+	void run(std::vector<LLJob*>& jobs);
+
+	// Calls func(begin, end) on consecutive ranges of at most grain items
+	// covering [begin, end), in parallel, and returns when all are done.
+	template <typename Func>
+	void parallelFor(S32 begin, S32 end, S32 grain, Func& func);
+
+	// MAIN THREAD, once per frame before LLFastTimer::reset()
+	void updateFastTimers();
+
+	S32 getNumThreads() const { return (S32)mThreads.size(); }
+
+private:
+	LLJobSystem(S32 num_threads);
+	~LLJobSystem();
+
+	struct JobQueue
+	{
+		JobQueue() : mMutex(NULL), mTicks(0), mJobsRun(0) {}
+		LLMutex mMutex;
+		std::deque<LLJob*> mJobs;
+		U64 mTicks; // job time not yet added to the fast timers
+		U32 mJobsRun;
+	};
+
+	S32 getQueueIndex();
+	void enqueue(LLJob* job, S32 queue_idx);
+	// Pops from queue_idx, or steals from another queue.  Also records
+	// ticks spent on the previous job, since the lock is held anyway.
+	LLJob* getJob(S32 queue_idx, U64 ticks, U32 jobs_run);
+	void runJob(LLJob* job);
+	void wakeThreads();
+	bool hasWork() { return mQueuedJobs > 0; }
+
+	static LLJobSystem* sInstance;
+
+	std::vector<LLJobThread*> mThreads;
+	std::vector<JobQueue*> mQueues; // [0] is the main thread's
+	std::vector<U32> mThreadIDs; // LLThread::currentID() for each queue
+	LLAtomicS32 mQueuedJobs;
+};
+
+//----------------------------------------------------------------------------
+
+template <typename Func>
+class LLRangeJob : public LLJob
+{
+public:
+	LLRangeJob(Func* func, S32 begin, S32 end) : mFunc(func), mBegin(begin), mEnd(end) {}
+	/*virtual*/ void run() { (*mFunc)(mBegin, mEnd); }
+
+private:
+	Func* mFunc;
+	S32 mBegin;
+	S32 mEnd;
+};
+
+template <typename Func>
+void LLJobSystem::parallelFor(S32 begin, S32 end, S32 grain, Func& func)
+{
+	grain = llmax(grain, 1);
+	if (end - begin <= grain)
+	{
+		if (end > begin)
+		{
+			func(begin, end);
+		}
+		return;
+	}
+
+	std::vector<LLRangeJob<Func> > range_jobs;
+	range_jobs.reserve((end - begin + grain - 1) / grain);
+	for (S32 i = begin; i < end; i += grain)
+	{
+		range_jobs.push_back(LLRangeJob<Func>(&func, i, llmin(i + grain, end)));
+	}
+
+	std::vector<LLJob*> jobs;
+	jobs.reserve(range_jobs.size());
+	for (U32 i = 0; i < range_jobs.size(); i++)
+	{
+		jobs.push_back(&range_jobs[i]);
+	}
+	run(jobs);
+}
+
+#endif // LL_LLJOBSYSTEM_H
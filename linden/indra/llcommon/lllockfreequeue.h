@@ -0,0 +1,91 @@
+/** 
+ * @file lllockfreequeue.h
+ * @date 2009-07
+ * @brief A lock-free multiple producer, single consumer queue.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLLOCKFREEQUEUE_H
+#define LL_LLLOCKFREEQUEUE_H
+
+#include "llapr.h"
+
+// An intrusive queue that any number of threads may push() onto without
+// taking a lock. Only one thread may take elements off, and it takes all of
+// them at once with popAll(), which returns them in the order they were pushed.
+//
+// Type must have a Type* mQueueNext member visible to LLLockFreeQueue.
+// Producers only ever swap in a new head and the consumer only ever swaps
+// in NULL, so there is no ABA problem.
+
+template <typename Type>
+class LLLockFreeQueue
+{
+public:
+	LLLockFreeQueue() : mHead(NULL) {}
+
+	// May be called from any thread
+	void push(Type* elem)
+	{
+		void* head = (void*)mHead;
+		while (1)
+		{
+			elem->mQueueNext = (Type*)head;
+			void* prev = apr_atomic_casptr(&mHead, elem, head);
+			if (prev == head)
+			{
+				break;
+			}
+			head = prev;
+		}
+	}
+
+	// CONSUMER thread only. Returns a NULL terminated list linked by mQueueNext.
+	Type* popAll()
+	{
+		Type* elem = (Type*)apr_atomic_xchgptr(&mHead, NULL);
+		// reverse the stack into push order
+		Type* res = NULL;
+		while (elem)
+		{
+			Type* next = elem->mQueueNext;
+			elem->mQueueNext = res;
+			res = elem;
+			elem = next;
+		}
+		return res;
+	}
+
+	// Only a hint unless called by the consumer with producers stopped
+	bool empty() const { return mHead == NULL; }
+
+private:
+	volatile void* mHead;
+};
+
+#endif // LL_LLLOCKFREEQUEUE_H
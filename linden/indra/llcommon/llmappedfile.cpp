@@ -0,0 +1,187 @@
+/** 
+ * @file llmappedfile.cpp
+ * @brief Memory mapped view of a file on disk
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "llmappedfile.h"
+
+// Mapping offsets must be a multiple of the page size (POSIX) or of the
+// allocation granularity (Windows); 64K satisfies both.
+const S64 MAP_OFFSET_ALIGNMENT = 64 * 1024;
+
+LLMappedFile::LLMappedFile()
+	: mMode(READ_ONLY),
+	  mPool(NULL),
+	  mFile(NULL),
+	  mMap(NULL),
+	  mData(NULL),
+	  mSize(0),
+	  mHeapCopy(false)
+{
+}
+
+LLMappedFile::~LLMappedFile()
+{
+	close();
+}
+
+bool LLMappedFile::open(const std::string& filename, EMapMode mode, S32 size)
+{
+	close();
+
+	mFileName = filename;
+	mMode = mode;
+	apr_pool_create(&mPool, NULL);
+
+	apr_int32_t flags = (mode == READ_WRITE) ? (APR_CREATE|APR_READ|APR_WRITE|APR_BINARY) : (APR_READ|APR_BINARY);
+	S32 file_size = 0;
+	mFile = ll_apr_file_open(filename, flags, &file_size, mPool);
+	if (!mFile)
+	{
+		close();
+		return false;
+	}
+
+	if (mode == READ_WRITE && size > 0 && file_size != size)
+	{
+		if (apr_file_trunc(mFile, (apr_off_t)size) != APR_SUCCESS)
+		{
+			llwarns << "Unable to resize " << filename << " to " << size << " bytes" << llendl;
+			close();
+			return false;
+		}
+		file_size = size;
+	}
+	if (file_size <= 0)
+	{
+		close();
+		return false;
+	}
+	mSize = file_size;
+
+#if APR_HAS_MMAP
+	apr_int32_t map_flags = (mode == READ_WRITE) ? (APR_MMAP_READ|APR_MMAP_WRITE) : APR_MMAP_READ;
+	if (apr_mmap_create(&mMap, mFile, 0, (apr_size_t)mSize, map_flags, mPool) == APR_SUCCESS)
+	{
+		mData = (U8*)mMap->mm;
+		return true;
+	}
+	mMap = NULL;
+	llwarns << "Unable to map " << filename << ", falling back to a heap copy" << llendl;
+#endif
+
+	mData = new U8[mSize];
+	mHeapCopy = true;
+	ll_apr_file_seek(mFile, APR_SET, 0);
+	if (ll_apr_file_read(mFile, mData, mSize) != mSize)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+bool LLMappedFile::openRange(const std::string& filename, S64 offset, S32 size)
+{
+	close();
+
+	mFileName = filename;
+	mMode = READ_ONLY;
+	apr_pool_create(&mPool, NULL);
+
+	// Don't ask for the file size here, the file may be larger than 2GB
+	mFile = ll_apr_file_open(filename, APR_READ|APR_BINARY, mPool);
+	if (!mFile || size <= 0 || offset < 0)
+	{
+		close();
+		return false;
+	}
+	mSize = size;
+
+#if APR_HAS_MMAP
+	S64 map_offset = offset & ~(MAP_OFFSET_ALIGNMENT - 1);
+	S32 padding = (S32)(offset - map_offset);
+	if (apr_mmap_create(&mMap, mFile, (apr_off_t)map_offset, (apr_size_t)(size + padding), APR_MMAP_READ, mPool) == APR_SUCCESS)
+	{
+		mData = (U8*)mMap->mm + padding;
+		return true;
+	}
+	mMap = NULL;
+#endif
+
+	mData = new U8[mSize];
+	mHeapCopy = true;
+	apr_off_t seek_offset = (apr_off_t)offset;
+	if (apr_file_seek(mFile, APR_SET, &seek_offset) != APR_SUCCESS ||
+		ll_apr_file_read(mFile, mData, mSize) != mSize)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void LLMappedFile::flush()
+{
+	if (mHeapCopy && mMode == READ_WRITE && mData && mFile)
+	{
+		ll_apr_file_seek(mFile, APR_SET, 0);
+		ll_apr_file_write(mFile, mData, mSize);
+		apr_file_flush(mFile);
+	}
+}
+
+void LLMappedFile::close()
+{
+	flush();
+	if (mMap)
+	{
+		apr_mmap_delete(mMap);
+		mMap = NULL;
+	}
+	if (mHeapCopy)
+	{
+		delete[] mData;
+		mHeapCopy = false;
+	}
+	mData = NULL;
+	mSize = 0;
+	if (mFile)
+	{
+		apr_file_close(mFile);
+		mFile = NULL;
+	}
+	if (mPool)
+	{
+		apr_pool_destroy(mPool);
+		mPool = NULL;
+	}
+}
@@ -0,0 +1,91 @@
+/** 
+ * @file llmappedfile.h
+ * @brief Memory mapped view of a file on disk
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLMAPPEDFILE_H
+#define LL_LLMAPPEDFILE_H
+
+#include "llapr.h"
+#include "apr_mmap.h"
+
+/** 
+ * @class LLMappedFile
+ * @brief Maps an entire file into memory.
+ *
+ * openRange() maps just part of a file, read only.
+ * In READ_WRITE mode the file is created if it does not exist and is
+ * grown (zero filled) to the requested size before being mapped, and
+ * stores into the mapping go straight to the file. Where APR has no
+ * mmap support the file is read into a heap buffer instead and, when
+ * writable, written back by flush() and close().
+ *
+ * Instances are not thread safe; callers are responsible for
+ * synchronizing access to the mapped bytes.
+ */
+class LLMappedFile
+{
+public:
+	typedef enum e_map_mode
+	{
+		READ_ONLY = 0,
+		READ_WRITE = 1
+	} EMapMode;
+
+	LLMappedFile();
+	~LLMappedFile();
+
+	// size is only used in READ_WRITE mode; 0 maps the file at its current size.
+	bool open(const std::string& filename, EMapMode mode, S32 size = 0);
+	// Maps size bytes starting at offset, read only.
+	bool openRange(const std::string& filename, S64 offset, S32 size);
+	void close();
+	void flush();
+
+	bool isOpen() const { return mData != NULL; }
+	bool isWritable() const { return mMode == READ_WRITE; }
+	U8* getData() const { return mData; }
+	S32 getSize() const { return mSize; }
+	const std::string& getFileName() const { return mFileName; }
+
+private:
+	LLMappedFile(const LLMappedFile&);
+	LLMappedFile& operator=(const LLMappedFile&);
+
+	std::string mFileName;
+	EMapMode mMode;
+	apr_pool_t* mPool;
+	apr_file_t* mFile;
+	apr_mmap_t* mMap;
+	U8* mData; // mapping start plus the alignment padding of openRange()
+	S32 mSize;
+	bool mHeapCopy; // true when mData is a heap buffer rather than a mapping
+};
+
+#endif // LL_LLMAPPEDFILE_H
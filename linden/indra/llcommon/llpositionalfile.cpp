@@ -0,0 +1,242 @@
+/** 
+ * @file llpositionalfile.cpp
+ * @brief Thread safe positional (pread/pwrite style) file access
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#if LL_WINDOWS
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/types.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "linden_common.h"
+
+#include "llpositionalfile.h"
+
+LLPositionalFile::LLPositionalFile()
+	: mOwned(true),
+#if LL_WINDOWS
+	  mHandle(INVALID_HANDLE_VALUE)
+#else
+	  mFD(-1)
+#endif
+{
+}
+
+LLPositionalFile::~LLPositionalFile()
+{
+	close();
+}
+
+bool LLPositionalFile::open(const std::string& filename, bool writable)
+{
+	close();
+	mFileName = filename;
+#if LL_WINDOWS
+	llutf16string utf16filename = utf8str_to_utf16str(filename);
+	DWORD access = writable ? (GENERIC_READ|GENERIC_WRITE) : GENERIC_READ;
+	DWORD disposition = writable ? OPEN_ALWAYS : OPEN_EXISTING;
+	mHandle = CreateFileW(utf16filename.c_str(), access, FILE_SHARE_READ|FILE_SHARE_WRITE, NULL,
+						  disposition, FILE_ATTRIBUTE_NORMAL|FILE_FLAG_RANDOM_ACCESS, NULL);
+#else
+	int flags = writable ? (O_RDWR|O_CREAT) : O_RDONLY;
+	mFD = ::open(filename.c_str(), flags, 0644);
+#endif
+	return isOpen();
+}
+
+bool LLPositionalFile::attach(LLFILE* fp)
+{
+	close();
+	mFileName.clear();
+	if (!fp)
+	{
+		return false;
+	}
+	// anything fp has buffered must reach the file before we bypass it
+	fflush(fp);
+	mOwned = false;
+#if LL_WINDOWS
+	intptr_t handle = _get_osfhandle(_fileno(fp));
+	mHandle = (handle == -1) ? INVALID_HANDLE_VALUE : (void*)handle;
+#else
+	mFD = fileno(fp);
+#endif
+	return isOpen();
+}
+
+void LLPositionalFile::close()
+{
+#if LL_WINDOWS
+	if (mHandle != INVALID_HANDLE_VALUE)
+	{
+		if (mOwned)
+		{
+			CloseHandle((HANDLE)mHandle);
+		}
+		mHandle = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (mFD >= 0)
+	{
+		if (mOwned)
+		{
+			::close(mFD);
+		}
+		mFD = -1;
+	}
+#endif
+	mOwned = true;
+}
+
+bool LLPositionalFile::isOpen() const
+{
+#if LL_WINDOWS
+	return mHandle != INVALID_HANDLE_VALUE;
+#else
+	return mFD >= 0;
+#endif
+}
+
+S32 LLPositionalFile::read(void* buf, S64 offset, S32 nbytes) const
+{
+	if (!isOpen() || nbytes < 0 || offset < 0)
+	{
+		return -1;
+	}
+#if LL_WINDOWS
+	OVERLAPPED overlapped;
+	memset(&overlapped, 0, sizeof(overlapped));
+	overlapped.Offset = (DWORD)(offset & 0xffffffff);
+	overlapped.OffsetHigh = (DWORD)(offset >> 32);
+	DWORD bytes_read = 0;
+	if (!ReadFile((HANDLE)mHandle, buf, (DWORD)nbytes, &bytes_read, &overlapped))
+	{
+		return GetLastError() == ERROR_HANDLE_EOF ? 0 : -1;
+	}
+	return (S32)bytes_read;
+#else
+	S32 total = 0;
+	while (total < nbytes)
+	{
+		ssize_t res = ::pread(mFD, (U8*)buf + total, nbytes - total, (off_t)(offset + total));
+		if (res < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		if (res == 0)
+		{
+			break; // EOF
+		}
+		total += (S32)res;
+	}
+	return total;
+#endif
+}
+
+S32 LLPositionalFile::write(const void* buf, S64 offset, S32 nbytes) const
+{
+	if (!isOpen() || nbytes < 0 || offset < 0)
+	{
+		return -1;
+	}
+#if LL_WINDOWS
+	OVERLAPPED overlapped;
+	memset(&overlapped, 0, sizeof(overlapped));
+	overlapped.Offset = (DWORD)(offset & 0xffffffff);
+	overlapped.OffsetHigh = (DWORD)(offset >> 32);
+	DWORD bytes_written = 0;
+	if (!WriteFile((HANDLE)mHandle, buf, (DWORD)nbytes, &bytes_written, &overlapped))
+	{
+		return -1;
+	}
+	return (S32)bytes_written;
+#else
+	S32 total = 0;
+	while (total < nbytes)
+	{
+		ssize_t res = ::pwrite(mFD, (const U8*)buf + total, nbytes - total, (off_t)(offset + total));
+		if (res < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		total += (S32)res;
+	}
+	return total;
+#endif
+}
+
+S64 LLPositionalFile::getSize() const
+{
+	if (!isOpen())
+	{
+		return 0;
+	}
+#if LL_WINDOWS
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx((HANDLE)mHandle, &size))
+	{
+		return 0;
+	}
+	return (S64)size.QuadPart;
+#else
+	off_t size = ::lseek(mFD, 0, SEEK_END);
+	return size < 0 ? 0 : (S64)size;
+#endif
+}
+
+// Grows (zero filled) or shrinks the file. Growing up front keeps later
+// writes from extending the file piecemeal.
+bool LLPositionalFile::setSize(S64 size)
+{
+	if (!isOpen())
+	{
+		return false;
+	}
+#if LL_WINDOWS
+	// The file pointer is otherwise unused, reads and writes are overlapped
+	LARGE_INTEGER pos;
+	pos.QuadPart = size;
+	return SetFilePointerEx((HANDLE)mHandle, pos, NULL, FILE_BEGIN) && SetEndOfFile((HANDLE)mHandle);
+#else
+	return ::ftruncate(mFD, (off_t)size) == 0;
+#endif
+}
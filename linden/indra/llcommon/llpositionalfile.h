@@ -0,0 +1,83 @@
+/** 
+ * @file llpositionalfile.h
+ * @brief Thread safe positional (pread/pwrite style) file access
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLPOSITIONALFILE_H
+#define LL_LLPOSITIONALFILE_H
+
+#include "llfile.h"
+#include "llstring.h"
+
+/** 
+ * @class LLPositionalFile
+ * @brief An open file that is read and written at explicit offsets.
+ *
+ * Unlike LLFILE or apr_file_t there is no shared file position, so any
+ * number of threads may call read() and write() at the same time
+ * without serializing on a seek. Uses pread()/pwrite() on POSIX and
+ * overlapped ReadFile()/WriteFile() on Windows.
+ */
+class LLPositionalFile
+{
+public:
+	LLPositionalFile();
+	~LLPositionalFile();
+
+	// Opens (and when writable, creates) filename.
+	bool open(const std::string& filename, bool writable);
+	// Uses the descriptor under an already open fp, which keeps owning
+	// it. Nothing else may then read or write through fp.
+	bool attach(LLFILE* fp);
+	void close();
+	bool isOpen() const;
+
+	// Return the number of bytes transferred, or -1 on error.
+	S32 read(void* buf, S64 offset, S32 nbytes) const;
+	S32 write(const void* buf, S64 offset, S32 nbytes) const;
+
+	S64 getSize() const;
+	bool setSize(S64 size);
+
+	const std::string& getFileName() const { return mFileName; }
+
+private:
+	LLPositionalFile(const LLPositionalFile&);
+	LLPositionalFile& operator=(const LLPositionalFile&);
+
+	std::string mFileName;
+	bool mOwned; // false if attached
+#if LL_WINDOWS
+	void* mHandle; // HANDLE
+#else
+	int mFD;
+#endif
+};
+
+#endif // LL_LLPOSITIONALFILE_H
@@ -39,7 +39,8 @@ LLQueuedThread::LLQueuedThread(const std::string& name, bool threaded) :
 	LLThread(name),
 	mThreaded(threaded),
 	mIdleThread(TRUE),
-	mNextHandle(0)
+	mNextHandle(0),
+	mHandlesWrapped(FALSE)
 {
 	if (mThreaded)
 	{
@@ -81,6 +82,11 @@ void LLQueuedThread::shutdown()
 		mStatus = STOPPED;
 	}
 
+	lockData();
+	drainIncoming();
+	mRequestQueue.clear();
+	unlockData();
+
 	QueuedRequest* req;
 	S32 active_count = 0;
 	while ( (req = (QueuedRequest*)mRequestHash.pop_element()) )
@@ -135,7 +141,9 @@ void LLQueuedThread::incQueue()
 	// Something has been added to the queue
 	if (!isPaused())
 	{
-		if (mThreaded)
+		// A busy thread checks mIncomingQueue in runCondition() before it
+		// sleeps, so only an idle thread needs waking (and its mutex taking).
+		if (mThreaded && mIdleThread)
 		{
 			wake(); // Wake the thread up if necessary.
 		}
@@ -148,6 +156,7 @@ S32 LLQueuedThread::getPending()
 {
 	S32 res;
 	lockData();
+	drainIncoming();
 	res = mRequestQueue.size();
 	unlockData();
 	return res;
@@ -176,9 +185,10 @@ void LLQueuedThread::waitOnPending()
 void LLQueuedThread::printQueueStats()
 {
 	lockData();
+	drainIncoming();
 	if (!mRequestQueue.empty())
 	{
-		QueuedRequest *req = *mRequestQueue.begin();
+		QueuedRequest *req = mRequestQueue.top();
 		llinfos << llformat("Pending Requests:%d Current status:%d", mRequestQueue.size(), req->getStatus()) << llendl;
 	}
 	else
@@ -188,19 +198,29 @@ void LLQueuedThread::printQueueStats()
 	unlockData();
 }
 
-// MAIN thread
+// May be called from any thread
 LLQueuedThread::handle_t LLQueuedThread::generateHandle()
 {
-	lockData();
-	while ((mNextHandle == nullHandle()) || (mRequestHash.find(mNextHandle)))
+	handle_t handle = mNextHandle++;
+	if (handle == nullHandle())
 	{
-		mNextHandle++;
+		mHandlesWrapped = TRUE;
 	}
-	unlockData();
-	return mNextHandle++;
+	if (mHandlesWrapped)
+	{
+		// Only after 2^32 requests can a handle still be in use
+		lockData();
+		drainIncoming();
+		while ((handle == nullHandle()) || (mRequestHash.find(handle)))
+		{
+			handle = mNextHandle++;
+		}
+		unlockData();
+	}
+	return handle;
 }
 
-// MAIN thread
+// May be called from any thread
 bool LLQueuedThread::addRequest(QueuedRequest* req)
 {
 	if (mStatus == QUITTING)
@@ -208,20 +228,34 @@ bool LLQueuedThread::addRequest(QueuedRequest* req)
 		return false;
 	}
 	
-	lockData();
+	// No lock here; the request is picked up by the next drainIncoming()
 	req->setStatus(STATUS_QUEUED);
-	mRequestQueue.insert(req);
-	mRequestHash.insert(req);
+	mIncomingQueue.push(req);
 #if _DEBUG
 // 	llinfos << llformat("LLQueuedThread::Added req [%08d]",handle) << llendl;
 #endif
-	unlockData();
 
 	incQueue();
 
 	return true;
 }
 
+// lockData() must be held. Every accessor that looks at mRequestQueue or
+// mRequestHash calls this first, so a request is visible to them as soon
+// as addRequest() returns.
+void LLQueuedThread::drainIncoming()
+{
+	QueuedRequest* req = mIncomingQueue.popAll();
+	while (req)
+	{
+		QueuedRequest* next = req->mQueueNext;
+		req->mQueueNext = NULL;
+		mRequestHash.insert(req);
+		mRequestQueue.push(req);
+		req = next;
+	}
+}
+
 // MAIN thread
 bool LLQueuedThread::waitForResult(LLQueuedThread::handle_t handle, bool auto_complete)
 {
@@ -233,6 +267,7 @@ bool LLQueuedThread::waitForResult(LLQueuedThread::handle_t handle, bool auto_co
 	{
 		update(0); // unpauses
 		lockData();
+		drainIncoming();
 		QueuedRequest* req = (QueuedRequest*)mRequestHash.find(handle);
 		if (!req)
 		{
@@ -271,6 +306,7 @@ LLQueuedThread::QueuedRequest* LLQueuedThread::getRequest(handle_t handle)
 		return 0;
 	}
 	lockData();
+	drainIncoming();
 	QueuedRequest* res = (QueuedRequest*)mRequestHash.find(handle);
 	unlockData();
 	return res;
@@ -280,6 +316,7 @@ LLQueuedThread::status_t LLQueuedThread::getRequestStatus(handle_t handle)
 {
 	status_t res = STATUS_EXPIRED;
 	lockData();
+	drainIncoming();
 	QueuedRequest* req = (QueuedRequest*)mRequestHash.find(handle);
 	if (req)
 	{
@@ -292,6 +329,7 @@ LLQueuedThread::status_t LLQueuedThread::getRequestStatus(handle_t handle)
 void LLQueuedThread::abortRequest(handle_t handle, bool autocomplete)
 {
 	lockData();
+	drainIncoming();
 	QueuedRequest* req = (QueuedRequest*)mRequestHash.find(handle);
 	if (req)
 	{
@@ -304,6 +342,7 @@ void LLQueuedThread::abortRequest(handle_t handle, bool autocomplete)
 void LLQueuedThread::setFlags(handle_t handle, U32 flags)
 {
 	lockData();
+	drainIncoming();
 	QueuedRequest* req = (QueuedRequest*)mRequestHash.find(handle);
 	if (req)
 	{
@@ -315,6 +354,7 @@ void LLQueuedThread::setFlags(handle_t handle, U32 flags)
 void LLQueuedThread::setPriority(handle_t handle, U32 priority)
 {
 	lockData();
+	drainIncoming();
 	QueuedRequest* req = (QueuedRequest*)mRequestHash.find(handle);
 	if (req)
 	{
@@ -325,10 +365,10 @@ void LLQueuedThread::setPriority(handle_t handle, U32 priority)
 		}
 		else if(req->getStatus() == STATUS_QUEUED)
 		{
-			// remove from list then re-insert
-			llverify(mRequestQueue.erase(req) == 1);
+			// re-sort in place
+			llassert_always(mRequestQueue.contains(req));
 			req->setPriority(priority);
-			mRequestQueue.insert(req);
+			mRequestQueue.update(req);
 		}
 	}
 	unlockData();
@@ -338,6 +378,7 @@ bool LLQueuedThread::completeRequest(handle_t handle)
 {
 	bool res = false;
 	lockData();
+	drainIncoming();
 	QueuedRequest* req = (QueuedRequest*)mRequestHash.find(handle);
 	if (req)
 	{
@@ -383,15 +424,14 @@ S32 LLQueuedThread::processNextRequest()
 	QueuedRequest *req;
 	// Get next request from pool
 	lockData();
+	drainIncoming();
 	while(1)
 	{
-		req = NULL;
-		if (mRequestQueue.empty())
+		req = mRequestQueue.pop();
+		if (!req)
 		{
 			break;
 		}
-		req = *mRequestQueue.begin();
-		mRequestQueue.erase(mRequestQueue.begin());
 		if ((req->getFlags() & FLAG_ABORT) || (mStatus == QUITTING))
 		{
 			req->setStatus(STATUS_ABORTED);
@@ -438,7 +478,7 @@ S32 LLQueuedThread::processNextRequest()
 		{
 			lockData();
 			req->setStatus(STATUS_QUEUED);
-			mRequestQueue.insert(req);
+			mRequestQueue.push(req);
 			U32 priority = req->getPriority();
 			unlockData();
 			if (priority < PRIORITY_NORMAL)
@@ -471,7 +511,7 @@ S32 LLQueuedThread::processNextRequest()
 bool LLQueuedThread::runCondition()
 {
 	// mRunCondition must be locked here
-	if (mRequestQueue.empty() && mIdleThread)
+	if (mRequestQueue.empty() && mIncomingQueue.empty() && mIdleThread)
 		return false;
 	else
 		return true;
@@ -514,7 +554,9 @@ LLQueuedThread::QueuedRequest::QueuedRequest(LLQueuedThread::handle_t handle, U3
 	LLSimpleHashEntry<LLQueuedThread::handle_t>(handle),
 	mStatus(STATUS_UNKNOWN),
 	mPriority(priority),
-	mFlags(flags)
+	mFlags(flags),
+	mHeapIndex(-1),
+	mQueueNext(NULL)
 {
 }
 
@@ -41,6 +41,8 @@
 
 #include "llthread.h"
 #include "llsimplehash.h"
+#include "llindexedheap.h"
+#include "lllockfreequeue.h"
 
 //============================================================================
 // Note: ~LLQueuedThread is O(N) N=# of queued threads, assumed to be small
@@ -82,6 +84,8 @@ public:
 	class QueuedRequest : public LLSimpleHashEntry<handle_t>
 	{
 		friend class LLQueuedThread;
+		template <typename, typename, U32> friend class LLIndexedHeap;
+		template <typename> friend class LLLockFreeQueue;
 		
 	protected:
 		virtual ~QueuedRequest(); // use deleteRequest()
@@ -136,6 +140,10 @@ public:
 		LLAtomic32<status_t> mStatus;
 		U32 mPriority;
 		U32 mFlags;
+
+	private:
+		S32 mHeapIndex; // position in mRequestQueue, -1 if not in it
+		QueuedRequest* mQueueNext; // link in mIncomingQueue
 	};
 
 protected:
@@ -168,8 +176,9 @@ private:
 protected:
 	handle_t generateHandle();
 	bool addRequest(QueuedRequest* req);
+	void drainIncoming();
 	S32  processNextRequest(void);
-	void incQueue();
+	virtual void incQueue();
 
 public:
 	bool waitForResult(handle_t handle, bool auto_complete = true);
@@ -200,14 +209,19 @@ protected:
 	BOOL mThreaded;  // if false, run on main thread and do updates during update()
 	LLAtomic32<BOOL> mIdleThread; // request queue is empty (or we are quitting) and the thread is idle
 	
-	typedef std::set<QueuedRequest*, queued_request_less> request_queue_t;
+	// Requests waiting to be processed, highest priority on top. Requests are
+	// pushed onto mIncomingQueue without locking and only moved into
+	// mRequestQueue and mRequestHash, under lockData(), by drainIncoming().
+	typedef LLIndexedHeap<QueuedRequest, queued_request_less> request_queue_t;
 	request_queue_t mRequestQueue;
+	LLLockFreeQueue<QueuedRequest> mIncomingQueue;
 
-	enum { REQUEST_HASH_SIZE = 512 }; // must be power of 2
+	enum { REQUEST_HASH_SIZE = 8192 }; // must be power of 2, producers can get well ahead of the thread
 	typedef LLSimpleHash<handle_t, REQUEST_HASH_SIZE> request_hash_t;
 	request_hash_t mRequestHash;
 
-	handle_t mNextHandle;
+	LLAtomicU32 mNextHandle;
+	LLAtomic32<BOOL> mHandlesWrapped; // once set, new handles are checked against mRequestHash
 };
 
 #endif // LL_LLQUEUEDTHREAD_H
@@ -35,6 +35,7 @@
 #include "llerror.h"
 #include "../llmath/llmath.h"
 #include "llformat.h"
+#include "llsdarena.h"
 #include "llsdserialize.h"
 
 #ifndef LL_RELEASE_FOR_DOWNLOAD
@@ -80,6 +81,11 @@ protected:
 	bool shared() const							{ return mUseCount > 1; }
 	
 public:
+	static void* operator new(size_t size)		{ return LLSDArena::allocate(size); }
+	static void operator delete(void* ptr)		{ LLSDArena::free(ptr); }
+		///< values are carved out of the thread's LLSDArena while
+		//	 an LLSDArenaScope is open, as during parsing
+
 	static void reset(Impl*& var, Impl* impl);
 		///< safely set var to refer to the new impl (possibly shared)
 		
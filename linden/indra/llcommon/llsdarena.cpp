@@ -0,0 +1,228 @@
+/** 
+ * @file llsdarena.cpp
+ * @brief Chunked arena for the LLSD values built by a parse
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "llsdarena.h"
+
+#include <new>
+
+// Big enough that chunk allocations are rare next to the values in them,
+// small enough that one value kept from a parse does not pin much.
+const size_t CHUNK_SIZE = 32 * 1024;
+// Bigger allocations go on the heap.
+const size_t MAX_CHUNK_ALLOCATION = 1024;
+// Every allocation is preceded by the chunk it came from, or NULL for the
+// heap, padded to keep what follows 8 byte aligned.
+const size_t HEADER_SIZE = 8;
+// A chunk being filled starts with this many references so that frees can
+// count down while allocations are only tallied, see retireChunk().
+const S32 FILLING_REFERENCES = 1 << 30;
+
+bool LLSDArena::sEnabled = true;
+apr_threadkey_t* LLSDArena::sThreadKey = NULL;
+LLAtomicS32 LLSDArena::sActiveScopes(0);
+LLAtomicS32 LLSDArena::sChunkCount(0);
+
+LLSDArena::LLSDArena()
+	: mChunk(NULL),
+	  mAllocations(0),
+	  mNext(NULL),
+	  mLast(NULL),
+	  mEnd(NULL)
+{
+}
+
+LLSDArena::~LLSDArena()
+{
+	retireChunk();
+}
+
+//static
+void LLSDArena::initClass()
+{
+	if (!sThreadKey)
+	{
+		apr_threadkey_private_create(&sThreadKey, NULL, gAPRPoolp);
+	}
+}
+
+//static
+void LLSDArena::cleanupClass()
+{
+	if (sThreadKey)
+	{
+		apr_threadkey_private_delete(sThreadKey);
+		sThreadKey = NULL;
+	}
+}
+
+//static
+LLSDArena* LLSDArena::getCurrent()
+{
+	// skip the thread key lookup unless some thread is parsing
+	if (!sThreadKey || sActiveScopes == 0)
+	{
+		return NULL;
+	}
+	void* arena = NULL;
+	apr_threadkey_private_get(&arena, sThreadKey);
+	return (LLSDArena*)arena;
+}
+
+//static
+void* LLSDArena::allocate(size_t size)
+{
+	LLSDArena* arena = getCurrent();
+	if (arena && size <= MAX_CHUNK_ALLOCATION)
+	{
+		return arena->allocateFromChunk(size);
+	}
+	Chunk** header = (Chunk**)::operator new(size + HEADER_SIZE);
+	*header = NULL;
+	return (U8*)header + HEADER_SIZE;
+}
+
+//static
+void LLSDArena::free(void* ptr)
+{
+	if (!ptr)
+	{
+		return;
+	}
+	Chunk** header = (Chunk**)((U8*)ptr - HEADER_SIZE);
+	if (*header)
+	{
+		// a temporary freed before anything else was allocated gives
+		// its space back, so conversions during a parse leave no holes
+		LLSDArena* arena = getCurrent();
+		if (arena && arena->mLast == (U8*)header)
+		{
+			arena->mNext = arena->mLast;
+			arena->mLast = NULL;
+		}
+		releaseChunk(*header);
+	}
+	else
+	{
+		::operator delete(header);
+	}
+}
+
+void* LLSDArena::allocateFromChunk(size_t size)
+{
+	size = (size + HEADER_SIZE + 7) & ~(size_t)7;
+	if (!mChunk || mNext + size > mEnd)
+	{
+		retireChunk();
+		U8* block = new U8[CHUNK_SIZE];
+		mChunk = new (block) Chunk;
+		mChunk->mLiveCount = FILLING_REFERENCES;
+		mAllocations = 0;
+		mNext = block + ((sizeof(Chunk) + 7) & ~(size_t)7);
+		mLast = NULL;
+		mEnd = block + CHUNK_SIZE;
+		sChunkCount++;
+	}
+	mAllocations++;
+	Chunk** header = (Chunk**)mNext;
+	*header = mChunk;
+	mLast = mNext;
+	mNext += size;
+	return (U8*)header + HEADER_SIZE;
+}
+
+void LLSDArena::retireChunk()
+{
+	if (mChunk)
+	{
+		// trade the filling references for the allocations made, keeping
+		// one to drop below in case every allocation is already freed
+		mChunk->mLiveCount -= FILLING_REFERENCES - mAllocations - 1;
+		releaseChunk(mChunk);
+		mChunk = NULL;
+	}
+}
+
+//static
+void LLSDArena::releaseChunk(Chunk* chunk)
+{
+	// values may be released on any thread
+	if (chunk->mLiveCount-- == 0)
+	{
+		chunk->~Chunk();
+		delete[] (U8*)chunk;
+		sChunkCount--;
+	}
+}
+
+//static
+const std::string& LLSDArena::intern(const std::string& key)
+{
+#if LL_SHARED_STRING_BUFFERS
+	// keys short enough to be stored inside the string are already as
+	// cheap to copy as they will get
+	static const size_t inline_length = std::string().capacity();
+	if (key.size() <= inline_length)
+	{
+		return key;
+	}
+	LLSDArena* arena = getCurrent();
+	if (!arena)
+	{
+		return key;
+	}
+	return *arena->mKeys.insert(key).first;
+#else
+	return key;
+#endif
+}
+
+LLSDArenaScope::LLSDArenaScope()
+	: mArena(NULL)
+{
+	if (LLSDArena::sEnabled && LLSDArena::sThreadKey && !LLSDArena::getCurrent())
+	{
+		mArena = new LLSDArena;
+		apr_threadkey_private_set(mArena, LLSDArena::sThreadKey);
+		LLSDArena::sActiveScopes++;
+	}
+}
+
+LLSDArenaScope::~LLSDArenaScope()
+{
+	if (mArena)
+	{
+		apr_threadkey_private_set(NULL, LLSDArena::sThreadKey);
+		LLSDArena::sActiveScopes--;
+		delete mArena;
+	}
+}
@@ -0,0 +1,142 @@
+/** 
+ * @file llsdarena.h
+ * @brief Chunked arena for the LLSD values built by a parse
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLSDARENA_H
+#define LL_LLSDARENA_H
+
+#include <set>
+#include <string>
+
+#include "llapr.h"
+
+// Only the original libstdc++ std::string shares its buffer between
+// copies.  The C++11 one, libc++'s and Visual Studio's copy the characters
+// of any string too long to be stored inside it.
+#if defined(__GLIBCXX__) && !(defined(_GLIBCXX_USE_CXX11_ABI) && _GLIBCXX_USE_CXX11_ABI)
+#define LL_SHARED_STRING_BUFFERS 1
+#else
+#define LL_SHARED_STRING_BUFFERS 0
+#endif
+
+/** 
+ * @class LLSDArena
+ * @brief Bump allocator for the LLSD::Impl nodes of a parsed tree.
+ *
+ * While an LLSDArenaScope is alive on a thread, every LLSD value created
+ * on that thread is carved out of large chunks instead of being allocated
+ * on its own, and map keys passed through intern() share one copy.  The
+ * LLSD parsers open a scope around each parse.
+ *
+ * Values are still reference counted and may be copied, kept and freed
+ * on any thread.  Each chunk counts the values living in it and is freed
+ * with the last of them, so dropping a parsed tree frees its chunks
+ * together, and a value kept from it holds on to one chunk at most.
+ */
+class LLSDArena
+{
+public:
+	/** 
+	 * @brief Allocation entry points for LLSD::Impl.
+	 *
+	 * Outside a scope these fall back on the heap.
+	 */
+	static void* allocate(size_t size);
+	static void free(void* ptr);
+
+	/** 
+	 * @brief Returns a shared copy of a map key.
+	 *
+	 * Copies of a std::string share its buffer where the library counts
+	 * references, so keys interned here cost one allocation per parse
+	 * rather than one per map entry.  Returns key itself outside a
+	 * scope, when it is short enough to be stored inside the string, or
+	 * always without LL_SHARED_STRING_BUFFERS, where sharing one copy
+	 * would only add a lookup.
+	 */
+	static const std::string& intern(const std::string& key);
+
+	/** 
+	 * @brief Creates the thread key scopes are tracked with.  Until
+	 * this is called scopes have no effect.
+	 */
+	static void initClass();
+	static void cleanupClass();
+
+	static S32 getChunkCount() { return sChunkCount; }
+
+	static bool sEnabled; // scopes opened while false have no effect
+
+private:
+	friend class LLSDArenaScope;
+
+	struct Chunk
+	{
+		LLAtomicS32 mLiveCount; // allocations not yet freed, or a large count while being filled
+	};
+
+	LLSDArena();
+	~LLSDArena();
+
+	static LLSDArena* getCurrent();
+	void* allocateFromChunk(size_t size);
+	void retireChunk();
+	static void releaseChunk(Chunk* chunk);
+
+	Chunk* mChunk;
+	S32 mAllocations; // made from mChunk
+	U8* mNext;
+	U8* mLast; // start of the latest allocation, until it is freed
+	U8* mEnd;
+#if LL_SHARED_STRING_BUFFERS
+	std::set<std::string> mKeys;
+#endif
+
+	static apr_threadkey_t* sThreadKey;
+	static LLAtomicS32 sActiveScopes;
+	static LLAtomicS32 sChunkCount;
+};
+
+/** 
+ * @class LLSDArenaScope
+ * @brief Makes LLSDArena the source of LLSD values on this thread for
+ * its lifetime.  Nested scopes share the outermost scope's arena.
+ */
+class LLSDArenaScope
+{
+public:
+	LLSDArenaScope();
+	~LLSDArenaScope();
+
+private:
+	LLSDArena* mArena; // NULL if nested or disabled
+};
+
+#endif // LL_LLSDARENA_H
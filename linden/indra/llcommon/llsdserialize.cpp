@@ -45,6 +45,7 @@
 
 #include "lldate.h"
 #include "llsd.h"
+#include "llsdarena.h"
 #include "llstring.h"
 #include "lluri.h"
 
@@ -314,6 +315,7 @@ LLSDParser::~LLSDParser()
 
 S32 LLSDParser::parse(std::istream& istr, LLSD& data, S32 max_bytes)
 {
+	LLSDArenaScope arena;
 	mCheckLimits = (LLSDSerialize::SIZE_UNLIMITED == max_bytes) ? false : true;
 	mMaxBytesLeft = max_bytes;
 	return doParse(istr, data);
@@ -323,6 +325,7 @@ S32 LLSDParser::parse(std::istream& istr, LLSD& data, S32 max_bytes)
 // Parse using routine to get() lines, faster than parse()
 S32 LLSDParser::parseLines(std::istream& istr, LLSD& data)
 {
+	LLSDArenaScope arena;
 	mCheckLimits = false;
 	mParseLines = true;
 	return doParse(istr, data);
@@ -694,7 +697,7 @@ S32 LLSDNotationParser::parseMap(std::istream& istr, LLSD& map) const
 					// There must be a value for every key, thus
 					// child_count must be greater than 0.
 					parse_count += count;
-					map.insert(name, child);
+					map.insert(LLSDArena::intern(name), child);
 				}
 				else
 				{
@@ -1129,7 +1132,7 @@ S32 LLSDBinaryParser::parseMap(std::istream& istr, LLSD& map) const
 			// There must be a value for every key, thus child_count
 			// must be greater than 0.
 			parse_count += child_count;
-			map.insert(name, child);
+			map.insert(LLSDArena::intern(name), child);
 		}
 		else
 		{
@@ -1190,17 +1193,17 @@ bool LLSDBinaryParser::parseString(
 	std::istream& istr,
 	std::string& value) const
 {
-	// *FIX: This is memory inefficient.
 	U32 value_nbo = 0;
 	read(istr, (char*)&value_nbo, sizeof(U32));		 /*Flawfinder: ignore*/
 	S32 size = (S32)ntohl(value_nbo);
-	if(mCheckLimits && (size > mMaxBytesLeft)) return false;
-	std::vector<char> buf;
+	if(size < 0 || (mCheckLimits && (size > mMaxBytesLeft))) return false;
 	if(size)
 	{
-		buf.resize(size);
-		account(fullread(istr, &buf[0], size));
-		value.assign(buf.begin(), buf.end());
+		// read straight into the string rather than through a buffer
+		value.resize(size);
+		S32 count = fullread(istr, &value[0], size);
+		account(count);
+		value.resize(count);
 	}
 	return true;
 }
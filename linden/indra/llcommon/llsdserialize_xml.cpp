@@ -31,6 +31,7 @@
 
 #include "linden_common.h"
 #include "llsdserialize_xml.h"
+#include "llsdarena.h"
 
 #include <iostream>
 #include <deque>
@@ -605,7 +606,7 @@ void LLSDXMLParser::Impl::startElementHandler(const XML_Char* name, const XML_Ch
 		if (mCurrentKey.empty()) { return startSkipping(); }
 		
 		LLSD& map = *mStack.back();
-		LLSD& newElement = map[mCurrentKey];
+		LLSD& newElement = map[LLSDArena::intern(mCurrentKey)];
 		mStack.push_back(&newElement);		
 
 #if( LL_WINDOWS || __GNUC__ > 2)
@@ -696,28 +697,45 @@ void LLSDXMLParser::Impl::endElementHandler(const XML_Char* name)
 			break;
 		
 		case ELEMENT_INTEGER:
-			value = LLSD(content).asInteger();
+		{
+			// convert before assigning so the temporary is gone by the
+			// time value allocates, see LLSDArena::free()
+			LLSD::Integer converted = LLSD(content).asInteger();
+			value = converted;
 			break;
+		}
 		
 		case ELEMENT_REAL:
-			value = LLSD(content).asReal();
+		{
+			LLSD::Real converted = LLSD(content).asReal();
+			value = converted;
 			break;
+		}
 		
 		case ELEMENT_STRING:
 			value = content;
 			break;
 		
 		case ELEMENT_UUID:
-			value = LLSD(content).asUUID();
+		{
+			LLUUID converted = LLSD(content).asUUID();
+			value = converted;
 			break;
+		}
 		
 		case ELEMENT_DATE:
-			value = LLSD(content).asDate();
+		{
+			LLDate converted = LLSD(content).asDate();
+			value = converted;
 			break;
+		}
 		
 		case ELEMENT_URI:
-			value = LLSD(content).asURI();
+		{
+			LLURI converted = LLSD(content).asURI();
+			value = converted;
 			break;
+		}
 		
 		case ELEMENT_BINARY:
 		{
@@ -299,6 +299,11 @@ void LLMutex::lock()
 	apr_thread_mutex_lock(mAPRMutexp);
 }
 
+bool LLMutex::trylock()
+{
+	return apr_thread_mutex_trylock(mAPRMutexp) == APR_SUCCESS;
+}
+
 void LLMutex::unlock()
 {
 	apr_thread_mutex_unlock(mAPRMutexp);
@@ -320,6 +325,56 @@ bool LLMutex::isLocked()
 
 //============================================================================
 
+LLRWMutex::LLRWMutex(apr_pool_t *poolp) :
+	mAPRRWLockp(NULL)
+{
+	// like LLMutex, always use a pool of our own
+	mIsLocalPool = TRUE;
+	apr_pool_create(&mAPRPoolp, NULL);
+	apr_thread_rwlock_create(&mAPRRWLockp, mAPRPoolp);
+}
+
+LLRWMutex::~LLRWMutex()
+{
+	apr_thread_rwlock_destroy(mAPRRWLockp);
+	mAPRRWLockp = NULL;
+	if (mIsLocalPool)
+	{
+		apr_pool_destroy(mAPRPoolp);
+	}
+}
+
+void LLRWMutex::readLock()
+{
+	apr_thread_rwlock_rdlock(mAPRRWLockp);
+}
+
+void LLRWMutex::writeLock()
+{
+	apr_thread_rwlock_wrlock(mAPRRWLockp);
+}
+
+void LLRWMutex::unlock()
+{
+	apr_thread_rwlock_unlock(mAPRRWLockp);
+}
+
+bool LLRWMutex::isLocked()
+{
+	apr_status_t status = apr_thread_rwlock_trywrlock(mAPRRWLockp);
+	if (APR_STATUS_IS_EBUSY(status))
+	{
+		return true;
+	}
+	else
+	{
+		apr_thread_rwlock_unlock(mAPRRWLockp);
+		return false;
+	}
+}
+
+//============================================================================
+
 LLCondition::LLCondition(apr_pool_t *poolp) :
 	LLMutex(poolp)
 {
@@ -37,6 +37,7 @@
 #include "llmemory.h"
 
 #include "apr_thread_cond.h"
+#include "apr_thread_rwlock.h"
 
 class LLThread;
 class LLMutex;
@@ -131,6 +132,7 @@ public:
 	~LLMutex();
 	
 	void lock();		// blocks
+	bool trylock();		// non-blocking, returns true if the lock was taken
 	void unlock();
 	bool isLocked(); 	// non-blocking, but does do a lock/unlock so not free
 	
@@ -171,6 +173,24 @@ private:
 	LLMutex* mMutex;
 };
 
+// Any number of readers or one writer.
+class LLRWMutex
+{
+public:
+	LLRWMutex(apr_pool_t *apr_poolp); // always constructs a new pool for the mutex, as LLMutex does
+	~LLRWMutex();
+
+	void readLock();	// blocks while a writer holds the lock
+	void writeLock();	// blocks while anyone holds the lock
+	void unlock();		// releases either kind of lock
+	bool isLocked(); 	// non-blocking, but does do a lock/unlock so not free
+
+protected:
+	apr_thread_rwlock_t *mAPRRWLockp;
+	apr_pool_t			*mAPRPoolp;
+	BOOL				mIsLocalPool;
+};
+
 //============================================================================
 
 void LLThread::lockData()
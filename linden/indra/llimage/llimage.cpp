@@ -1425,6 +1425,11 @@ BOOL LLImageFormatted::decodeChannels(LLImageRaw* raw_image,F32  decode_time, S3
 // virtual
 U8* LLImageFormatted::allocateData(S32 size)
 {
+	if (mDataView.notNull())
+	{
+		// LLImageBase would hand back the view if the size matched
+		deleteData();
+	}
 	U8* res = LLImageBase::allocateData(size); // calls deleteData()
 	sGlobalFormattedMemory += getDataSize();
 	return res;
@@ -1433,6 +1438,21 @@ U8* LLImageFormatted::allocateData(S32 size)
 // virtual
 U8* LLImageFormatted::reallocateData(S32 size)
 {
+	if (mDataView.notNull())
+	{
+		// Copy out of the view, it is read only
+		U8* new_datap = new U8[size];
+		if (!new_datap)
+		{
+			llwarns << "Out of memory in LLImageFormatted::reallocateData" << llendl;
+			return 0;
+		}
+		memcpy(new_datap, getData(), llmin(getDataSize(), size));	/* Flawfinder: ignore */
+		mDataView = NULL;
+		setDataAndSize(new_datap, size);
+		sGlobalFormattedMemory += size;
+		return new_datap;
+	}
 	sGlobalFormattedMemory -= getDataSize();
 	U8* res = LLImageBase::reallocateData(size);
 	sGlobalFormattedMemory += getDataSize();
@@ -1442,6 +1462,13 @@ U8* LLImageFormatted::reallocateData(S32 size)
 // virtual
 void LLImageFormatted::deleteData()
 {
+	if (mDataView.notNull())
+	{
+		// Not ours to delete; view bytes aren't counted in sGlobalFormattedMemory
+		setDataAndSize(NULL, 0);
+		mDataView = NULL;
+		return;
+	}
 	sGlobalFormattedMemory -= getDataSize();
 	LLImageBase::deleteData();
 }
@@ -1487,6 +1514,16 @@ void LLImageFormatted::setData(U8 *data, S32 size)
 	}
 }
 
+void LLImageFormatted::setDataView(LLImageDataView* view)
+{
+	deleteData();
+	if (view)
+	{
+		mDataView = view;
+		setDataAndSize((U8*)view->getData(), view->getSize());
+	}
+}
+
 void LLImageFormatted::appendData(U8 *data, S32 size)
 {
 	if (data)
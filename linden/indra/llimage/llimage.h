@@ -243,6 +243,25 @@ public:
 	static S32 sRawImageCount;
 };
 
+// Read only image bytes owned by something else (e.g. a memory mapped cache
+// file). An LLImageFormatted can use a view in place of its own buffer;
+// the view's owner is released when the image no longer references it.
+class LLImageDataView : public LLThreadSafeRefCount
+{
+protected:
+	/*virtual*/ ~LLImageDataView() {}
+
+public:
+	LLImageDataView(const U8* data, S32 size) : mData(data), mSize(size) {}
+
+	const U8* getData() const { return mData; }
+	S32 getSize() const { return mSize; }
+
+protected:
+	const U8* mData;
+	S32 mSize;
+};
+
 // Compressed representation of image.
 // Subclass from this class for the different representations (J2C, bmp)
 class LLImageFormatted : public LLImageBase
@@ -284,6 +303,10 @@ public:
 	virtual BOOL updateData() = 0; // pure virtual
  	void setData(U8 *data, S32 size);
  	void appendData(U8 *data, S32 size);
+	// Uses the view's bytes without copying them. The data must then be
+	// treated as read only; anything that reallocates it makes a copy first.
+	void setDataView(LLImageDataView* view);
+	bool hasDataView() const { return mDataView.notNull(); }
 
 	// Loads first 4 channels.
 	virtual BOOL decode(LLImageRaw* raw_image, F32 decode_time) = 0;  
@@ -310,6 +333,7 @@ protected:
 	S8 mDecoding;
 	S8 mDecoded;
 	S8 mDiscardLevel;
+	LLPointer<LLImageDataView> mDataView;
 	
 public:
 	static S32 sGlobalFormattedMemory;
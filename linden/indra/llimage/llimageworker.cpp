@@ -33,22 +33,132 @@
 
 #include "llimageworker.h"
 #include "llimagedxt.h"
+#include "llstl.h"
+
+//----------------------------------------------------------------------------
+
+// Extra threads for LLImageDecodeThread.  They sleep on their own
+// condition and run requests off the owner's queue while it is unpaused.
+class LLImageDecodeThread::HelperThread : public LLThread
+{
+public:
+	HelperThread(const std::string& name, LLImageDecodeThread* owner)
+		: LLThread(name),
+		  mOwner(owner)
+	{
+	}
+
+protected:
+	/*virtual*/ bool runCondition()
+	{
+		return !mOwner->isPaused() && mOwner->getPending() > 0;
+	}
+
+	/*virtual*/ void run()
+	{
+		while (1)
+		{
+			checkPause();
+
+			if (isQuitting() || mOwner->isQuitting())
+			{
+				break;
+			}
+
+			mOwner->processNextRequest();
+		}
+	}
+
+private:
+	LLImageDecodeThread* mOwner;
+};
+
+//----------------------------------------------------------------------------
+
+LLImageDecodeThread::LLImageDecodeThread(const std::string& name, S32 num_threads, bool threaded)
+	: LLWorkerThread(name, threaded)
+{
+	if (threaded)
+	{
+		num_threads = llclamp(num_threads, 1, 16);
+		for (S32 i = 1; i < num_threads; i++)
+		{
+			HelperThread* helper = new HelperThread(llformat("%s %d", name.c_str(), i), this);
+			mHelpers.push_back(helper);
+			helper->start();
+		}
+	}
+	llinfos << "Image decoding on " << getNumThreads() << " thread(s)" << llendl;
+}
+
+LLImageDecodeThread::~LLImageDecodeThread()
+{
+	stopHelpers();
+}
+
+//virtual
+void LLImageDecodeThread::shutdown()
+{
+	// the helpers must be gone before the queue is emptied
+	stopHelpers();
+	LLWorkerThread::shutdown();
+}
+
+//virtual
+S32 LLImageDecodeThread::update(U32 max_time_ms)
+{
+	S32 res = LLWorkerThread::update(max_time_ms); // unpauses
+	wakeHelpers();
+	return res;
+}
+
+//virtual
+void LLImageDecodeThread::incQueue()
+{
+	LLWorkerThread::incQueue();
+	if (!isPaused())
+	{
+		wakeHelpers();
+	}
+}
+
+void LLImageDecodeThread::wakeHelpers()
+{
+	for (U32 i = 0; i < mHelpers.size(); i++)
+	{
+		mHelpers[i]->wake();
+	}
+}
+
+void LLImageDecodeThread::stopHelpers()
+{
+	// ~LLThread() stops each thread
+	for_each(mHelpers.begin(), mHelpers.end(), DeletePointer());
+	mHelpers.clear();
+}
 
 //----------------------------------------------------------------------------
 
 //static
 LLWorkerThread* LLImageWorker::sWorkerThread = NULL;
+LLAtomicU32* LLImageWorker::sDecodeCount = NULL;
 S32 LLImageWorker::sCount = 0;
 
 //static
 void LLImageWorker::initImageWorker(LLWorkerThread* workerthread)
 {
 	sWorkerThread = workerthread;
+	if (!sDecodeCount)
+	{
+		sDecodeCount = new LLAtomicU32(0);
+	}
 }
 
 //static
 void LLImageWorker::cleanupImageWorker()
 {
+	delete sDecodeCount;
+	sDecodeCount = NULL;
 }
 
 //----------------------------------------------------------------------------
@@ -120,6 +230,11 @@ bool LLImageWorker::doWork(S32 param)
 	}
 	if (decoded)
 	{
+		if (sDecodeCount && mDecodedImage.notNull())
+		{
+			(*sDecodeCount)++;
+		}
+
 		// Call the callback immediately; endWork doesn't get called until ckeckWork
 		if (mResponder.notNull())
 		{
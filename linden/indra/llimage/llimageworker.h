@@ -32,9 +32,39 @@
 #ifndef LL_LLIMAGEWORKER_H
 #define LL_LLIMAGEWORKER_H
 
+#include <vector>
+
 #include "llimage.h"
 #include "llworkerthread.h"
 
+// An LLWorkerThread whose request queue is drained by several threads.
+// Requests still come off the one priority queue, so setPriority() and
+// abortRequest() behave as they do with a single thread, and pausing it
+// pauses all of them.
+class LLImageDecodeThread : public LLWorkerThread
+{
+public:
+	LLImageDecodeThread(const std::string& name, S32 num_threads, bool threaded = true);
+	~LLImageDecodeThread();
+
+	/*virtual*/ void shutdown();
+	/*virtual*/ S32 update(U32 max_time_ms);
+
+	S32 getNumThreads() const { return (S32)mHelpers.size() + 1; }
+
+protected:
+	/*virtual*/ void incQueue();
+
+private:
+	class HelperThread;
+	friend class HelperThread;
+
+	void wakeHelpers();
+	void stopHelpers();
+
+	std::vector<HelperThread*> mHelpers;
+};
+
 class LLImageWorker : public LLWorkerClass
 {
 public:
@@ -43,6 +73,8 @@ public:
 	
 public:
 	static LLWorkerThread* getWorkerThread() { return sWorkerThread; }
+	// total images decoded since startup, from any decode thread
+	static U32 getDecodeCount() { return sDecodeCount ? (U32)*sDecodeCount : 0; }
 
 	// LLWorkerThread
 public:
@@ -75,6 +107,7 @@ private:
 	
 protected:
 	static LLWorkerThread* sWorkerThread;
+	static LLAtomicU32* sDecodeCount;
 
 public:
 	static S32 sCount;
@@ -33,6 +33,7 @@
 
 #include "llmath.h"
 #include "llcamera.h"
+#include "llv4math.h"
 
 // ---------------- Constructors and destructors ----------------
 
@@ -251,6 +252,110 @@ S32 LLCamera::AABBInFrustumNoFarClip(const LLVector3 &center, const LLVector3& r
 	return result;
 }
 
+void LLCamera::AABBInFrustumBatch(const LLVector3* centers, const LLVector3* radii, S32* results, U32 count)
+{
+	AABBBatchTest(centers, radii, results, count, TRUE);
+}
+
+void LLCamera::AABBInFrustumNoFarClipBatch(const LLVector3* centers, const LLVector3* radii, S32* results, U32 count)
+{
+	AABBBatchTest(centers, radii, results, count, FALSE);
+}
+
+void LLCamera::AABBBatchTest(const LLVector3* centers, const LLVector3* radii, S32* results, U32 count, BOOL far_clip)
+{
+	U32 i = 0;
+
+#if LL_VECTORIZE
+	if (count >= 4)
+	{
+		// Splat each plane once.  A set bit in the plane mask means the
+		// scalar test uses +radius on that axis for the near corner.
+		__m128 nx[7], ny[7], nz[7], neg_d[7];
+		U8 masks[7];
+		U32 planes = 0;
+
+		for (U32 p = 0; p < mPlaneCount; p++)
+		{
+			if (!far_clip && p == 5)
+			{
+				continue;
+			}
+			const LLPlane& plane = mAgentPlanes[p].p;
+			nx[planes] = _mm_set1_ps(plane.mV[VX]);
+			ny[planes] = _mm_set1_ps(plane.mV[VY]);
+			nz[planes] = _mm_set1_ps(plane.mV[VZ]);
+			neg_d[planes] = _mm_set1_ps(-plane.mV[3]);
+			masks[planes] = mAgentPlanes[p].mask;
+			planes++;
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const LLVector3* c = centers + i;
+			const LLVector3* r = radii + i;
+
+			// four boxes, one per lane
+			__m128 cx = _mm_setr_ps(c[0].mV[VX], c[1].mV[VX], c[2].mV[VX], c[3].mV[VX]);
+			__m128 cy = _mm_setr_ps(c[0].mV[VY], c[1].mV[VY], c[2].mV[VY], c[3].mV[VY]);
+			__m128 cz = _mm_setr_ps(c[0].mV[VZ], c[1].mV[VZ], c[2].mV[VZ], c[3].mV[VZ]);
+			__m128 rx = _mm_setr_ps(r[0].mV[VX], r[1].mV[VX], r[2].mV[VX], r[3].mV[VX]);
+			__m128 ry = _mm_setr_ps(r[0].mV[VY], r[1].mV[VY], r[2].mV[VY], r[3].mV[VY]);
+			__m128 rz = _mm_setr_ps(r[0].mV[VZ], r[1].mV[VZ], r[2].mV[VZ], r[3].mV[VZ]);
+
+			__m128 cx_lo = _mm_sub_ps(cx, rx);
+			__m128 cx_hi = _mm_add_ps(cx, rx);
+			__m128 cy_lo = _mm_sub_ps(cy, ry);
+			__m128 cy_hi = _mm_add_ps(cy, ry);
+			__m128 cz_lo = _mm_sub_ps(cz, rz);
+			__m128 cz_hi = _mm_add_ps(cz, rz);
+
+			__m128 outside = _mm_setzero_ps();
+			__m128 partial = _mm_setzero_ps();
+
+			for (U32 p = 0; p < planes; p++)
+			{
+				U8 mask = masks[p];
+
+				// same corners and the same operation order as the scalar
+				// test, so the comparisons agree bit for bit
+				__m128 minx = (mask & 1) ? cx_lo : cx_hi;
+				__m128 miny = (mask & 2) ? cy_lo : cy_hi;
+				__m128 minz = (mask & 4) ? cz_lo : cz_hi;
+				__m128 maxx = (mask & 1) ? cx_hi : cx_lo;
+				__m128 maxy = (mask & 2) ? cy_hi : cy_lo;
+				__m128 maxz = (mask & 4) ? cz_hi : cz_lo;
+
+				__m128 dmin = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], minx), _mm_mul_ps(ny[p], miny)), _mm_mul_ps(nz[p], minz));
+				__m128 dmax = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], maxx), _mm_mul_ps(ny[p], maxy)), _mm_mul_ps(nz[p], maxz));
+
+				outside = _mm_or_ps(outside, _mm_cmpgt_ps(dmin, neg_d[p]));
+				partial = _mm_or_ps(partial, _mm_cmpgt_ps(dmax, neg_d[p]));
+			}
+
+			S32 out_bits = _mm_movemask_ps(outside);
+			S32 partial_bits = _mm_movemask_ps(partial);
+			for (U32 j = 0; j < 4; j++)
+			{
+				if (out_bits & (1 << j))
+				{
+					results[i + j] = 0;
+				}
+				else
+				{
+					results[i + j] = (partial_bits & (1 << j)) ? 1 : 2;
+				}
+			}
+		}
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		results[i] = far_clip ? AABBInFrustum(centers[i], radii[i]) : AABBInFrustumNoFarClip(centers[i], radii[i]);
+	}
+}
+
 int LLCamera::sphereInFrustumQuick(const LLVector3 &sphere_center, const F32 radius) 
 {
 	LLVector3 dist = sphere_center-mFrustCenter;
@@ -179,6 +179,12 @@ public:
 	S32 AABBInFrustum(const LLVector3 &center, const LLVector3& radius);
 	S32 AABBInFrustumNoFarClip(const LLVector3 &center, const LLVector3& radius);
 
+	// Test count boxes at once.  results[i] is exactly what the single box
+	// version returns for centers[i], radii[i].  On vectorized builds the
+	// boxes go through the planes four at a time.
+	void AABBInFrustumBatch(const LLVector3* centers, const LLVector3* radii, S32* results, U32 count);
+	void AABBInFrustumNoFarClipBatch(const LLVector3* centers, const LLVector3* radii, S32* results, U32 count);
+
 	//does a quick 'n dirty sphere-sphere check
 	S32 sphereInFrustumQuick(const LLVector3 &sphere_center, const F32 radius); 
 
@@ -198,6 +204,7 @@ protected:
 	void calculateFrustumPlanes(F32 left, F32 right, F32 top, F32 bottom);
 	void calculateFrustumPlanesFromWindow(F32 x1, F32 y1, F32 x2, F32 y2);
 	void calculateWorldFrustumPlanes();
+	void AABBBatchTest(const LLVector3* centers, const LLVector3* radii, S32* results, U32 count, BOOL far_clip);
 };
 
 
@@ -35,7 +35,6 @@
 #include "lltreenode.h"
 #include "v3math.h"
 #include <vector>
-#include <set>
 
 #if LL_RELEASE_WITH_DEBUG_INFO || LL_DEBUG
 #define OCT_ERRS LL_ERRS("OctreeErrors")
@@ -52,6 +51,11 @@
 
 template <class T> class LLOctreeNode;
 
+// Elements are kept in a contiguous array per node.  T stores its own slot
+// in that array (S32 getBinIndex() const, void setBinIndex(S32)), which makes
+// removal a swap with the last element instead of a tree erase.  Element
+// order within a node is therefore not stable across removals.
+
 template <class T>
 class LLOctreeListener: public LLTreeListener<T>
 {
@@ -78,9 +82,9 @@ class LLOctreeNode : public LLTreeNode<T>
 public:
 	typedef LLOctreeTraveler<T>									oct_traveler;
 	typedef LLTreeTraveler<T>									tree_traveler;
-	typedef typename std::set<LLPointer<T> >					element_list;
-	typedef typename std::set<LLPointer<T> >::iterator			element_iter;
-	typedef typename std::set<LLPointer<T> >::const_iterator	const_element_iter;
+	typedef typename std::vector<LLPointer<T> >					element_list;
+	typedef typename std::vector<LLPointer<T> >::iterator		element_iter;
+	typedef typename std::vector<LLPointer<T> >::const_iterator	const_element_iter;
 	typedef typename std::vector<LLTreeListener<T>*>::iterator	tree_listener_iter;
 	typedef typename std::vector<LLOctreeNode<T>* >				child_list;
 	typedef LLTreeNode<T>		BaseType;
@@ -233,6 +237,13 @@ public:
 	U32 getElementCount() const						{ return mData.size(); }
 	element_list& getData()							{ return mData; }
 	const element_list& getData() const				{ return mData; }
+
+	// Is data stored in this node (not its children)?
+	bool hasData(const T* data) const
+	{
+		S32 index = data->getBinIndex();
+		return index >= 0 && index < (S32) mData.size() && mData[index].get() == data;
+	}
 	
 	U32 getChildCount()	const						{ return mChild.size(); }
 	oct_node* getChild(U32 index)					{ return mChild[index]; }
@@ -298,14 +309,15 @@ public:
 			{ //it belongs here
 #if LL_OCTREE_PARANOIA_CHECK
 				//if this is a redundant insertion, error out (should never happen)
-				if (mData.find(data) != mData.end())
+				if (hasData(data))
 				{
 					llwarns << "Redundant octree insertion detected. " << data << llendl;
 					return false;
 				}
 #endif
 
-				mData.insert(data);
+				data->setBinIndex((S32) mData.size());
+				mData.push_back(data);
 				BaseType::insert(data);
 				return true;
 			}
@@ -377,9 +389,9 @@ public:
 
 	bool remove(T* data)
 	{
-		if (mData.find(data) != mData.end())
+		if (hasData(data))
 		{	//we have data
-			mData.erase(data);
+			eraseData(data);
 			notifyRemoval(data);
 			checkAlive();
 			return true;
@@ -414,9 +426,9 @@ public:
 
 	void removeByAddress(T* data)
 	{
-        if (mData.find(data) != mData.end())
+        if (hasData(data))
 		{
-			mData.erase(data);
+			eraseData(data);
 			notifyRemoval(data);
 			llwarns << "FOUND!" << llendl;
 			checkAlive();
@@ -435,6 +447,20 @@ public:
 		mChild.clear();
 	}
 
+	// Swap data with the last element and drop it.  data must be in this node.
+	void eraseData(T* data)
+	{
+		S32 index = data->getBinIndex();
+		S32 last = (S32) mData.size() - 1;
+		if (index != last)
+		{
+			mData[index] = mData[last];
+			mData[index]->setBinIndex(index);
+		}
+		data->setBinIndex(-1);
+		mData.pop_back();
+	}
+
 	void validate()
 	{
 #if LL_OCTREE_PARANOIA_CHECK
@@ -31,6 +31,7 @@
 #include "linden_common.h"
 #include "llmath.h"
 
+#include <algorithm>
 #include <set>
 
 #include "llerror.h"
@@ -50,6 +51,11 @@
 #define DEBUG_SILHOUETTE_NORMALS 0 // TomY: Use this to display normals using the silhouette
 #define DEBUG_SILHOUETTE_EDGE_MAP 0 // DaveP: Use this to display edge map using the silhouette
 
+// Faces with fewer triangles than this are picked by testing every triangle.
+const S32 BVH_MIN_TRIANGLES = 32;
+// Triangles per bounding volume hierarchy leaf.
+const S32 BVH_LEAF_TRIANGLES = 4;
+
 const F32 CUT_MIN = 0.f;
 const F32 CUT_MAX = 1.f;
 const F32 MIN_CUT_DELTA = 0.02f;
@@ -1918,6 +1924,15 @@ void LLVolume::createVolumeFaces()
 			 iter != mVolumeFaces.end(); ++iter)
 		{
 			(*iter).create(this, partial_build);
+			// unique volumes (flexies) are regenerated too often to be worth packing
+			if (mUnique)
+			{
+				(*iter).clearPackedVertices();
+			}
+			else
+			{
+				(*iter).packVertices();
+			}
 		}
 	}
 }
@@ -3621,10 +3636,13 @@ S32 LLVolume::lineSegmentIntersect(const LLVector3& start, const LLVector3& end,
 	LLVector3 dir = end - start;
 
 	F32 closest_t = 2.f; // must be larger than 1
+	S32 hit_tri = -1;
+	F32 hit_a = 0.f;
+	F32 hit_b = 0.f;
 	
 	for (S32 i = start_face; i <= end_face; i++)
 	{
-		const LLVolumeFace &face = getVolumeFace((U32)i);
+		LLVolumeFace &face = mVolumeFaces[i];
 
 		LLVector3 box_center = (face.mExtents[0] + face.mExtents[1]) / 2.f;
 		LLVector3 box_size   = face.mExtents[1] - face.mExtents[0];
@@ -3635,61 +3653,59 @@ S32 LLVolume::lineSegmentIntersect(const LLVector3& start, const LLVector3& end,
 			{
 				genBinormals(i);
 			}
-			
-			for (U32 tri = 0; tri < face.mIndices.size()/3; tri++) 
-			{
-				S32 index1 = face.mIndices[tri*3+0];
-				S32 index2 = face.mIndices[tri*3+1];
-				S32 index3 = face.mIndices[tri*3+2];
 
-				F32 a, b, t;
-			
-				if (LLTriangleRayIntersect(face.mVertices[index1].mPosition,
-										   face.mVertices[index2].mPosition,
-										   face.mVertices[index3].mPosition,
-										   start, dir, &a, &b, &t, FALSE))
-				{
-					if ((t >= 0.f) &&      // if hit is after start
-						(t <= 1.f) &&      // and before end
-						(t < closest_t))   // and this hit is closer
-		{
-						closest_t = t;
-						hit_face = i;
+			// unique volumes (flexies) are rebuilt too often to keep a hierarchy for
+			BOOL use_bvh = !mUnique && (S32)face.mIndices.size() >= BVH_MIN_TRIANGLES * 3;
 
-						if (intersection != NULL)
-						{
-							*intersection = start + dir * closest_t;
-						}
-			
-						if (tex_coord != NULL)
+			F32 a, b;
+			S32 tri = face.lineSegmentIntersect(start, dir, use_bvh, closest_t, a, b);
+			if (tri >= 0)
 			{
-							*tex_coord = ((1.f - a - b)  * face.mVertices[index1].mTexCoord +
-										  a              * face.mVertices[index2].mTexCoord +
-										  b              * face.mVertices[index3].mTexCoord);
+				hit_face = i;
+				hit_tri = tri;
+				hit_a = a;
+				hit_b = b;
+			}
+		}		
+	}
 
-						}
+	if (hit_face >= 0)
+	{
+		const LLVolumeFace &face = mVolumeFaces[hit_face];
+		S32 index1 = face.mIndices[hit_tri*3+0];
+		S32 index2 = face.mIndices[hit_tri*3+1];
+		S32 index3 = face.mIndices[hit_tri*3+2];
+		F32 a = hit_a;
+		F32 b = hit_b;
 
-						if (normal != NULL)
-				{
-							*normal    = ((1.f - a - b)  * face.mVertices[index1].mNormal + 
-										  a              * face.mVertices[index2].mNormal +
-										  b              * face.mVertices[index3].mNormal);
-						}
+		if (intersection != NULL)
+		{
+			*intersection = start + dir * closest_t;
+		}
+			
+		if (tex_coord != NULL)
+		{
+			*tex_coord = ((1.f - a - b)  * face.mVertices[index1].mTexCoord +
+						  a              * face.mVertices[index2].mTexCoord +
+						  b              * face.mVertices[index3].mTexCoord);
 
-						if (bi_normal != NULL)
-					{
-							*bi_normal = ((1.f - a - b)  * face.mVertices[index1].mBinormal + 
-										  a              * face.mVertices[index2].mBinormal +
-										  b              * face.mVertices[index3].mBinormal);
-						}
+		}
 
-					}
-				}
-			}
-		}		
+		if (normal != NULL)
+		{
+			*normal    = ((1.f - a - b)  * face.mVertices[index1].mNormal + 
+						  a              * face.mVertices[index2].mNormal +
+						  b              * face.mVertices[index3].mNormal);
+		}
+
+		if (bi_normal != NULL)
+		{
+			*bi_normal = ((1.f - a - b)  * face.mVertices[index1].mBinormal + 
+						  a              * face.mVertices[index2].mBinormal +
+						  b              * face.mVertices[index3].mBinormal);
+		}
 	}
 	
-	
 	return hit_face;
 }
 
@@ -4428,6 +4444,8 @@ std::ostream& operator<<(std::ostream &s, const LLVolume *volumep)
 
 BOOL LLVolumeFace::create(LLVolume* volume, BOOL partial_build)
 {
+	clearBVH();
+
 	if (mTypeMask & CAP_MASK)
 	{
 		return createCap(volume, partial_build);
@@ -4443,6 +4461,333 @@ BOOL LLVolumeFace::create(LLVolume* volume, BOOL partial_build)
 	}
 }
 
+void LLVolumeFace::packVertices()
+{
+	S32 num_vertices = (S32)mVertices.size();
+	mPackedPositions.resize(num_vertices);
+	mPackedNormals.resize(num_vertices);
+	mPackedTexCoords.resize(num_vertices);
+	for (S32 i = 0; i < num_vertices; i++)
+	{
+		const VertexData& v = mVertices[i];
+		mPackedPositions[i].set(v.mPosition, 1.f);
+		mPackedNormals[i].set(v.mNormal, 0.f);
+		mPackedTexCoords[i] = v.mTexCoord;
+	}
+}
+
+void LLVolumeFace::clearPackedVertices()
+{
+	// swap with empties to actually release the memory
+	std::vector<LLVector4>().swap(mPackedPositions);
+	std::vector<LLVector4>().swap(mPackedNormals);
+	std::vector<LLVector2>().swap(mPackedTexCoords);
+}
+
+S32 LLVolumeFace::getPackedBytes() const
+{
+	return (S32)(mPackedPositions.capacity() * sizeof(LLVector4) +
+				 mPackedNormals.capacity() * sizeof(LLVector4) +
+				 mPackedTexCoords.capacity() * sizeof(LLVector2));
+}
+
+//static
+void LLVolumeFace::transformPositions(const LLVector4* src, S32 count, const LLMatrix4& mat,
+									  LLStrider<LLVector3>& dst)
+{
+	const F32 (*m)[4] = mat.mMatrix;
+	for (S32 i = 0; i < count; i++)
+	{
+		const F32* v = src[i].mV;
+		F32* out = (dst++)->mV;
+		out[VX] = v[VX] * m[VX][VX] + v[VY] * m[VY][VX] + v[VZ] * m[VZ][VX] + m[VW][VX];
+		out[VY] = v[VX] * m[VX][VY] + v[VY] * m[VY][VY] + v[VZ] * m[VZ][VY] + m[VW][VY];
+		out[VZ] = v[VX] * m[VX][VZ] + v[VY] * m[VY][VZ] + v[VZ] * m[VZ][VZ] + m[VW][VZ];
+	}
+}
+
+//static
+void LLVolumeFace::transformNormals(const LLVector4* src, S32 count, const LLMatrix3& mat,
+									LLStrider<LLVector3>& dst)
+{
+	const F32 (*m)[3] = mat.mMatrix;
+	for (S32 i = 0; i < count; i++)
+	{
+		const F32* v = src[i].mV;
+		LLVector3& out = *(dst++);
+		out.mV[VX] = v[VX] * m[VX][VX] + v[VY] * m[VY][VX] + v[VZ] * m[VZ][VX];
+		out.mV[VY] = v[VX] * m[VX][VY] + v[VY] * m[VY][VY] + v[VZ] * m[VZ][VY];
+		out.mV[VZ] = v[VX] * m[VX][VZ] + v[VY] * m[VY][VZ] + v[VZ] * m[VZ][VZ];
+		out.normVec();
+	}
+}
+
+//static
+void LLVolumeFace::transformTexCoords(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+									  F32 off_s, F32 off_t, F32 mag_s, F32 mag_t, LLStrider<LLVector2>& dst)
+{
+	// same steps as xform() in llface.cpp
+	for (S32 i = 0; i < count; i++)
+	{
+		F32 s = src[i].mV[VX] - 0.5f;
+		F32 t = src[i].mV[VY] - 0.5f;
+		F32* out = (dst++)->mV;
+		out[VX] = (s * cos_ang + t * sin_ang) * mag_s + (off_s + 0.5f);
+		out[VY] = (-s * sin_ang + t * cos_ang) * mag_t + (off_t + 0.5f);
+	}
+}
+
+// Orders triangle numbers by their centers along one axis.
+class LLBVHTriangleCompare
+{
+public:
+	LLBVHTriangleCompare(const std::vector<LLVector3>& centers, S32 axis)
+		: mCenters(centers), mAxis(axis)
+	{
+	}
+
+	bool operator()(S32 a, S32 b) const
+	{
+		return mCenters[a].mV[mAxis] < mCenters[b].mV[mAxis];
+	}
+
+private:
+	const std::vector<LLVector3>& mCenters;
+	S32 mAxis;
+};
+
+void LLVolumeFace::createBVH()
+{
+	clearBVH();
+
+	S32 num_tris = (S32)mIndices.size() / 3;
+	if (num_tris == 0)
+	{
+		return;
+	}
+
+	// triangle centers, left scaled by 3 since only their order matters
+	std::vector<LLVector3> centers(num_tris);
+	mBVHTriangles.resize(num_tris);
+	for (S32 tri = 0; tri < num_tris; tri++)
+	{
+		mBVHTriangles[tri] = tri;
+		centers[tri] = mVertices[mIndices[tri*3+0]].mPosition +
+					   mVertices[mIndices[tri*3+1]].mPosition +
+					   mVertices[mIndices[tri*3+2]].mPosition;
+	}
+
+	mBVHNodes.reserve(2 * (num_tris / BVH_LEAF_TRIANGLES) + 1);
+	mBVHNodes.resize(1);
+	buildBVHNode(0, 0, num_tris, centers);
+}
+
+void LLVolumeFace::buildBVHNode(S32 node, S32 first, S32 count, const std::vector<LLVector3>& centers)
+{
+	LLVector3 min = mVertices[mIndices[mBVHTriangles[first]*3]].mPosition;
+	LLVector3 max = min;
+	LLVector3 center_min = centers[mBVHTriangles[first]];
+	LLVector3 center_max = center_min;
+	for (S32 i = first; i < first + count; i++)
+	{
+		S32 tri = mBVHTriangles[i];
+		for (S32 j = 0; j < 3; j++)
+		{
+			update_min_max(min, max, mVertices[mIndices[tri*3+j]].mPosition);
+		}
+		update_min_max(center_min, center_max, centers[tri]);
+	}
+	mBVHNodes[node].mMin = min;
+	mBVHNodes[node].mMax = max;
+
+	if (count <= BVH_LEAF_TRIANGLES)
+	{
+		mBVHNodes[node].mChild = first;
+		mBVHNodes[node].mCount = count;
+		return;
+	}
+
+	// split at the median center along the axis the centers spread most over,
+	// which keeps the tree balanced however the triangles are laid out
+	LLVector3 spread = center_max - center_min;
+	S32 axis = VX;
+	if (spread.mV[VY] > spread.mV[axis])
+	{
+		axis = VY;
+	}
+	if (spread.mV[VZ] > spread.mV[axis])
+	{
+		axis = VZ;
+	}
+	S32 half = count / 2;
+	std::nth_element(mBVHTriangles.begin() + first,
+					 mBVHTriangles.begin() + first + half,
+					 mBVHTriangles.begin() + first + count,
+					 LLBVHTriangleCompare(centers, axis));
+
+	// mBVHNodes may reallocate, so refer to nodes by index only
+	S32 child = (S32)mBVHNodes.size();
+	mBVHNodes.resize(child + 2);
+	mBVHNodes[node].mChild = child;
+	mBVHNodes[node].mCount = 0;
+	buildBVHNode(child, first, half, centers);
+	buildBVHNode(child + 1, first + half, count - half, centers);
+}
+
+void LLVolumeFace::clearBVH()
+{
+	// swap with empties to actually release the memory
+	std::vector<BVHNode>().swap(mBVHNodes);
+	std::vector<S32>().swap(mBVHTriangles);
+}
+
+// Clips the segment start + t * dir, t in [0, max_t], against a box grown
+// by pad on every side.  Returns the t at which the segment enters the box,
+// or a value above max_t if it misses.
+static F32 segment_enter_box(const LLVector3& start, const LLVector3& dir, F32 max_t,
+							 const LLVector3& min, const LLVector3& max, F32 pad)
+{
+	F32 t_enter = 0.f;
+	F32 t_exit = max_t;
+	for (S32 i = 0; i < 3; i++)
+	{
+		F32 lo = min.mV[i] - pad;
+		F32 hi = max.mV[i] + pad;
+		if (dir.mV[i] == 0.f)
+		{
+			if (start.mV[i] < lo || start.mV[i] > hi)
+			{
+				return max_t + 1.f;
+			}
+			continue;
+		}
+
+		F32 inv_dir = 1.f / dir.mV[i];
+		F32 t0 = (lo - start.mV[i]) * inv_dir;
+		F32 t1 = (hi - start.mV[i]) * inv_dir;
+		if (t0 > t1)
+		{
+			F32 tmp = t0;
+			t0 = t1;
+			t1 = tmp;
+		}
+		t_enter = llmax(t_enter, t0);
+		t_exit = llmin(t_exit, t1);
+		if (t_enter > t_exit)
+		{
+			return max_t + 1.f;
+		}
+	}
+	return t_enter;
+}
+
+S32 LLVolumeFace::lineSegmentIntersect(const LLVector3& start, const LLVector3& dir, BOOL use_bvh,
+									   F32& closest_t, F32& hit_a, F32& hit_b)
+{
+	S32 num_tris = (S32)mIndices.size() / 3;
+	S32 hit_tri = -1;
+
+	if (!use_bvh)
+	{
+		for (S32 tri = 0; tri < num_tris; tri++) 
+		{
+			F32 a, b, t;
+			if (LLTriangleRayIntersect(mVertices[mIndices[tri*3+0]].mPosition,
+									   mVertices[mIndices[tri*3+1]].mPosition,
+									   mVertices[mIndices[tri*3+2]].mPosition,
+									   start, dir, &a, &b, &t, FALSE))
+			{
+				if ((t >= 0.f) &&      // if hit is after start
+					(t <= 1.f) &&      // and before end
+					(t < closest_t))   // and this hit is closer
+				{
+					closest_t = t;
+					hit_tri = tri;
+					hit_a = a;
+					hit_b = b;
+				}
+			}
+		}
+		return hit_tri;
+	}
+
+	if (mBVHNodes.empty())
+	{
+		createBVH();
+		if (mBVHNodes.empty())
+		{
+			return -1;
+		}
+	}
+
+	// Grow every box by a little more than the rounding error of the
+	// triangle test, so no triangle it accepts is culled by its box.
+	F32 pad = 0.00001f * (1.f + llmax(fabsf(start.mV[VX]), fabsf(start.mV[VY]), fabsf(start.mV[VZ])) +
+						  llmax(fabsf(dir.mV[VX]), fabsf(dir.mV[VY]), fabsf(dir.mV[VZ])));
+
+	// the tree is balanced, so this is deeper than any face can need
+	S32 stack[64];
+	S32 depth = 0;
+	if (segment_enter_box(start, dir, 1.f, mBVHNodes[0].mMin, mBVHNodes[0].mMax, pad) <= 1.f)
+	{
+		stack[depth++] = 0;
+	}
+
+	while (depth > 0)
+	{
+		const BVHNode& node = mBVHNodes[stack[--depth]];
+
+		if (node.mCount > 0)
+		{
+			for (S32 i = node.mChild; i < node.mChild + node.mCount; i++)
+			{
+				S32 tri = mBVHTriangles[i];
+				F32 a, b, t;
+				if (LLTriangleRayIntersect(mVertices[mIndices[tri*3+0]].mPosition,
+										   mVertices[mIndices[tri*3+1]].mPosition,
+										   mVertices[mIndices[tri*3+2]].mPosition,
+										   start, dir, &a, &b, &t, FALSE))
+				{
+					// Triangles come out of order here, so on an exact tie keep
+					// the lower numbered one like the plain loop above does.
+					if ((t >= 0.f) &&
+						(t <= 1.f) &&
+						((t < closest_t) || (t == closest_t && hit_tri >= 0 && tri < hit_tri)))
+					{
+						closest_t = t;
+						hit_tri = tri;
+						hit_a = a;
+						hit_b = b;
+					}
+				}
+			}
+			continue;
+		}
+
+		// visit the nearer child first and skip children beyond the closest hit
+		F32 max_t = llmin(closest_t, 1.f);
+		S32 near_child = node.mChild;
+		S32 far_child = node.mChild + 1;
+		F32 near_t = segment_enter_box(start, dir, max_t, mBVHNodes[near_child].mMin, mBVHNodes[near_child].mMax, pad);
+		F32 far_t = segment_enter_box(start, dir, max_t, mBVHNodes[far_child].mMin, mBVHNodes[far_child].mMax, pad);
+		if (far_t < near_t)
+		{
+			std::swap(near_child, far_child);
+			std::swap(near_t, far_t);
+		}
+		if (far_t <= max_t)
+		{
+			stack[depth++] = far_child;
+		}
+		if (near_t <= max_t)
+		{
+			stack[depth++] = near_child;
+		}
+	}
+
+	return hit_tri;
+}
+
 void	LerpPlanarVertex(LLVolumeFace::VertexData& v0,
 				   LLVolumeFace::VertexData& v1,
 				   LLVolumeFace::VertexData& v2,
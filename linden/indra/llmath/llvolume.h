@@ -48,6 +48,7 @@ class LLVolume;
 //#include "vmath.h"
 #include "v2math.h"
 #include "v3math.h"
+#include "v4math.h"
 #include "llquaternion.h"
 #include "llstrider.h"
 #include "v4coloru.h"
@@ -798,6 +799,39 @@ public:
 	BOOL create(LLVolume* volume, BOOL partial_build = FALSE);
 	void createBinormals();
 
+	// Copies positions, normals and texture coordinates into the packed
+	// arrays below, or empties them.
+	void packVertices();
+	void clearPackedVertices();
+	BOOL hasPackedVertices() const { return !mVertices.empty() && mPackedPositions.size() == mVertices.size(); }
+	S32 getPackedBytes() const;
+
+	// Bulk transforms of the packed arrays into a vertex buffer.
+	// Positions and normals are row vectors times the matrix, like
+	// LLVector3 * LLMatrix4 and LLVector3 * LLMatrix3; normals are
+	// renormalized.  Texture coordinates get a texture entry's rotation,
+	// scale and offset about the center of the face.
+	static void transformPositions(const LLVector4* src, S32 count, const LLMatrix4& mat, LLStrider<LLVector3>& dst);
+	static void transformNormals(const LLVector4* src, S32 count, const LLMatrix3& mat, LLStrider<LLVector3>& dst);
+	static void transformTexCoords(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+								   F32 off_s, F32 off_t, F32 mag_s, F32 mag_t, LLStrider<LLVector2>& dst);
+	// llvolume_sse2.cpp, same as the above without LL_VECTORIZE
+	static void transformPositionsSSE2(const LLVector4* src, S32 count, const LLMatrix4& mat, LLStrider<LLVector3>& dst);
+	static void transformNormalsSSE2(const LLVector4* src, S32 count, const LLMatrix3& mat, LLStrider<LLVector3>& dst);
+	static void transformTexCoordsSSE2(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+									   F32 off_s, F32 off_t, F32 mag_s, F32 mag_t, LLStrider<LLVector2>& dst);
+
+	// Finds the closest triangle crossed by the segment from start to
+	// start + dir, nearer than closest_t.  Updates closest_t and the
+	// barycentric coordinates of the hit and returns the triangle, or -1.
+	// With use_bvh the triangles are walked through mBVHNodes, which is
+	// built on first use.
+	S32 lineSegmentIntersect(const LLVector3& start, const LLVector3& dir, BOOL use_bvh,
+							 F32& closest_t, F32& hit_a, F32& hit_b);
+	void createBVH();
+	void clearBVH();
+	BOOL hasBVH() const { return !mBVHNodes.empty(); }
+
 	class VertexData
 	{
 	public:
@@ -807,6 +841,15 @@ public:
 		LLVector2 mTexCoord;
 	};
 
+	class BVHNode
+	{
+	public:
+		LLVector3 mMin;
+		LLVector3 mMax;
+		S32 mChild;		// inner nodes: first of two adjacent children; leaves: first entry in mBVHTriangles
+		S32 mCount;		// leaves: number of triangles; inner nodes: 0
+	};
+
 	enum
 	{
 		SINGLE_MASK =	0x0001,
@@ -840,7 +883,24 @@ public:
 	std::vector<U16>	mIndices;
 	std::vector<S32>	mEdge;
 
+	// Copies of mVertices kept for shared volumes, which every instance
+	// transforms into its own vertex buffer.  Positions (w = 1) and normals
+	// (w = 0) are four floats wide so a face can go through the instance's
+	// matrix in one tight loop, and texture coordinates are contiguous.
+	std::vector<LLVector4> mPackedPositions;
+	std::vector<LLVector4> mPackedNormals;
+	std::vector<LLVector2> mPackedTexCoords;
+
+	// Bounding volume hierarchy over the triangles of mIndices, used to
+	// pick faces with many triangles.  Node 0 is the root and leaves refer
+	// to runs of triangle numbers in mBVHTriangles.  Emptied whenever the
+	// face is rebuilt.
+	std::vector<BVHNode> mBVHNodes;
+	std::vector<S32> mBVHTriangles;
+
 private:
+	void buildBVHNode(S32 node, S32 first, S32 count, const std::vector<LLVector3>& centers);
+
 	BOOL createUnCutCubeCap(LLVolume* volume, BOOL partial_build = FALSE);
 	BOOL createCap(LLVolume* volume, BOOL partial_build = FALSE);
 	BOOL createSide(LLVolume* volume, BOOL partial_build = FALSE);
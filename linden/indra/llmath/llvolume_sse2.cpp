@@ -0,0 +1,172 @@
+/** 
+ * @file llvolume_sse2.cpp
+ * @brief SSE2 versions of LLVolumeFace's packed vertex transforms
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+// Visual Studio required settings for this file:
+// Precompiled Headers OFF
+// Code Generation: SSE2
+
+//-----------------------------------------------------------------------------
+// Header Files
+//-----------------------------------------------------------------------------
+
+#include "linden_common.h"
+
+#include "llvolume.h"
+
+#include "llmath.h"
+#include "llstrider.h"
+#include "m3math.h"
+#include "m4math.h"
+#include "v2math.h"
+#include "v3math.h"
+#include "llv4math.h"		// for LL_VECTORIZE
+#include "llv4matrix3.h"
+#include "llv4matrix4.h"
+
+
+#if LL_VECTORIZE
+
+// Writes x, y and z only; a 16 byte store would run into the next
+// attribute, or off the end of the buffer.
+inline void store_vector3(F32* out, __m128 v)
+{
+	_mm_storel_pi((__m64*)out, v);
+	_mm_store_ss(out + 2, _mm_movehl_ps(v, v));
+}
+
+//static
+void LLVolumeFace::transformPositionsSSE2(const LLVector4* src, S32 count, const LLMatrix4& mat,
+										 LLStrider<LLVector3>& dst)
+{
+	LLV4Matrix4 m;
+	m = mat;
+	for (S32 i = 0; i < count; i++)
+	{
+		__m128 v = _mm_loadu_ps(src[i].mV);
+		__m128 r = _mm_add_ps(m.mV[VW], _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), m.mV[VX])); // ( x * vx ) + vw
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), m.mV[VY]));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), m.mV[VZ]));
+		store_vector3((dst++)->mV, r);
+	}
+}
+
+//static
+void LLVolumeFace::transformNormalsSSE2(const LLVector4* src, S32 count, const LLMatrix3& mat,
+									   LLStrider<LLVector3>& dst)
+{
+	LLV4Matrix3 m;
+	memset(m.mMatrix, 0, sizeof(m.mMatrix));	// operator= only fills x, y and z of each row
+	m = mat;
+	const __m128 threshold = _mm_set_ss(FP_MAG_THRESHOLD);
+	for (S32 i = 0; i < count; i++)
+	{
+		__m128 v = _mm_loadu_ps(src[i].mV);
+		__m128 r = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), m.mV[VX]);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), m.mV[VY]));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), m.mV[VZ]));
+
+		// renormalize like LLVector3::normVec(), w is zero
+		__m128 sq = _mm_mul_ps(r, r);
+		__m128 mag = _mm_add_ss(_mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1))),
+								_mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 2, 2, 2)));
+		mag = _mm_sqrt_ss(mag);
+		if (_mm_comigt_ss(mag, threshold))
+		{
+			r = _mm_div_ps(r, _mm_shuffle_ps(mag, mag, _MM_SHUFFLE(0, 0, 0, 0)));
+		}
+		else
+		{
+			r = _mm_setzero_ps();
+		}
+		store_vector3((dst++)->mV, r);
+	}
+}
+
+//static
+void LLVolumeFace::transformTexCoordsSSE2(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+										 F32 off_s, F32 off_t, F32 mag_s, F32 mag_t, LLStrider<LLVector2>& dst)
+{
+	// xform() as one affine map, two texture coordinates per register:
+	// s' = a * s + b * t + cs,  t' = c * s + d * t + ct
+	F32 a = cos_ang * mag_s;
+	F32 b = sin_ang * mag_s;
+	F32 c = -sin_ang * mag_t;
+	F32 d = cos_ang * mag_t;
+	// rotation and scale are about the center of the texture
+	F32 cs = off_s + 0.5f - 0.5f * (a + b);
+	F32 ct = off_t + 0.5f - 0.5f * (c + d);
+
+	const __m128 diag = _mm_setr_ps(a, d, a, d);
+	const __m128 cross = _mm_setr_ps(b, c, b, c);
+	const __m128 offset = _mm_setr_ps(cs, ct, cs, ct);
+
+	S32 i = 0;
+	for ( ; i + 1 < count; i += 2)
+	{
+		__m128 st = _mm_loadu_ps(src[i].mV); // s0 t0 s1 t1
+		__m128 ts = _mm_shuffle_ps(st, st, _MM_SHUFFLE(2, 3, 0, 1)); // t0 s0 t1 s1
+		__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(st, diag), _mm_mul_ps(ts, cross)), offset);
+		_mm_storel_pi((__m64*)(dst++)->mV, r);
+		_mm_storeh_pi((__m64*)(dst++)->mV, r);
+	}
+	if (i < count)
+	{
+		const F32* st = src[i].mV;
+		F32* out = (dst++)->mV;
+		out[VX] = a * st[VX] + b * st[VY] + cs;
+		out[VY] = c * st[VX] + d * st[VY] + ct;
+	}
+}
+
+#else
+
+//static
+void LLVolumeFace::transformPositionsSSE2(const LLVector4* src, S32 count, const LLMatrix4& mat,
+										 LLStrider<LLVector3>& dst)
+{
+	transformPositions(src, count, mat, dst);
+}
+
+//static
+void LLVolumeFace::transformNormalsSSE2(const LLVector4* src, S32 count, const LLMatrix3& mat,
+									   LLStrider<LLVector3>& dst)
+{
+	transformNormals(src, count, mat, dst);
+}
+
+//static
+void LLVolumeFace::transformTexCoordsSSE2(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+										 F32 off_s, F32 off_t, F32 mag_s, F32 mag_t, LLStrider<LLVector2>& dst)
+{
+	transformTexCoords(src, count, cos_ang, sin_ang, off_s, off_t, mag_s, mag_t, dst);
+}
+
+#endif
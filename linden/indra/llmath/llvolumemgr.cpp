@@ -47,6 +47,44 @@ F32 LLVolumeLODGroup::mDetailThresholds[NUM_LODS] = {BASE_THRESHOLD,
 F32 LLVolumeLODGroup::mDetailScales[NUM_LODS] = {1.f, 1.5f, 2.5f, 4.f};
 
 
+//============================================================================
+
+// Generates one detail level of a volume on a job thread.  The main thread
+// leaves mVolumep alone until mCounter says the job is done.
+class LLVolumeGenJob : public LLJob
+{
+public:
+	LLVolumeGenJob(const LLVolumeParams& volume_params, S32 detail)
+		: mParams(volume_params), mDetail(detail), mVolumep(NULL) {}
+
+	/*virtual*/ void run()
+	{
+		LLMemType m1(LLMemType::MTYPE_VOLUME);
+		mVolumep = new LLVolume(mParams, LLVolumeLODGroup::getVolumeScaleFromDetail(mDetail));
+	}
+
+	bool isDone() { return mCounter.isDone(); }
+
+	typedef std::vector<std::pair<LLVolumeMgr::volume_callback_t, void*> > callback_list_t;
+
+	LLVolumeParams mParams;
+	S32 mDetail;
+	LLVolume* mVolumep;
+	callback_list_t mCallbacks;
+	// each job has its own counter since runJob() is done with the job once
+	// the counter drops; nothing else tells us when it is safe to delete
+	LLJobCounter mCounter;
+};
+
+bool LLVolumeMgr::request_compare::operator()(const LLVolumeGenJob* lhs, const LLVolumeGenJob* rhs) const
+{
+	if (lhs->mParams == rhs->mParams)
+	{
+		return lhs->mDetail < rhs->mDetail;
+	}
+	return lhs->mParams < rhs->mParams;
+}
+
 //============================================================================
 
 LLVolumeMgr::LLVolumeMgr()
@@ -67,6 +105,9 @@ LLVolumeMgr::~LLVolumeMgr()
 
 BOOL LLVolumeMgr::cleanup()
 {
+	// nothing left to install the requests into
+	finishRequests(TRUE);
+
 	BOOL no_refs = TRUE;
 	if (mDataMutex)
 	{
@@ -178,6 +219,103 @@ void LLVolumeMgr::unrefVolume(LLVolume *volumep)
 
 }
 
+BOOL LLVolumeMgr::requestVolume(const LLVolumeParams &volume_params, const S32 detail,
+								volume_callback_t callback, void* userdata)
+{
+	LLJobSystem* job_system = LLJobSystem::getInstance();
+	if (!job_system || !job_system->getNumThreads() || volume_params.getSculptID().notNull())
+	{
+		return TRUE;
+	}
+
+	// The first detail level of a shape is generated synchronously so
+	// whoever asked has a volume to start with, and so the LOD group can
+	// be looked up when the job is done.
+	LLVolumeLODGroup* volgroupp = getGroup(volume_params);
+	if (!volgroupp || volgroupp->hasLOD(detail))
+	{
+		return TRUE;
+	}
+
+	LLVolumeGenJob* job;
+	LLVolumeGenJob probe(volume_params, detail);
+	request_set_t::iterator iter = mPendingRequests.find(&probe);
+	if (iter != mPendingRequests.end())
+	{
+		job = *iter;
+	}
+	else
+	{
+		job = new LLVolumeGenJob(volume_params, detail);
+		mPendingRequests.insert(job);
+		job_system->submit(job, job->mCounter);
+	}
+
+	if (callback)
+	{
+		job->mCallbacks.push_back(std::make_pair(callback, userdata));
+	}
+	return FALSE;
+}
+
+void LLVolumeMgr::updateRequests()
+{
+	finishRequests(FALSE);
+}
+
+// protected
+void LLVolumeMgr::finishRequests(BOOL wait_all)
+{
+	if (mPendingRequests.empty())
+	{
+		return;
+	}
+
+	// Pull the finished jobs out first, callbacks may request more volumes
+	std::vector<LLVolumeGenJob*> finished;
+	for (request_set_t::iterator iter = mPendingRequests.begin();
+		 iter != mPendingRequests.end(); )
+	{
+		LLVolumeGenJob* job = *iter;
+		if (!job->isDone())
+		{
+			if (!wait_all)
+			{
+				++iter;
+				continue;
+			}
+			LLJobSystem::getInstance()->wait(job->mCounter);
+		}
+		finished.push_back(job);
+		mPendingRequests.erase(iter++);
+	}
+
+	for (U32 i = 0; i < finished.size(); i++)
+	{
+		LLVolumeGenJob* job = finished[i];
+		// takes ownership of the volume; if nobody keeps it, it goes away here
+		LLPointer<LLVolume> volumep = job->mVolumep;
+
+		BOOL success = FALSE;
+		if (!wait_all)
+		{
+			LLVolumeLODGroup* volgroupp = getGroup(job->mParams);
+			if (volgroupp)
+			{
+				volgroupp->setLOD(job->mDetail, volumep);
+				success = TRUE;
+			}
+		}
+
+		for (LLVolumeGenJob::callback_list_t::iterator iter = job->mCallbacks.begin();
+			 iter != job->mCallbacks.end(); ++iter)
+		{
+			(iter->first)(success, job->mParams, job->mDetail, iter->second);
+		}
+		delete job;
+	}
+}
+
 // protected
 void LLVolumeMgr::insertGroup(LLVolumeLODGroup* volgroup)
 {
@@ -217,6 +355,32 @@ void LLVolumeMgr::dump()
 	llinfos << "Average usage of LODs " << avg << llendl;
 }
 
+void LLVolumeMgr::dumpVertexStats()
+{
+	S32 num_volumes = 0;
+	S32 num_vertices = 0;
+	S32 vertex_bytes = 0;
+	S32 packed_bytes = 0;
+	if (mDataMutex)
+	{
+		mDataMutex->lock();
+	}
+	for (volume_lod_group_map_t::iterator iter = mVolumeLODGroups.begin(),
+			 end = mVolumeLODGroups.end();
+		 iter != end; iter++)
+	{
+		iter->second->getVertexStats(num_volumes, num_vertices, vertex_bytes, packed_bytes);
+	}
+	S32 num_groups = (S32)mVolumeLODGroups.size();
+	if (mDataMutex)
+	{
+		mDataMutex->unlock();
+	}
+	llinfos << num_groups << " volume groups, " << num_volumes << " volumes, "
+			<< num_vertices << " vertices: " << vertex_bytes / 1024 << " KB vertex data, "
+			<< packed_bytes / 1024 << " KB packed copies" << llendl;
+}
+
 void LLVolumeMgr::useMutex()
 { 
 	if (!mDataMutex)
@@ -309,6 +473,16 @@ LLVolume* LLVolumeLODGroup::refLOD(const S32 detail)
 	return mVolumeLODs[detail];
 }
 
+void LLVolumeLODGroup::setLOD(const S32 detail, LLVolume* volumep)
+{
+	llassert(detail >=0 && detail < NUM_LODS);
+	// refLOD() may have generated it synchronously in the meantime
+	if (mVolumeLODs[detail].isNull())
+	{
+		mVolumeLODs[detail] = volumep;
+	}
+}
+
 BOOL LLVolumeLODGroup::derefLOD(LLVolume *volumep)
 {
 	llassert_always(mRefs > 0);
@@ -392,6 +566,26 @@ F32 LLVolumeLODGroup::dump()
 	return usage;
 }
 
+void LLVolumeLODGroup::getVertexStats(S32& num_volumes, S32& num_vertices, S32& vertex_bytes, S32& packed_bytes) const
+{
+	for (S32 i = 0; i < NUM_LODS; i++)
+	{
+		LLVolume* volumep = mVolumeLODs[i];
+		if (!volumep)
+		{
+			continue;
+		}
+		num_volumes++;
+		for (S32 f = 0; f < volumep->getNumVolumeFaces(); f++)
+		{
+			const LLVolumeFace& vf = volumep->getVolumeFace(f);
+			num_vertices += (S32)vf.mVertices.size();
+			vertex_bytes += (S32)(vf.mVertices.capacity() * sizeof(LLVolumeFace::VertexData));
+			packed_bytes += vf.getPackedBytes();
+		}
+	}
+}
+
 std::ostream& operator<<(std::ostream& s, const LLVolumeLODGroup& volgroup)
 {
 	s << "{ numRefs=" << volgroup.getNumRefs();
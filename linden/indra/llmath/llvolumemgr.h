@@ -33,13 +33,16 @@
 #define LL_LLVOLUMEMGR_H
 
 #include <map>
+#include <set>
 
 #include "llvolume.h"
 #include "llmemory.h"
 #include "llthread.h"
+#include "lljobsystem.h"
 
 class LLVolumeParams;
 class LLVolumeLODGroup;
+class LLVolumeGenJob;
 
 class LLVolumeLODGroup
 {
@@ -61,11 +64,16 @@ public:
 
 	LLVolume* refLOD(const S32 detail);
 	BOOL derefLOD(LLVolume *volumep);
+	BOOL hasLOD(const S32 detail) const { return mVolumeLODs[detail].notNull(); }
+	// Keeps a volume generated by LLVolumeMgr::requestVolume() until refLOD() wants it
+	void setLOD(const S32 detail, LLVolume* volumep);
 	S32 getNumRefs() const { return mRefs; }
 	
 	const LLVolumeParams* getVolumeParams() const { return &mVolumeParams; };
 
 	F32	dump();
+	// Adds this group's volumes, their vertices and the bytes those take up
+	void getVertexStats(S32& num_volumes, S32& num_vertices, S32& vertex_bytes, S32& packed_bytes) const;
 	friend std::ostream& operator<<(std::ostream& s, const LLVolumeLODGroup& volgroup);
 
 protected:
@@ -94,7 +102,28 @@ public:
 	LLVolume *refVolume(const LLVolumeParams &volume_params, const S32 detail);
 	void unrefVolume(LLVolume *volumep);
 
+	// Called on the main thread when a volume from requestVolume() is ready.
+	// success is FALSE if it was dropped instead (its LOD group went away,
+	// or the manager was cleaned up); userdata is never used again after this.
+	typedef void (*volume_callback_t)(BOOL success, const LLVolumeParams& volume_params, S32 detail, void* userdata);
+
+	// MAIN THREAD
+	// Starts generating this detail level on the job threads, unless
+	// refVolume() would not have to generate it.  Returns TRUE if refVolume()
+	// can be called right away, in which case callback is not called.
+	// Otherwise callback (if any) is called from updateRequests() once
+	// refVolume() will return the new volume without generating it.
+	// Only shared, unsculpted volumes whose LOD group already exists are
+	// generated asynchronously.
+	BOOL requestVolume(const LLVolumeParams &volume_params, const S32 detail,
+					   volume_callback_t callback = NULL, void* userdata = NULL);
+	// MAIN THREAD, once per frame
+	void updateRequests();
+	S32 getNumPendingRequests() const { return (S32)mPendingRequests.size(); }
+
 	void dump();
+	// Logs how much memory the vertices of all shared volumes use
+	void dumpVertexStats();
 
 	// manually call this for mutex magic
 	void useMutex();
@@ -105,11 +134,20 @@ protected:
 	void insertGroup(LLVolumeLODGroup* volgroup);
 	// Overridden in llphysics/abstract/utils/llphysicsvolumemanager.h
 	virtual LLVolumeLODGroup* createNewGroup(const LLVolumeParams& volume_params);
+	// Drops or installs every finished request, or all of them if wait_all
+	void finishRequests(BOOL wait_all);
 
 protected:
 	typedef std::map<const LLVolumeParams*, LLVolumeLODGroup*, LLVolumeParams::compare> volume_lod_group_map_t;
 	volume_lod_group_map_t mVolumeLODGroups;
 
+	struct request_compare
+	{
+		bool operator()(const LLVolumeGenJob* lhs, const LLVolumeGenJob* rhs) const;
+	};
+	typedef std::set<LLVolumeGenJob*, request_compare> request_set_t;
+	request_set_t mPendingRequests;
+
 	LLMutex* mDataMutex;
 };
 
@@ -70,6 +70,9 @@ const F32 TARGET_PERIOD_LENGTH = 5.f;	// seconds
 const F32 LL_DUPLICATE_SUPPRESSION_TIMEOUT = 60.f; //seconds - this can be long, as time-based cleanup is
 													// only done when wrapping packetids, now...
 
+const U32 DUPLICATE_WINDOW_SIZE = 256;		// Recently received reliable ids kept in O(1) slots,
+const U32 DUPLICATE_WINDOW_MAX_SIZE = 16384;	// growing to this before spilling into a map.
+
 LLCircuitData::LLCircuitData(const LLHost &host, TPACKETID in_id)
 :	mHost (host),
 	mWrapID(0),
@@ -88,6 +91,7 @@ LLCircuitData::LLCircuitData(const LLHost &host, TPACKETID in_id)
 	mLastPingID(0),
 	mPingDelay(INITIAL_PING_VALUE_MSEC), 
 	mPingDelayAveraged((F32)INITIAL_PING_VALUE_MSEC), 
+	mRecentlyReceivedReliablePackets(DUPLICATE_WINDOW_SIZE, DUPLICATE_WINDOW_MAX_SIZE),
 	mUnackedPacketCount(0),
 	mUnackedPacketBytes(0),
 	mLocalEndPointID(),
@@ -132,35 +136,12 @@ LLCircuitData::~LLCircuitData()
 	// Clean up all pending transfers.
 	gTransferManager.cleanupConnection(mHost);
 
-	// remove all pending reliable messages on this circuit
+	// remove all pending reliable messages on this circuit, including
+	// the ones on their final retry
 	std::vector<TPACKETID> doomed;
-	reliable_iter iter;
-	reliable_iter end = mUnackedPackets.end();
-	for(iter = mUnackedPackets.begin(); iter != end; ++iter)
-	{
-		packetp = iter->second;
-		gMessageSystem->mFailedResendPackets++;
-		if(gMessageSystem->mVerboseLog)
-		{
-			doomed.push_back(packetp->mPacketID);
-		}
-		if (packetp->mCallback)
-		{
-			packetp->mCallback(packetp->mCallbackData,LL_ERR_CIRCUIT_GONE);
-		}
-
-		// Update stats
-		mUnackedPacketCount--;
-		mUnackedPacketBytes -= packetp->mBufferLength;
-
-		delete packetp;
-	}
-
-	// remove all pending final retry reliable messages on this circuit
-	end = mFinalRetryPackets.end();
-	for(iter = mFinalRetryPackets.begin(); iter != end; ++iter)
+	while (!mUnackedPackets.empty())
 	{
-		packetp = iter->second;
+		packetp = mUnackedPackets.remove(mUnackedPackets.getOldestID());
 		gMessageSystem->mFailedResendPackets++;
 		if(gMessageSystem->mVerboseLog)
 		{
@@ -192,80 +173,39 @@ LLCircuitData::~LLCircuitData()
 
 void LLCircuitData::ackReliablePacket(TPACKETID packet_num)
 {
-	reliable_iter iter;
-	LLReliablePacket *packetp;
-
-	iter = mUnackedPackets.find(packet_num);
-	if (iter != mUnackedPackets.end())
+	LLReliablePacket *packetp = mUnackedPackets.remove(packet_num);
+	if (!packetp)
 	{
-		packetp = iter->second;
-
-		if(gMessageSystem->mVerboseLog)
-		{
-			std::ostringstream str;
-			str << "MSG: <- " << packetp->mHost << "\tRELIABLE ACKED:\t"
-				<< packetp->mPacketID;
-			llinfos << str.str() << llendl;
-		}
-		if (packetp->mCallback)
-		{
-			if (packetp->mTimeout < 0.f)   // negative timeout will always return timeout even for successful ack, for debugging
-			{
-				packetp->mCallback(packetp->mCallbackData,LL_ERR_TCP_TIMEOUT);					
-			}
-			else
-			{
-				packetp->mCallback(packetp->mCallbackData,LL_ERR_NOERR);
-			}
-		}
-
-		// Update stats
-		mUnackedPacketCount--;
-		mUnackedPacketBytes -= packetp->mBufferLength;
-
-		// Cleanup
-		delete packetp;
-		mUnackedPackets.erase(iter);
+		// Couldn't find this packet on either of the unacked lists.
+		// maybe it's a duplicate ack?
 		return;
 	}
 
-	iter = mFinalRetryPackets.find(packet_num);
-	if (iter != mFinalRetryPackets.end())
+	if(gMessageSystem->mVerboseLog)
 	{
-		packetp = iter->second;
-		// llinfos << "Packet " << packet_num << " removed from the pending list" << llendl;
-		if(gMessageSystem->mVerboseLog)
+		std::ostringstream str;
+		str << "MSG: <- " << packetp->mHost << "\tRELIABLE ACKED:\t"
+			<< packetp->mPacketID;
+		llinfos << str.str() << llendl;
+	}
+	if (packetp->mCallback)
+	{
+		if (packetp->mTimeout < 0.f)   // negative timeout will always return timeout even for successful ack, for debugging
 		{
-			std::ostringstream str;
-			str << "MSG: <- " << packetp->mHost << "\tRELIABLE ACKED:\t"
-				<< packetp->mPacketID;
-			llinfos << str.str() << llendl;
+			packetp->mCallback(packetp->mCallbackData,LL_ERR_TCP_TIMEOUT);					
 		}
-		if (packetp->mCallback)
+		else
 		{
-			if (packetp->mTimeout < 0.f)   // negative timeout will always return timeout even for successful ack, for debugging
-			{
-				packetp->mCallback(packetp->mCallbackData,LL_ERR_TCP_TIMEOUT);					
-			}
-			else
-			{
-				packetp->mCallback(packetp->mCallbackData,LL_ERR_NOERR);
-			}
+			packetp->mCallback(packetp->mCallbackData,LL_ERR_NOERR);
 		}
+	}
 
-		// Update stats
-		mUnackedPacketCount--;
-		mUnackedPacketBytes -= packetp->mBufferLength;
+	// Update stats
+	mUnackedPacketCount--;
+	mUnackedPacketBytes -= packetp->mBufferLength;
 
-		// Cleanup
-		delete packetp;
-		mFinalRetryPackets.erase(iter);
-	}
-	else
-	{
-		// Couldn't find this packet on either of the unacked lists.
-		// maybe it's a duplicate ack?
-	}
+	// Cleanup
+	delete packetp;
 }
 
 
@@ -283,11 +223,17 @@ S32 LLCircuitData::resendUnackedPackets(const F64 now)
 	// I'm not going to worry about this for now - djs
 	//
 
-	reliable_iter iter;
+	TPACKETID packet_id;
+	TPACKETID next_id;
 	BOOL have_resend_overflow = FALSE;
-	for (iter = mUnackedPackets.begin(); iter != mUnackedPackets.end();)
+	for (packet_id = mUnackedPackets.getOldestID(); packet_id != LL_INVALID_PACKET_ID; packet_id = next_id)
 	{
-		packetp = iter->second;
+		next_id = mUnackedPackets.getNextID(packet_id);
+		if (mUnackedPackets.isFinalRetry(packet_id))
+		{
+			continue;
+		}
+		packetp = mUnackedPackets.find(packet_id);
 
 		// Only check overflow if we haven't had one yet.
 		if (!have_resend_overflow)
@@ -307,13 +253,8 @@ S32 LLCircuitData::resendUnackedPackets(const F64 now)
 				{
 					// This circuit has overflowed.  Do not retry.  Do not pass go.
 					packetp->mRetries = 0;
-					// Remove it from this list and add it to the final list.
-					mUnackedPackets.erase(iter++);
-					mFinalRetryPackets[packetp->mPacketID] = packetp;
-				}
-				else
-				{
-					++iter;
+					// Move it to the final list.
+					mUnackedPackets.setFinalRetry(packet_id);
 				}
 				// Move on to the next unacked packet.
 				continue;
@@ -367,28 +308,24 @@ S32 LLCircuitData::resendUnackedPackets(const F64 now)
 
 			if (!packetp->mRetries)
 			{
-				// Last resend, remove it from this list and add it to the final list.
-				mUnackedPackets.erase(iter++);
-				mFinalRetryPackets[packetp->mPacketID] = packetp;
-			}
-			else
-			{
-				// Don't remove it yet, it still gets to try to resend at least once.
-				++iter;
+				// Last resend, move it to the final list.
+				mUnackedPackets.setFinalRetry(packet_id);
 			}
+			// Otherwise don't move it yet, it still gets to try to resend at least once.
 			resent_packets++;
 		}
-		else
-		{
-			// Don't need to do anything with this packet, keep iterating.
-			++iter;
-		}
+		// Otherwise don't need to do anything with this packet, keep iterating.
 	}
 
 
-	for (iter = mFinalRetryPackets.begin(); iter != mFinalRetryPackets.end();)
+	for (packet_id = mUnackedPackets.getOldestID(); packet_id != LL_INVALID_PACKET_ID; packet_id = next_id)
 	{
-		packetp = iter->second;
+		next_id = mUnackedPackets.getNextID(packet_id);
+		if (!mUnackedPackets.isFinalRetry(packet_id))
+		{
+			continue;
+		}
+		packetp = mUnackedPackets.find(packet_id);
 		if (now > packetp->mExpirationTime)
 		{
 			// fail (too many retries)
@@ -416,13 +353,9 @@ S32 LLCircuitData::resendUnackedPackets(const F64 now)
 			mUnackedPacketCount--;
 			mUnackedPacketBytes -= packetp->mBufferLength;
 
-			mFinalRetryPackets.erase(iter++);
+			mUnackedPackets.remove(packet_id);
 			delete packetp;
 		}
-		else
-		{
-			++iter;
-		}
 	}
 
 	return mUnackedPacketCount;
@@ -572,14 +505,8 @@ void LLCircuitData::addReliablePacket(S32 mSocket, U8 *buf_ptr, S32 buf_len, LLR
 	mUnackedPacketCount++;
 	mUnackedPacketBytes += packet_info->mBufferLength;
 
-	if (params && params->mRetries)
-	{
-		mUnackedPackets[packet_info->mPacketID] = packet_info;
-	}
-	else
-	{
-		mFinalRetryPackets[packet_info->mPacketID] = packet_info;
-	}
+	BOOL final_retry = !(params && params->mRetries);
+	mUnackedPackets.add(packet_info->mPacketID, packet_info, final_retry);
 }
 
 
@@ -602,7 +529,7 @@ void LLCircuit::resendUnackedPackets(S32& unacked_list_length, S32& unacked_list
 
 BOOL LLCircuitData::isDuplicateResend(TPACKETID packetnum)
 {
-	return (mRecentlyReceivedReliablePackets.find(packetnum) != mRecentlyReceivedReliablePackets.end());
+	return (mRecentlyReceivedReliablePackets.find(packetnum) != NULL);
 }
 
 
@@ -863,92 +790,19 @@ BOOL LLCircuitData::updateWatchDogTimers(LLMessageSystem *msgsys)
 	// for the packet that it was out of order with was received BEFORE
 	// the ping was sent.
 
-	// Find the current oldest reliable packetID
-	// This is to handle the case if we actually manage to wrap our
+	// Find the current oldest reliable packetID, on either the unacked
+	// or the final list.  Packets are kept in the order they were sent, so
+	// this also handles the case if we actually manage to wrap our
 	// packet IDs - the oldest will actually have a higher packet ID
 	// than the current.
-	BOOL wrapped = FALSE;
-	reliable_iter iter;
-	iter = mUnackedPackets.upper_bound(getPacketOutID());
-	if (iter == mUnackedPackets.end())
+	TPACKETID packet_id = mUnackedPackets.getOldestID();
+	if (packet_id == LL_INVALID_PACKET_ID)
 	{
-		// Nothing AFTER this one, so we want the lowest packet ID
-		// then.
-		iter = mUnackedPackets.begin();
-		wrapped = TRUE;
-	}
-
-	TPACKETID packet_id = 0;
-
-	// Check against the "final" packets
-	BOOL wrapped_final = FALSE;
-	reliable_iter iter_final;
-	iter_final = mFinalRetryPackets.upper_bound(getPacketOutID());
-	if (iter_final == mFinalRetryPackets.end())
-	{
-		iter_final = mFinalRetryPackets.begin();
-		wrapped_final = TRUE;
-	}
-
-	//llinfos << mHost << " - unacked count " << mUnackedPackets.size() << llendl;
-	//llinfos << mHost << " - final count " << mFinalRetryPackets.size() << llendl;
-	if (wrapped != wrapped_final)
-	{
-		// One of the "unacked" or "final" lists hasn't wrapped.  Whichever one
-		// hasn't has the oldest packet.
-		if (!wrapped)
-		{
-			// Hasn't wrapped, so the one on the
-			// unacked packet list is older
-			packet_id = iter->first;
-			//llinfos << mHost << ": nowrapped unacked" << llendl;
-		}
-		else
-		{
-			packet_id = iter_final->first;
-			//llinfos << mHost << ": nowrapped final" << llendl;
-		}
-	}
-	else
-	{
-		// They both wrapped, we can just use the minimum of the two.
-		if ((iter == mUnackedPackets.end()) && (iter_final == mFinalRetryPackets.end()))
-		{
-			// Wow!  No unacked packets at all!
-			// Send the ID of the last packet we sent out.
-			// This will flush all of the destination's
-			// unacked packets, theoretically.
-			//llinfos << mHost << ": No unacked!" << llendl;
-			packet_id = getPacketOutID();
-		}
-		else
-		{
-			BOOL had_unacked = FALSE;
-			if (iter != mUnackedPackets.end())
-			{
-				// Unacked list has the lowest so far
-				packet_id = iter->first;
-				had_unacked = TRUE;
-				//llinfos << mHost << ": Unacked" << llendl;
-			}
-
-			if (iter_final != mFinalRetryPackets.end())
-			{
-				// Use the lowest of the unacked list and the final list
-				if (had_unacked)
-				{
-					// Both had a packet, use the lowest.
-					packet_id = llmin(packet_id, iter_final->first);
-					//llinfos << mHost << ": Min of unacked/final" << llendl;
-				}
-				else
-				{
-					// Only the final had a packet, use it.
-					packet_id = iter_final->first;
-					//llinfos << mHost << ": Final!" << llendl;
-				}
-			}
-		}
+		// Wow!  No unacked packets at all!
+		// Send the ID of the last packet we sent out.
+		// This will flush all of the destination's
+		// unacked packets, theoretically.
+		packet_id = getPacketOutID();
 	}
 
 	// Send off the another ping.
@@ -994,51 +848,64 @@ BOOL LLCircuitData::updateWatchDogTimers(LLMessageSystem *msgsys)
 }
 
 
-void LLCircuitData::clearDuplicateList(TPACKETID oldest_id)
+// Picks the entries clearDuplicateList() drops from the duplicate
+// suppression window.
+class LLDuplicateListPurge
 {
-	// purge old data from the duplicate suppression queue
-
-	// we want to KEEP all x where oldest_id <= x <= last incoming packet, and delete everything else.
-
-	//llinfos << mHost << ": clearing before oldest " << oldest_id << llendl;
-	//llinfos << "Recent list before: " << mRecentlyReceivedReliablePackets.size() << llendl;
-	if (oldest_id < mHighestPacketID)
+public:
+	LLDuplicateListPurge(TPACKETID oldest_id, TPACKETID highest_id, U64 mt_usec)
+	:	mOldestID(oldest_id),
+		mHighestID(highest_id),
+		mMessageTimeUsec(mt_usec)
 	{
-		// Clean up everything with a packet ID less than oldest_id.
-		packet_time_map::iterator pit_start;
-		packet_time_map::iterator pit_end;
-		pit_start = mRecentlyReceivedReliablePackets.begin();
-		pit_end = mRecentlyReceivedReliablePackets.lower_bound(oldest_id);
-		mRecentlyReceivedReliablePackets.erase(pit_start, pit_end);
 	}
 
-	// Do timeout checks on everything with an ID > mHighestPacketID.
-	// This should be empty except for wrapping IDs.  Thus, this should be
-	// highly rare.
-	U64 mt_usec = LLMessageSystem::getMessageTimeUsecs();
-
-	packet_time_map::iterator pit;
-	for(pit = mRecentlyReceivedReliablePackets.upper_bound(mHighestPacketID);
-		pit != mRecentlyReceivedReliablePackets.end(); )
+	bool operator()(TPACKETID id, U64 received_usec) const
 	{
-		// Validate that the packet ID seems far enough away
-		if ((pit->first - mHighestPacketID) < 100)
-		{
-			llwarns << "Probably incorrectly timing out non-wrapped packets!" << llendl;
-		}
-		U64 delta_t_usec = mt_usec - (*pit).second;
-		F64 delta_t_sec = delta_t_usec * SEC_PER_USEC;
-		if (delta_t_sec > LL_DUPLICATE_SUPPRESSION_TIMEOUT)
+		// Clean up everything with a packet ID less than oldest_id.
+		if (mOldestID < mHighestID && id < mOldestID)
 		{
-			// enough time has elapsed we're not likely to get a duplicate on this one
-			llinfos << "Clearing " << pit->first << " from recent list" << llendl;
-			mRecentlyReceivedReliablePackets.erase(pit++);
+			return true;
 		}
-		else
+
+		// Do timeout checks on everything with an ID > mHighestPacketID.
+		// This should be empty except for wrapping IDs.  Thus, this should be
+		// highly rare.
+		if (id > mHighestID)
 		{
-			++pit;
+			// Validate that the packet ID seems far enough away
+			if ((id - mHighestID) < 100)
+			{
+				llwarns << "Probably incorrectly timing out non-wrapped packets!" << llendl;
+			}
+			U64 delta_t_usec = mMessageTimeUsec - received_usec;
+			F64 delta_t_sec = delta_t_usec * SEC_PER_USEC;
+			if (delta_t_sec > LL_DUPLICATE_SUPPRESSION_TIMEOUT)
+			{
+				// enough time has elapsed we're not likely to get a duplicate on this one
+				llinfos << "Clearing " << id << " from recent list" << llendl;
+				return true;
+			}
 		}
+		return false;
 	}
+
+private:
+	TPACKETID	mOldestID;
+	TPACKETID	mHighestID;
+	U64			mMessageTimeUsec;
+};
+
+void LLCircuitData::clearDuplicateList(TPACKETID oldest_id)
+{
+	// purge old data from the duplicate suppression queue
+
+	// we want to KEEP all x where oldest_id <= x <= last incoming packet, and delete everything else.
+
+	//llinfos << mHost << ": clearing before oldest " << oldest_id << llendl;
+	//llinfos << "Recent list before: " << mRecentlyReceivedReliablePackets.size() << llendl;
+	LLDuplicateListPurge purge(oldest_id, mHighestPacketID, LLMessageSystem::getMessageTimeUsecs());
+	mRecentlyReceivedReliablePackets.eraseIf(purge);
 	//llinfos << "Recent list after: " << mRecentlyReceivedReliablePackets.size() << llendl;
 }
 
@@ -1080,7 +947,7 @@ BOOL LLCircuitData::collectRAck(TPACKETID packet_num)
 		gMessageSystem->mCircuitInfo.mSendAckMap[mHost] = this;
 	}
 
-	mAcks.push_back(packet_num);
+	mAcks.push(packet_num);
 	return TRUE;
 }
 
@@ -1123,8 +990,10 @@ void LLCircuit::sendAcks()
 			{
 				std::ostringstream str;
 				str << "MSG: -> " << cd->mHost << "\tPACKET ACKS:\t";
-				std::ostream_iterator<TPACKETID> append(str, " ");
-				std::copy(cd->mAcks.begin(), cd->mAcks.end(), append);
+				for(S32 i = 0; i < count; ++i)
+				{
+					str << cd->mAcks[i] << " ";
+				}
 				llinfos << str.str() << llendl;
 			}
 
@@ -43,6 +43,7 @@
 #include "net.h"
 #include "llhost.h"
 #include "llpacketack.h"
+#include "llpacketwindow.h"
 #include "lluuid.h"
 #include "llthrottle.h"
 #include "llstat.h"
@@ -244,14 +245,12 @@ protected:
 	typedef std::map<TPACKETID, U64> packet_time_map;
 
 	packet_time_map							mPotentialLostPackets;
-	packet_time_map							mRecentlyReceivedReliablePackets;
-	std::vector<TPACKETID> mAcks;
+	LLPacketIDWindow<U64>					mRecentlyReceivedReliablePackets;
+	LLPacketAckQueue						mAcks;
 
-	typedef std::map<TPACKETID, LLReliablePacket *> reliable_map;
-	typedef reliable_map::iterator					reliable_iter;
-
-	reliable_map							mUnackedPackets;
-	reliable_map							mFinalRetryPackets;
+	// Reliable packets we have sent and not had acked, in send order.
+	// Those out of retries are flagged as being on their final retry.
+	LLReliablePacketWindow					mUnackedPackets;
 
 	S32										mUnackedPacketCount;
 	S32										mUnackedPacketBytes;
@@ -52,14 +52,23 @@ LLPacketRing::LLPacketRing () :
 	mInBufferLength(0),
 	mOutBufferLength(0),
 	mDropPercentage(0.0f),
-	mPacketsToDrop(0x0)
+	mPacketsToDrop(0x0),
+	mBatchBuffer(NULL),
+	mBatchCount(0),
+	mBatchNext(0),
+	mReceiveCalls(0),
+	mEmptyReceiveCalls(0),
+	mReceivedPackets(0)
 {
+	mBatchBuffer = new char[RECEIVE_BATCH_SIZE * NET_BUFFER_SIZE];
 }
 
 ///////////////////////////////////////////////////////////
 LLPacketRing::~LLPacketRing ()
 {
 	cleanup();
+	delete[] mBatchBuffer;
+	mBatchBuffer = NULL;
 }
 	
 ///////////////////////////////////////////////////////////
@@ -80,6 +89,9 @@ void LLPacketRing::cleanup ()
 		delete packetp;
 		mSendQueue.pop();
 	}
+
+	mBatchCount = 0;
+	mBatchNext = 0;
 }
 
 ///////////////////////////////////////////////////////////
@@ -149,6 +161,30 @@ S32 LLPacketRing::receiveFromRing (S32 socket, char *datap)
 	return packet_size;
 }
 
+///////////////////////////////////////////////////////////
+S32 LLPacketRing::receiveFromBatch (S32 socket, char *datap)
+{
+	if (mBatchNext >= mBatchCount)
+	{
+		// batch used up, drain the socket again
+		mBatchNext = 0;
+		mBatchCount = receive_packets(socket, mBatchBuffer, mBatchSizes, mBatchSenders, RECEIVE_BATCH_SIZE);
+		mReceiveCalls++;
+		if (!mBatchCount)
+		{
+			mEmptyReceiveCalls++;
+			return 0;
+		}
+		mReceivedPackets += mBatchCount;
+	}
+
+	S32 index = mBatchNext++;
+	S32 packet_size = mBatchSizes[index];
+	memcpy(datap, mBatchBuffer + index * NET_BUFFER_SIZE, packet_size);	/*Flawfinder: ignore*/
+	mLastSender = mBatchSenders[index];
+	return packet_size;
+}
+
 ///////////////////////////////////////////////////////////
 S32 LLPacketRing::receivePacket (S32 socket, char *datap)
 {
@@ -220,8 +256,7 @@ S32 LLPacketRing::receivePacket (S32 socket, char *datap)
 	else
 	{
 		// no delay, pull straight from net
-		packet_size = receive_packet(socket, datap);		
-		mLastSender = ::get_sender();
+		packet_size = receiveFromBatch(socket, datap);
 
 		if (packet_size)  // did we actually get a packet?
 		{
@@ -57,6 +57,7 @@ public:
 	void setOutBandwidth(const F32 bps);
 	S32  receivePacket (S32 socket, char *datap);
 	S32  receiveFromRing (S32 socket, char *datap);
+	S32  receiveFromBatch (S32 socket, char *datap);
 
 	BOOL sendPacket(int h_socket, char * send_buffer, S32 buf_size, LLHost host);
 
@@ -64,6 +65,12 @@ public:
 
 	S32 getAndResetActualInBits()				{ S32 bits = mActualBitsIn; mActualBitsIn = 0; return bits;}
 	S32 getAndResetActualOutBits()				{ S32 bits = mActualBitsOut; mActualBitsOut = 0; return bits;}
+
+	// Receive system calls made, how many of them found nothing, and the
+	// datagrams they returned.  Packets per call is the batching win.
+	U64 getReceiveCalls() const					{ return mReceiveCalls; }
+	U64 getEmptyReceiveCalls() const			{ return mEmptyReceiveCalls; }
+	U64 getReceivedPackets() const				{ return mReceivedPackets; }
 protected:
 	BOOL mUseInThrottle;
 	BOOL mUseOutThrottle;
@@ -84,6 +91,19 @@ protected:
 	std::queue<LLPacketBuffer *> mReceiveQueue;
 	std::queue<LLPacketBuffer *> mSendQueue;
 
+	// Datagrams drained by the last receive_packets() call, handed out
+	// one at a time before the socket is read again.
+	enum { RECEIVE_BATCH_SIZE = 32 };
+	char* mBatchBuffer;				// RECEIVE_BATCH_SIZE buffers of NET_BUFFER_SIZE
+	S32 mBatchSizes[RECEIVE_BATCH_SIZE];
+	LLHost mBatchSenders[RECEIVE_BATCH_SIZE];
+	S32 mBatchCount;
+	S32 mBatchNext;
+
+	U64 mReceiveCalls;
+	U64 mEmptyReceiveCalls;
+	U64 mReceivedPackets;
+
 	LLHost mLastSender;
 };
 
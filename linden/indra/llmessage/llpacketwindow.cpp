@@ -0,0 +1,166 @@
+/** 
+ * @file llpacketwindow.cpp
+ * @brief Packet id keyed tables for reliable packets, duplicate suppression and acks.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "llpacketwindow.h"
+
+const U32 RELIABLE_WINDOW_SIZE = 256;
+const U32 RELIABLE_WINDOW_MAX_SIZE = 16384;
+const U32 ACK_QUEUE_SIZE = 64;
+
+LLReliablePacketWindow::LLReliablePacketWindow()
+:	mEntries(RELIABLE_WINDOW_SIZE, RELIABLE_WINDOW_MAX_SIZE),
+	mOldestID(LL_INVALID_PACKET_ID),
+	mNewestID(LL_INVALID_PACKET_ID)
+{
+}
+
+void LLReliablePacketWindow::add(TPACKETID id, LLReliablePacket* packetp, BOOL final_retry)
+{
+	if (mEntries.find(id))
+	{
+		// Only possible if a packet is still unacked after the ids have
+		// gone all the way around.  Replace it, as the old map did.
+		llwarns << "Reliable packet " << id << " is still waiting for an ack, replacing it" << llendl;
+		remove(id);
+	}
+
+	Entry& entry = mEntries[id];
+	entry.mPacket = packetp;
+	entry.mFinalRetry = final_retry;
+	entry.mPrevID = mNewestID;
+	entry.mNextID = LL_INVALID_PACKET_ID;
+
+	if (mNewestID != LL_INVALID_PACKET_ID)
+	{
+		mEntries.find(mNewestID)->mNextID = id;
+	}
+	else
+	{
+		mOldestID = id;
+	}
+	mNewestID = id;
+}
+
+LLReliablePacket* LLReliablePacketWindow::find(TPACKETID id) const
+{
+	const Entry* entryp = mEntries.find(id);
+	return entryp ? entryp->mPacket : NULL;
+}
+
+LLReliablePacket* LLReliablePacketWindow::remove(TPACKETID id)
+{
+	Entry* entryp = mEntries.find(id);
+	if (!entryp)
+	{
+		return NULL;
+	}
+
+	LLReliablePacket* packetp = entryp->mPacket;
+	TPACKETID prev_id = entryp->mPrevID;
+	TPACKETID next_id = entryp->mNextID;
+	mEntries.erase(id);
+
+	if (prev_id != LL_INVALID_PACKET_ID)
+	{
+		mEntries.find(prev_id)->mNextID = next_id;
+	}
+	else
+	{
+		mOldestID = next_id;
+	}
+
+	if (next_id != LL_INVALID_PACKET_ID)
+	{
+		mEntries.find(next_id)->mPrevID = prev_id;
+	}
+	else
+	{
+		mNewestID = prev_id;
+	}
+	return packetp;
+}
+
+BOOL LLReliablePacketWindow::isFinalRetry(TPACKETID id) const
+{
+	const Entry* entryp = mEntries.find(id);
+	return entryp ? entryp->mFinalRetry : FALSE;
+}
+
+void LLReliablePacketWindow::setFinalRetry(TPACKETID id)
+{
+	Entry* entryp = mEntries.find(id);
+	if (entryp)
+	{
+		entryp->mFinalRetry = TRUE;
+	}
+}
+
+TPACKETID LLReliablePacketWindow::getNextID(TPACKETID id) const
+{
+	const Entry* entryp = mEntries.find(id);
+	return entryp ? entryp->mNextID : LL_INVALID_PACKET_ID;
+}
+
+
+LLPacketAckQueue::LLPacketAckQueue()
+:	mIDs(ACK_QUEUE_SIZE),
+	mMask(ACK_QUEUE_SIZE - 1),
+	mFirst(0),
+	mCount(0)
+{
+}
+
+void LLPacketAckQueue::push(TPACKETID id)
+{
+	if (mCount == (S32)mIDs.size())
+	{
+		// Full, unroll into a ring twice the size.
+		std::vector<TPACKETID> ids(mIDs.size() * 2);
+		for (S32 i = 0; i < mCount; ++i)
+		{
+			ids[i] = (*this)[i];
+		}
+		mIDs.swap(ids);
+		mMask = (U32)mIDs.size() - 1;
+		mFirst = 0;
+	}
+	mIDs[(mFirst + mCount) & mMask] = id;
+	mCount++;
+}
+
+void LLPacketAckQueue::pop(S32 count)
+{
+	count = llmin(count, mCount);
+	mFirst = (mFirst + count) & mMask;
+	mCount -= count;
+}
@@ -0,0 +1,300 @@
+/** 
+ * @file llpacketwindow.h
+ * @brief Packet id keyed tables for reliable packets, duplicate suppression and acks.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLPACKETWINDOW_H
+#define LL_LLPACKETWINDOW_H
+
+#include <map>
+#include <vector>
+
+class LLReliablePacket;
+
+// Never produced by nextPacketOutID(), which wraps at LL_MAX_OUT_PACKET_ID.
+const TPACKETID LL_INVALID_PACKET_ID = 0xFFFFFFFF;
+
+//
+// Table of values keyed by packet id.  Ids are placed in a power of two
+// window by their low bits, so a run of sequential ids never collides and
+// find, insert and erase are O(1) without allocating.  When an id lands on
+// a slot that is still in use the window doubles, up to the maximum size;
+// past that the (rare) colliding ids spill into a std::map.
+//
+template <class DATA_TYPE>
+class LLPacketIDWindow
+{
+public:
+	LLPacketIDWindow(U32 window_size, U32 max_window_size)
+	:	mSlots(window_size),
+		mMask(window_size - 1),
+		mMaxSize(max_window_size),
+		mCount(0)
+	{
+		llassert(window_size && !(window_size & mMask));
+	}
+
+	DATA_TYPE* find(TPACKETID id)
+	{
+		Slot& slot = mSlots[id & mMask];
+		if (slot.mID == id && id != LL_INVALID_PACKET_ID)
+		{
+			return &slot.mData;
+		}
+		if (mOverflow.empty())
+		{
+			return NULL;
+		}
+		typename overflow_map_t::iterator iter = mOverflow.find(id);
+		return (iter != mOverflow.end()) ? &iter->second : NULL;
+	}
+
+	const DATA_TYPE* find(TPACKETID id) const
+	{
+		return const_cast<LLPacketIDWindow<DATA_TYPE>*>(this)->find(id);
+	}
+
+	// Same semantics as std::map::operator[], a missing id is added with
+	// a default constructed value.
+	DATA_TYPE& operator[](TPACKETID id)
+	{
+		DATA_TYPE* datap = find(id);
+		if (datap)
+		{
+			return *datap;
+		}
+
+		mCount++;
+		if (id != LL_INVALID_PACKET_ID)
+		{
+			while (mSlots[id & mMask].mID != LL_INVALID_PACKET_ID
+				   && mSlots.size() < mMaxSize)
+			{
+				grow();
+			}
+			Slot& slot = mSlots[id & mMask];
+			if (slot.mID == LL_INVALID_PACKET_ID)
+			{
+				slot.mID = id;
+				return slot.mData;
+			}
+		}
+		return mOverflow[id];
+	}
+
+	bool erase(TPACKETID id)
+	{
+		Slot& slot = mSlots[id & mMask];
+		if (slot.mID == id && id != LL_INVALID_PACKET_ID)
+		{
+			slot.mID = LL_INVALID_PACKET_ID;
+			slot.mData = DATA_TYPE();
+			mCount--;
+			return true;
+		}
+		if (!mOverflow.empty() && mOverflow.erase(id))
+		{
+			mCount--;
+			return true;
+		}
+		return false;
+	}
+
+	// Calls pred(id, data) on every entry and erases those it returns
+	// true for.  Visits the whole window, so keep it off per-packet paths.
+	template <class PREDICATE>
+	S32 eraseIf(PREDICATE& pred)
+	{
+		S32 erased = 0;
+		for (typename slot_vec_t::iterator iter = mSlots.begin(); iter != mSlots.end(); ++iter)
+		{
+			if (iter->mID != LL_INVALID_PACKET_ID && pred(iter->mID, iter->mData))
+			{
+				iter->mID = LL_INVALID_PACKET_ID;
+				iter->mData = DATA_TYPE();
+				erased++;
+			}
+		}
+		for (typename overflow_map_t::iterator iter = mOverflow.begin(); iter != mOverflow.end(); )
+		{
+			if (pred(iter->first, iter->second))
+			{
+				mOverflow.erase(iter++);
+				erased++;
+			}
+			else
+			{
+				++iter;
+			}
+		}
+		mCount -= erased;
+		return erased;
+	}
+
+	void clear()
+	{
+		if (!mCount)
+		{
+			return;
+		}
+		for (typename slot_vec_t::iterator iter = mSlots.begin(); iter != mSlots.end(); ++iter)
+		{
+			*iter = Slot();
+		}
+		mOverflow.clear();
+		mCount = 0;
+	}
+
+	S32 size() const				{ return mCount; }
+	bool empty() const				{ return !mCount; }
+	U32 getWindowSize() const		{ return (U32)mSlots.size(); }
+	S32 getOverflowCount() const	{ return (S32)mOverflow.size(); }
+
+private:
+	struct Slot
+	{
+		Slot() : mID(LL_INVALID_PACKET_ID), mData() {}
+		TPACKETID mID;
+		DATA_TYPE mData;
+	};
+	typedef std::vector<Slot> slot_vec_t;
+	typedef std::map<TPACKETID, DATA_TYPE> overflow_map_t;
+
+	void grow()
+	{
+		slot_vec_t old_slots(mSlots.size() * 2);
+		old_slots.swap(mSlots);
+		mMask = (U32)mSlots.size() - 1;
+
+		// Ids distinct in the old low bits stay distinct in the new ones.
+		for (typename slot_vec_t::iterator iter = old_slots.begin(); iter != old_slots.end(); ++iter)
+		{
+			if (iter->mID != LL_INVALID_PACKET_ID)
+			{
+				mSlots[iter->mID & mMask] = *iter;
+			}
+		}
+
+		// Give spilled ids a chance to move back into the window.
+		for (typename overflow_map_t::iterator iter = mOverflow.begin(); iter != mOverflow.end(); )
+		{
+			Slot& slot = mSlots[iter->first & mMask];
+			if (iter->first != LL_INVALID_PACKET_ID && slot.mID == LL_INVALID_PACKET_ID)
+			{
+				slot.mID = iter->first;
+				slot.mData = iter->second;
+				mOverflow.erase(iter++);
+			}
+			else
+			{
+				++iter;
+			}
+		}
+	}
+
+	slot_vec_t		mSlots;
+	U32				mMask;
+	U32				mMaxSize;
+	S32				mCount;
+	overflow_map_t	mOverflow;
+};
+
+//
+// Reliable packets waiting for an ack, in the order they were sent.  The
+// entries are linked by packet id so the list survives the window growing,
+// and removing an acked packet from the middle is O(1).  Packets on their
+// final retry stay in place and are only flagged.
+//
+class LLReliablePacketWindow
+{
+public:
+	LLReliablePacketWindow();
+
+	// id must be newer than every packet already in the window.
+	void add(TPACKETID id, LLReliablePacket* packetp, BOOL final_retry);
+
+	// Returns the packet, or NULL if it is not waiting for an ack.  The
+	// caller owns the packet returned by remove().
+	LLReliablePacket* find(TPACKETID id) const;
+	LLReliablePacket* remove(TPACKETID id);
+
+	BOOL isFinalRetry(TPACKETID id) const;
+	void setFinalRetry(TPACKETID id);
+
+	// Oldest packet sent, then the one sent after id.  Both return
+	// LL_INVALID_PACKET_ID at the end of the list.
+	TPACKETID getOldestID() const		{ return mOldestID; }
+	TPACKETID getNextID(TPACKETID id) const;
+
+	S32 size() const					{ return mEntries.size(); }
+	bool empty() const					{ return mEntries.empty(); }
+
+private:
+	struct Entry
+	{
+		Entry() : mPacket(NULL), mPrevID(LL_INVALID_PACKET_ID), mNextID(LL_INVALID_PACKET_ID), mFinalRetry(FALSE) {}
+		LLReliablePacket* mPacket;
+		TPACKETID mPrevID;
+		TPACKETID mNextID;
+		BOOL mFinalRetry;
+	};
+
+	LLPacketIDWindow<Entry> mEntries;
+	TPACKETID mOldestID;
+	TPACKETID mNewestID;
+};
+
+//
+// FIFO of packet ids waiting to be acked, kept in a ring so taking acks
+// off the front for a packet does not shuffle the rest down.
+//
+class LLPacketAckQueue
+{
+public:
+	LLPacketAckQueue();
+
+	void push(TPACKETID id);
+	// Drops the first count ids.
+	void pop(S32 count);
+	void clear()							{ mFirst = 0; mCount = 0; }
+
+	// i-th oldest queued id
+	TPACKETID operator[](S32 i) const		{ return mIDs[(mFirst + i) & mMask]; }
+
+	S32 size() const						{ return mCount; }
+	bool empty() const						{ return !mCount; }
+
+private:
+	std::vector<TPACKETID> mIDs;
+	U32 mMask;
+	U32 mFirst;
+	S32 mCount;
+};
+
+#endif
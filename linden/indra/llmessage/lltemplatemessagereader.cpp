@@ -46,7 +46,8 @@ LLTemplateMessageReader::LLTemplateMessageReader(message_template_number_map_t&
 												 number_template_map) :
 	mReceiveSize(0),
 	mCurrentRMessageTemplate(NULL),
-	mCurrentRMessageData(NULL),
+	mCurrentRBuffer(NULL),
+	mCurrentRLayout(NULL),
 	mMessageNumbers(number_template_map)
 {
 }
@@ -54,8 +55,6 @@ LLTemplateMessageReader::LLTemplateMessageReader(message_template_number_map_t&
 //virtual 
 LLTemplateMessageReader::~LLTemplateMessageReader()
 {
-	delete mCurrentRMessageData;
-	mCurrentRMessageData = NULL;
 }
 
 //virtual
@@ -63,8 +62,58 @@ void LLTemplateMessageReader::clearMessage()
 {
 	mReceiveSize = -1;
 	mCurrentRMessageTemplate = NULL;
-	delete mCurrentRMessageData;
-	mCurrentRMessageData = NULL;
+	mCurrentRBuffer = NULL;
+	mCurrentRLayout = NULL;
+}
+
+LLTemplateMessageReader::msg_block_layout_t& LLTemplateMessageReader::getBlockLayout(const LLMessageTemplate* msg_template)
+{
+	msg_block_layout_t& layout = mBlockLayouts[msg_template];
+	if (layout.size() != msg_template->mMemberBlocks.size())
+	{
+		// first packet of this template
+		layout.clear();
+		layout.reserve(msg_template->mMemberBlocks.size());
+		LLMessageTemplate::message_block_map_t::const_iterator iter;
+		for (iter = msg_template->mMemberBlocks.begin();
+			 iter != msg_template->mMemberBlocks.end();
+			 ++iter)
+		{
+			LLMsgBlockLayout block_layout;
+			block_layout.mBlock = *iter;
+			block_layout.mNumVariables = (S32)(*iter)->mMemberVariables.size();
+			block_layout.mNumInstances = 0;
+			block_layout.mFirstSlot = 0;
+			layout.push_back(block_layout);
+		}
+	}
+	return layout;
+}
+
+const LLTemplateMessageReader::LLMsgBlockLayout* LLTemplateMessageReader::findBlockLayout(const char* blockname) const
+{
+	// block names are canonical strings, so this is a pointer compare
+	LLMessageTemplate::message_block_map_t::const_iterator iter = 
+		mCurrentRMessageTemplate->mMemberBlocks.find((char*)blockname);
+	if (iter == mCurrentRMessageTemplate->mMemberBlocks.end())
+	{
+		return NULL;
+	}
+	return &(*mCurrentRLayout)[iter - mCurrentRMessageTemplate->mMemberBlocks.begin()];
+}
+
+const LLMessageVariable* LLTemplateMessageReader::findVariable(const LLMsgBlockLayout& layout,
+															   const char* varname,
+															   S32* var_index) const
+{
+	const LLMessageBlock::message_variable_map_t& variables = layout.mBlock->mMemberVariables;
+	LLMessageBlock::message_variable_map_t::const_iterator iter = variables.find(varname);
+	if (iter == variables.end())
+	{
+		return NULL;
+	}
+	*var_index = (S32)(iter - variables.begin());
+	return *iter;
 }
 
 void LLTemplateMessageReader::getData(const char *blockname, const char *varname, void *datap, S32 size, S32 blocknum, S32 max_size)
@@ -76,77 +125,70 @@ void LLTemplateMessageReader::getData(const char *blockname, const char *varname
 		return;
 	}
 
-	if (!mCurrentRMessageData)
+	if (!mCurrentRLayout)
 	{
-		llerrs << "Invalid mCurrentMessageData in getData!" << llendl;
+		llerrs << "Invalid mCurrentRLayout in getData!" << llendl;
 		return;
 	}
 
-	char *bnamep = (char *)blockname + blocknum; // this works because it's just a hash.  The bnamep is never derefference
-	char *vnamep = (char *)varname; 
-
-	LLMsgData::msg_blk_data_map_t::const_iterator iter = mCurrentRMessageData->mMemberBlocks.find(bnamep);
-
-	if (iter == mCurrentRMessageData->mMemberBlocks.end())
+	const LLMsgBlockLayout* layout = findBlockLayout(blockname);
+	if (!layout || blocknum < 0 || blocknum >= layout->mNumInstances)
 	{
 		llerrs << "Block " << blockname << " #" << blocknum
-			<< " not in message " << mCurrentRMessageData->mName << llendl;
+			<< " not in message " << mCurrentRMessageTemplate->mName << llendl;
 		return;
 	}
 
-	LLMsgBlkData *msg_block_data = iter->second;
-	LLMsgVarData& vardata = msg_block_data->mMemberVarData[vnamep];
-
-	if (!vardata.getName())
+	S32 var_index = 0;
+	const LLMessageVariable* variable = findVariable(*layout, varname, &var_index);
+	if (!variable)
 	{
-		llerrs << "Variable "<< vnamep << " not in message "
-			<< mCurrentRMessageData->mName<< " block " << bnamep << llendl;
+		llerrs << "Variable "<< varname << " not in message "
+			<< mCurrentRMessageTemplate->mName << " block " << blockname << llendl;
 		return;
 	}
 
-	if (size && size != vardata.getSize())
+	copyData(*layout, var_index, variable, datap, size, blocknum, max_size);
+}
+
+void LLTemplateMessageReader::copyData(const LLMsgBlockLayout& layout, S32 var_index,
+									   const LLMessageVariable* variable, void *datap,
+									   S32 size, S32 blocknum, S32 max_size)
+{
+	const LLMsgVarSlot& slot = mVarSlots[layout.mFirstSlot + blocknum * layout.mNumVariables + var_index];
+	const S32 vardata_size = slot.mSize;
+
+	if (size && size != vardata_size)
 	{
-		llerrs << "Msg " << mCurrentRMessageData->mName 
-			<< " variable " << vnamep
-			<< " is size " << vardata.getSize()
+		llerrs << "Msg " << mCurrentRMessageTemplate->mName 
+			<< " variable " << variable->getName()
+			<< " is size " << vardata_size
 			<< " but copying into buffer of size " << size
 			<< llendl;
 		return;
 	}
 
+	if (slot.mOffset < 0)
+	{
+		// ran off the end of the packet, read as zeros
+		memset(datap, 0, llmin(vardata_size, max_size));
+		return;
+	}
 
-	const S32 vardata_size = vardata.getSize();
+	const U8* vardata = mCurrentRBuffer + slot.mOffset;
 	if( max_size >= vardata_size )
 	{   
-		switch( vardata_size )
-		{ 
-		case 1:
-			*((U8*)datap) = *((U8*)vardata.getData());
-			break;
-		case 2:
-			*((U16*)datap) = *((U16*)vardata.getData());
-			break;
-		case 4:
-			*((U32*)datap) = *((U32*)vardata.getData());
-			break;
-		case 8:
-			((U32*)datap)[0] = ((U32*)vardata.getData())[0];
-			((U32*)datap)[1] = ((U32*)vardata.getData())[1];
-			break;
-		default:
-			memcpy(datap, vardata.getData(), vardata_size);
-			break;
-		}
+		htonmemcpy(datap, vardata, variable->getType(), vardata_size);
 	}
 	else
 	{
-		llwarns << "Msg " << mCurrentRMessageData->mName 
-			<< " variable " << vnamep
-			<< " is size " << vardata.getSize()
+		llwarns << "Msg " << mCurrentRMessageTemplate->mName 
+			<< " variable " << variable->getName()
+			<< " is size " << vardata_size
 			<< " but truncated to max size of " << max_size
 			<< llendl;
 
-		memcpy(datap, vardata.getData(), max_size);
+		memcpy(datap, vardata, max_size);
 	}
 }
 
@@ -159,22 +201,19 @@ S32 LLTemplateMessageReader::getNumberOfBlocks(const char *blockname)
 		return -1;
 	}
 
-	if (!mCurrentRMessageData)
+	if (!mCurrentRLayout)
 	{
-		llerrs << "Invalid mCurrentRMessageData in getData!" << llendl;
+		llerrs << "Invalid mCurrentRLayout in getData!" << llendl;
 		return -1;
 	}
 
-	char *bnamep = (char *)blockname; 
-
-	LLMsgData::msg_blk_data_map_t::const_iterator iter = mCurrentRMessageData->mMemberBlocks.find(bnamep);
-	
-	if (iter == mCurrentRMessageData->mMemberBlocks.end())
+	const LLMsgBlockLayout* layout = findBlockLayout(blockname);
+	if (!layout)
 	{
 		return 0;
 	}
 
-	return (iter->second)->mBlockNumber;
+	return layout->mNumInstances;
 }
 
 S32 LLTemplateMessageReader::getSize(const char *blockname, const char *varname)
@@ -186,43 +225,36 @@ S32 LLTemplateMessageReader::getSize(const char *blockname, const char *varname)
 		return -1;
 	}
 
-	if (!mCurrentRMessageData)
+	if (!mCurrentRLayout)
 	{
-		llerrs << "Invalid mCurrentRMessageData in getData!" << llendl;
+		llerrs << "Invalid mCurrentRLayout in getData!" << llendl;
 		return -1;
 	}
 
-	char *bnamep = (char *)blockname; 
-
-	LLMsgData::msg_blk_data_map_t::const_iterator iter = mCurrentRMessageData->mMemberBlocks.find(bnamep);
-	
-	if (iter == mCurrentRMessageData->mMemberBlocks.end())
+	const LLMsgBlockLayout* layout = findBlockLayout(blockname);
+	if (!layout || !layout->mNumInstances)
 	{
-		llerrs << "Block " << bnamep << " not in message "
-			<< mCurrentRMessageData->mName << llendl;
+		llerrs << "Block " << blockname << " not in message "
+			<< mCurrentRMessageTemplate->mName << llendl;
 		return -1;
 	}
 
-	char *vnamep = (char *)varname; 
-
-	LLMsgBlkData* msg_data = iter->second;
-	LLMsgVarData& vardata = msg_data->mMemberVarData[vnamep];
-	
-	if (!vardata.getName())
+	S32 var_index = 0;
+	if (!findVariable(*layout, varname, &var_index))
 	{
 		llerrs << "Variable " << varname << " not in message "
-			<< mCurrentRMessageData->mName << " block " << bnamep << llendl;
+			<< mCurrentRMessageTemplate->mName << " block " << blockname << llendl;
 		return -1;
 	}
 
-	if (mCurrentRMessageTemplate->mMemberBlocks[bnamep]->mType != MBT_SINGLE)
+	if (layout->mBlock->mType != MBT_SINGLE)
 	{
-		llerrs << "Block " << bnamep << " isn't type MBT_SINGLE,"
+		llerrs << "Block " << blockname << " isn't type MBT_SINGLE,"
 			" use getSize with blocknum argument!" << llendl;
 		return -1;
 	}
 
-	return vardata.getSize();
+	return mVarSlots[layout->mFirstSlot + var_index].mSize;
 }
 
 S32 LLTemplateMessageReader::getSize(const char *blockname, S32 blocknum, const char *varname)
@@ -234,35 +266,102 @@ S32 LLTemplateMessageReader::getSize(const char *blockname, S32 blocknum, const
 		return -1;
 	}
 
-	if (!mCurrentRMessageData)
+	if (!mCurrentRLayout)
 	{
-		llerrs << "Invalid mCurrentRMessageData in getData!" << llendl;
+		llerrs << "Invalid mCurrentRLayout in getData!" << llendl;
 		return -1;
 	}
 
-	char *bnamep = (char *)blockname + blocknum; 
-	char *vnamep = (char *)varname; 
+	const LLMsgBlockLayout* layout = findBlockLayout(blockname);
+	if (!layout || blocknum < 0 || blocknum >= layout->mNumInstances)
+	{
+		llerrs << "Block " << blockname << " #" << blocknum
+			<< " not in message " << mCurrentRMessageTemplate->mName << llendl;
+		return -1;
+	}
+
+	S32 var_index = 0;
+	if (!findVariable(*layout, varname, &var_index))
+	{
+		llerrs << "Variable " << varname << " not in message "
+			<<  mCurrentRMessageTemplate->mName << " block " << blockname << llendl;
+		return -1;
+	}
+
+	return mVarSlots[layout->mFirstSlot + blocknum * layout->mNumVariables + var_index].mSize;
+}
+
+const LLTemplateMessageReader::LLMsgBlockLayout* LLTemplateMessageReader::getBlockLayoutIndex(S32 block, S32 var, S32 blocknum) const
+{
+	// is there a message ready to go?
+	if (mReceiveSize == -1 || !mCurrentRLayout)
+	{
+		llerrs << "No message waiting for decode 6!" << llendl;
+		return NULL;
+	}
+
+	if (block < 0 || block >= (S32)mCurrentRLayout->size())
+	{
+		llerrs << "Block index " << block << " not in message "
+			<< mCurrentRMessageTemplate->mName << llendl;
+		return NULL;
+	}
+
+	const LLMsgBlockLayout& layout = (*mCurrentRLayout)[block];
+	if (blocknum < 0 || blocknum >= layout.mNumInstances)
+	{
+		llerrs << "Block " << layout.mBlock->mName << " #" << blocknum
+			<< " not in message " << mCurrentRMessageTemplate->mName << llendl;
+		return NULL;
+	}
+
+	if (var < 0 || var >= layout.mNumVariables)
+	{
+		llerrs << "Variable index " << var << " not in message "
+			<< mCurrentRMessageTemplate->mName << " block " << layout.mBlock->mName << llendl;
+		return NULL;
+	}
+
+	return &layout;
+}
 
-	LLMsgData::msg_blk_data_map_t::const_iterator iter = mCurrentRMessageData->mMemberBlocks.find(bnamep);
-	
-	if (iter == mCurrentRMessageData->mMemberBlocks.end())
+void LLTemplateMessageReader::getDataIndex(S32 block, S32 var, void *datap, S32 size, S32 blocknum, S32 max_size)
+{
+	const LLMsgBlockLayout* layout = getBlockLayoutIndex(block, var, blocknum);
+	if (layout)
+	{
+		copyData(*layout, var, *(layout->mBlock->mMemberVariables.begin() + var),
+				 datap, size, blocknum, max_size);
+	}
+}
+
+S32 LLTemplateMessageReader::getNumberOfBlocksIndex(S32 block) const
+{
+	// is there a message ready to go?
+	if (mReceiveSize == -1 || !mCurrentRLayout)
 	{
-		llerrs << "Block " << bnamep << " not in message "
-			<< mCurrentRMessageData->mName << llendl;
+		llerrs << "No message waiting for decode 7!" << llendl;
 		return -1;
 	}
 
-	LLMsgBlkData* msg_data = iter->second;
-	LLMsgVarData& vardata = msg_data->mMemberVarData[vnamep];
-	
-	if (!vardata.getName())
+	if (block < 0 || block >= (S32)mCurrentRLayout->size())
 	{
-		llerrs << "Variable " << vnamep << " not in message "
-			<<  mCurrentRMessageData->mName << " block " << bnamep << llendl;
+		llerrs << "Block index " << block << " not in message "
+			<< mCurrentRMessageTemplate->mName << llendl;
 		return -1;
 	}
 
-	return vardata.getSize();
+	return (*mCurrentRLayout)[block].mNumInstances;
+}
+
+S32 LLTemplateMessageReader::getSizeIndex(S32 block, S32 var, S32 blocknum) const
+{
+	const LLMsgBlockLayout* layout = getBlockLayoutIndex(block, var, blocknum);
+	if (!layout)
+	{
+		return -1;
+	}
+	return mVarSlots[layout->mFirstSlot + blocknum * layout->mNumVariables + var].mSize;
 }
 
 void LLTemplateMessageReader::getBinaryData(const char *blockname, 
@@ -535,24 +634,26 @@ BOOL LLTemplateMessageReader::decodeData(const U8* buffer, const LLHost& sender
 {
 	llassert( mReceiveSize >= 0 );
 	llassert( mCurrentRMessageTemplate);
-	llassert( !mCurrentRMessageData );
-	delete mCurrentRMessageData; // just to make sure
 
 	// The offset tells us how may bytes to skip after the end of the
 	// message name.
 	U8 offset = buffer[PHL_OFFSET];
 	S32 decode_pos = LL_PACKET_ID_SIZE + (S32)(mCurrentRMessageTemplate->mFrequency) + offset;
 
-	// create base working data set
-	mCurrentRMessageData = new LLMsgData(mCurrentRMessageTemplate->mName);
-	
-	// loop through the template building the data structure as we go
-	LLMessageTemplate::message_block_map_t::const_iterator iter;
-	for(iter = mCurrentRMessageTemplate->mMemberBlocks.begin();
-		iter != mCurrentRMessageTemplate->mMemberBlocks.end();
-		++iter)
+	// reuse the layout and slots of the previous message, clear() keeps
+	// the capacity so this only allocates while warming up
+	mCurrentRBuffer = buffer;
+	mCurrentRLayout = &getBlockLayout(mCurrentRMessageTemplate);
+	mVarSlots.clear();
+	S32 total_blocks = 0;
+
+	// loop through the template recording where each variable lives
+	for (msg_block_layout_t::iterator layout_iter = mCurrentRLayout->begin();
+		 layout_iter != mCurrentRLayout->end();
+		 ++layout_iter)
 	{
-		LLMessageBlock* mbci = *iter;
+		LLMsgBlockLayout& layout = *layout_iter;
+		const LLMessageBlock* mbci = layout.mBlock;
 		U8	repeat_number;
 		S32	i;
 
@@ -593,36 +694,20 @@ BOOL LLTemplateMessageReader::decodeData(const U8* buffer, const LLHost& sender
 			return FALSE;
 		}
 
-		LLMsgBlkData* cur_data_block = NULL;
+		layout.mNumInstances = repeat_number;
+		layout.mFirstSlot = (S32)mVarSlots.size();
+		total_blocks += repeat_number;
 
 		// now loop through the block
 		for (i = 0; i < repeat_number; i++)
 		{
-			if (i)
-			{
-				// build new name to prevent collisions
-				// TODO: This should really change to a vector
-				cur_data_block = new LLMsgBlkData(mbci->mName, repeat_number);
-				cur_data_block->mName = mbci->mName + i;
-			}
-			else
-			{
-				cur_data_block = new LLMsgBlkData(mbci->mName, repeat_number);
-			}
-
-			// add the block to the message
-			mCurrentRMessageData->addBlock(cur_data_block);
-
 			// now read the variables
 			for (LLMessageBlock::message_variable_map_t::const_iterator iter = 
 					 mbci->mMemberVariables.begin();
 				 iter != mbci->mMemberVariables.end(); iter++)
 			{
 				const LLMessageVariable& mvci = **iter;
-
-				// ok, build out the variables
-				// add variable block
-				cur_data_block->addVariable(mvci.getName(), mvci.getType());
+				LLMsgVarSlot slot;
 
 				// what type of variable?
 				if (mvci.getType() == MVT_VARIABLE)
@@ -662,38 +747,42 @@ BOOL LLTemplateMessageReader::decodeData(const U8* buffer, const LLHost& sender
 					}
 					decode_pos += data_size;
 
-					cur_data_block->addData(mvci.getName(), &buffer[decode_pos], tsize, mvci.getType());
+					// the data is read in place, so never point past the packet
+					if (tsize && (decode_pos + (S64)tsize) > mReceiveSize)
+					{
+						logRanOffEndOfPacket(sender, decode_pos, (S32)tsize);
+						tsize = (U32)llmax(0, mReceiveSize - decode_pos);
+					}
+
+					slot.mOffset = decode_pos;
+					slot.mSize = (S32)tsize;
 					decode_pos += tsize;
 				}
 				else
 				{
 					// fixed!
-					// so, copy data pointer and set data size to fixed size
+					// so, record the offset and the fixed size
 					if ((decode_pos + mvci.getSize()) > mReceiveSize)
 					{
 						logRanOffEndOfPacket(sender, decode_pos, mvci.getSize());
 
 						// default to 0s.
-						U32 size = mvci.getSize();
-						std::vector<U8> data(size);
-						if (size) memset(&(data[0]), 0, size);
-						cur_data_block->addData(mvci.getName(), &(data[0]), 
-												size, mvci.getType());
+						slot.mOffset = -1;
 					}
 					else
 					{
-						cur_data_block->addData(mvci.getName(), 
-												&buffer[decode_pos], 
-												mvci.getSize(), 
-												mvci.getType());
+						slot.mOffset = decode_pos;
 					}
+					slot.mSize = mvci.getSize();
 					decode_pos += mvci.getSize();
 				}
+
+				mVarSlots.push_back(slot);
 			}
 		}
 	}
 
-	if (mCurrentRMessageData->mMemberBlocks.empty()
+	if (!total_blocks
 		&& !mCurrentRMessageTemplate->mMemberBlocks.empty())
 	{
 		lldebugs << "Empty message '" << mCurrentRMessageTemplate->mName << "' (no blocks)" << llendl;
@@ -804,9 +893,46 @@ bool LLTemplateMessageReader::isUdpBanned() const
 //virtual 
 void LLTemplateMessageReader::copyToBuilder(LLMessageBuilder& builder) const
 {
-	if(NULL == mCurrentRMessageTemplate)
+	if(NULL == mCurrentRMessageTemplate || NULL == mCurrentRLayout)
     {
         return;
     }
-	builder.copyFromMessageData(*mCurrentRMessageData);
+
+	// forwarding is rare, so only build the LLMsgData tree here
+	LLMsgData data(mCurrentRMessageTemplate->mName);
+	msg_block_layout_t::const_iterator layout_iter;
+	for (layout_iter = mCurrentRLayout->begin();
+		 layout_iter != mCurrentRLayout->end();
+		 ++layout_iter)
+	{
+		const LLMsgBlockLayout& layout = *layout_iter;
+		const LLMessageBlock* mbci = layout.mBlock;
+		for (S32 i = 0; i < layout.mNumInstances; i++)
+		{
+			// build new name to prevent collisions
+			LLMsgBlkData* cur_data_block = new LLMsgBlkData(mbci->mName, layout.mNumInstances);
+			cur_data_block->mName = mbci->mName + i;
+			data.addBlock(cur_data_block);
+
+			const LLMsgVarSlot* slot = &mVarSlots[layout.mFirstSlot + i * layout.mNumVariables];
+			for (LLMessageBlock::message_variable_map_t::const_iterator iter = 
+					 mbci->mMemberVariables.begin();
+				 iter != mbci->mMemberVariables.end(); ++iter, ++slot)
+			{
+				const LLMessageVariable& mvci = **iter;
+				cur_data_block->addVariable(mvci.getName(), mvci.getType());
+				if (slot->mOffset < 0)
+				{
+					std::vector<U8> zeros(slot->mSize);
+					cur_data_block->addData(mvci.getName(), &zeros[0], slot->mSize, mvci.getType());
+				}
+				else
+				{
+					cur_data_block->addData(mvci.getName(), mCurrentRBuffer + slot->mOffset, 
+											slot->mSize, mvci.getType());
+				}
+			}
+		}
+	}
+	builder.copyFromMessageData(data);
 }
@@ -35,9 +35,11 @@
 #include "llmessagereader.h"
 
 #include <map>
+#include <vector>
 
+class LLMessageBlock;
+class LLMessageVariable;
 class LLMessageTemplate;
-class LLMsgData;
 
 class LLTemplateMessageReader : public LLMessageReader
 {
@@ -96,6 +98,14 @@ public:
 	virtual S32	getSize(const char *blockname, S32 blocknum, 
 						const char *varname);
 
+	// Index based access for hot handlers.  Block and variable indices
+	// are their order in the template, see message_accessors.h, and
+	// skip the name lookups of the calls above.
+	void getDataIndex(S32 block, S32 var, void *datap, S32 size,
+					  S32 blocknum = 0, S32 max_size = S32_MAX);
+	S32 getNumberOfBlocksIndex(S32 block) const;
+	S32 getSizeIndex(S32 block, S32 var, S32 blocknum = 0) const;
+
 	virtual void clearMessage();
 
 	virtual const char* getMessageName() const;
@@ -105,6 +115,9 @@ public:
 
 	BOOL validateMessage(const U8* buffer, S32 buffer_size, 
 						 const LLHost& sender);
+
+	// The decoded message refers to buffer rather than copying out of
+	// it, so buffer must stay valid until clearMessage() is called.
 	BOOL readMessage(const U8* buffer, const LLHost& sender);
 
 	bool isTrusted() const;
@@ -113,8 +126,41 @@ public:
 	
 private:
 
+	// Decoding records where each variable lives in the receive buffer
+	// instead of building an LLMsgData tree.  The block layout of a
+	// template is built the first time it is decoded and reused for
+	// every later packet, so the steady-state path does no allocation
+	// and the getters copy straight out of the packet.
+	struct LLMsgVarSlot
+	{
+		S32						mOffset;		// into mCurrentRBuffer, -1 if past the packet end
+		S32						mSize;
+	};
+
+	struct LLMsgBlockLayout
+	{
+		const LLMessageBlock*	mBlock;
+		S32						mNumVariables;
+		S32						mNumInstances;	// repeat count in the current message
+		S32						mFirstSlot;		// slot of variable 0 in instance 0
+	};
+
+	typedef std::vector<LLMsgBlockLayout> msg_block_layout_t;
+	typedef std::map<const LLMessageTemplate*, msg_block_layout_t> msg_layout_map_t;
+
+	msg_block_layout_t& getBlockLayout(const LLMessageTemplate* msg_template);
+	const LLMsgBlockLayout* findBlockLayout(const char* blockname) const;
+	const LLMessageVariable* findVariable(const LLMsgBlockLayout& layout,
+										  const char* varname,
+										  S32* var_index) const;
+
 	void getData(const char *blockname, const char *varname, void *datap, 
 				 S32 size = 0, S32 blocknum = 0, S32 max_size = S32_MAX);
+	void copyData(const LLMsgBlockLayout& layout, S32 var_index,
+				  const LLMessageVariable* variable, void *datap,
+				  S32 size, S32 blocknum, S32 max_size);
+	const LLMsgBlockLayout* getBlockLayoutIndex(S32 block, S32 var,
+												S32 blocknum) const;
 
 	BOOL decodeTemplate(const U8* buffer, S32 buffer_size,  // inputs
 						LLMessageTemplate** msg_template ); // outputs
@@ -125,7 +171,10 @@ private:
 
 	S32	mReceiveSize;
 	LLMessageTemplate* mCurrentRMessageTemplate;
-	LLMsgData* mCurrentRMessageData;
+	const U8* mCurrentRBuffer;
+	msg_block_layout_t* mCurrentRLayout;
+	std::vector<LLMsgVarSlot> mVarSlots;
+	msg_layout_map_t mBlockLayouts;
 	message_template_number_map_t& mMessageNumbers;
 };
 
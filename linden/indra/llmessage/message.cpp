@@ -67,6 +67,7 @@
 #include "lltemplatemessagereader.h"
 #include "llmessagetemplate.h"
 #include "llmessagetemplateparser.h"
+#include "message_accessors.h"
 #include "llsd.h"
 #include "llsdmessagebuilder.h"
 #include "llsdmessagereader.h"
@@ -277,6 +278,7 @@ void LLMessageSystem::init()
 	mCurrentRecvPacketID = 0;
 
 	mMessageFileVersionNumber = 0.f;
+	mAccessorLayoutMatches = FALSE;
 
 	mTimingCallback = NULL;
 	mTimingCallbackData = NULL;
@@ -396,6 +398,7 @@ void LLMessageSystem::loadTemplateFile(const std::string& filename, bool failure
 	{
 		addTemplate(*iter);
 	}
+	mAccessorLayoutMatches = (getTemplateLayoutHash() == gMessageAccessorLayoutHash);
 }
 
 
@@ -1328,14 +1331,11 @@ S32 LLMessageSystem::sendMessage(const LLHost &host)
 		S32 append_ack_count = llmin(space_left, ack_count);
 		const S32 MAX_ACKS = 250;
 		append_ack_count = llmin(append_ack_count, MAX_ACKS);
-		std::vector<TPACKETID>::iterator iter = cdp->mAcks.begin();
-		std::vector<TPACKETID>::iterator last = cdp->mAcks.begin();
-		last += append_ack_count;
 		TPACKETID packet_id;
-		for( ; iter != last ; ++iter)
+		for(S32 i = 0; i < append_ack_count; ++i)
 		{
 			// grab the next packet id.
-			packet_id = (*iter);
+			packet_id = cdp->mAcks[i];
 			if(mVerboseLog)
 			{
 				acks.push_back(packet_id);
@@ -1365,7 +1365,7 @@ S32 LLMessageSystem::sendMessage(const LLHost &host)
 		}
 
 		// clean up the source
-		cdp->mAcks.erase(cdp->mAcks.begin(), last);
+		cdp->mAcks.pop(append_ack_count);
 
 		// tack the count in the final byte
 		U8 count = (U8)append_ack_count;
@@ -2487,6 +2487,127 @@ void dump_prehash_files()
 	}
 }
 
+// Writes the doc comment and license block that heads each generated file
+static void dump_generated_file_header(LLFILE* fp, const char* filename, const char* brief)
+{
+	fprintf(fp, "/** \n * @file %s\n * @brief %s\n *\n", filename, brief);
+	fprintf(
+		fp,
+		" * $LicenseInfo:firstyear=2009&license=viewergpl$\n"
+		" * \n"
+		" * Copyright (c) 2009, Linden Research, Inc.\n"
+		" * \n"
+		" * Second Life Viewer Source Code\n"
+		" * The source code in this file (\"Source Code\") is provided by Linden Lab\n"
+		" * to you under the terms of the GNU General Public License, version 2.0\n"
+		" * (\"GPL\"), unless you have obtained a separate licensing agreement\n"
+		" * (\"Other License\"), formally executed by you and Linden Lab.  Terms of\n"
+		" * the GPL can be found in doc/GPL-license.txt in this distribution, or\n"
+		" * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2\n"
+		" * \n"
+		" * There are special exceptions to the terms and conditions of the GPL as\n"
+		" * it is applied to this Source Code. View the full text of the exception\n"
+		" * in the file doc/FLOSS-exception.txt in this software distribution, or\n"
+		" * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception\n"
+		" * \n"
+		" * By copying, modifying or distributing this software, you acknowledge\n"
+		" * that you have read and understood your obligations described above,\n"
+		" * and agree to abide by those obligations.\n"
+		" * \n"
+		" * ALL LINDEN LAB SOURCE CODE IS PROVIDED \"AS IS.\" LINDEN LAB MAKES NO\n"
+		" * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,\n"
+		" * COMPLETENESS OR PERFORMANCE.\n"
+		" * $/LicenseInfo$\n"
+		" */\n");
+}
+
+void dump_message_accessor_files()
+{
+	// sort by name so the output is stable
+	std::map<std::string, const LLMessageTemplate*> sorted;
+	for (LLMessageSystem::message_template_name_map_t::const_iterator iter = gMessageSystem->mMessageTemplates.begin();
+		 iter != gMessageSystem->mMessageTemplates.end(); ++iter)
+	{
+		sorted[iter->second->mName] = iter->second;
+	}
+
+	std::string filename("../../indra/llmessage/message_accessors.h");
+	LLFILE* fp = LLFile::fopen(filename, "w");	/* Flawfinder: ignore */
+	if (fp)
+	{
+		dump_generated_file_header(fp, "message_accessors.h", "block and variable indices of every message template.");
+		fprintf(fp, "\n#ifndef LL_MESSAGE_ACCESSORS_H\n#define LL_MESSAGE_ACCESSORS_H\n\n");
+		fprintf(
+			fp,
+			"/**\n"
+			" * Generated from message template version number %.3f\n"
+			" */\n",
+			gMessageSystem->mMessageFileVersionNumber);
+		fprintf(fp, "\n\nextern U32 gMessageAccessorLayoutHash;\n\n");
+		fprintf(fp, "namespace LLMsgIndex\n{\n");
+		for (std::map<std::string, const LLMessageTemplate*>::const_iterator iter = sorted.begin();
+			 iter != sorted.end(); ++iter)
+		{
+			const LLMessageTemplate* templatep = iter->second;
+			if (templatep->mMemberBlocks.empty())
+			{
+				continue;
+			}
+			fprintf(fp, "\nnamespace %s\n{\n\tenum EBlock\n\t{\n", templatep->mName);
+			S32 block_index = 0;
+			bool has_variables = false;
+			LLMessageTemplate::message_block_map_t::const_iterator block_iter;
+			for (block_iter = templatep->mMemberBlocks.begin();
+				 block_iter != templatep->mMemberBlocks.end(); ++block_iter, ++block_index)
+			{
+				fprintf(fp, "\t\tBLOCK_%s = %d%s\n", (*block_iter)->mName, block_index,
+						(block_iter + 1 != templatep->mMemberBlocks.end()) ? "," : "");
+				has_variables |= !(*block_iter)->mMemberVariables.empty();
+			}
+			fprintf(fp, "\t};\n");
+			if (has_variables)
+			{
+				fprintf(fp, "\tenum EVariable\n\t{\n");
+				bool first = true;
+				for (block_iter = templatep->mMemberBlocks.begin();
+					 block_iter != templatep->mMemberBlocks.end(); ++block_iter)
+				{
+					const LLMessageBlock* blockp = *block_iter;
+					S32 var_index = 0;
+					for (LLMessageBlock::message_variable_map_t::const_iterator var_iter = blockp->mMemberVariables.begin();
+						 var_iter != blockp->mMemberVariables.end(); ++var_iter, ++var_index)
+					{
+						fprintf(fp, "%s\t\t%s_%s = %d", first ? "" : ",\n", blockp->mName,
+								(*var_iter)->getName(), var_index);
+						first = false;
+					}
+				}
+				fprintf(fp, "\n\t};\n");
+			}
+			fprintf(fp, "}\n");
+		}
+		fprintf(fp, "\n}\n\n#endif\n");
+		fclose(fp);
+	}
+	filename = std::string("../../indra/llmessage/message_accessors.cpp");
+	fp = LLFile::fopen(filename, "w");	/* Flawfinder: ignore */
+	if (fp)
+	{
+		dump_generated_file_header(fp, "message_accessors.cpp", "layout hash of the message template indices.");
+		fprintf(
+			fp,
+			"\n"
+			"/**\n"
+			" * Generated from message template version number %.3f\n"
+			" */\n",
+			gMessageSystem->mMessageFileVersionNumber);
+		fprintf(fp, "#include \"linden_common.h\"\n");
+		fprintf(fp, "#include \"message_accessors.h\"\n\n");
+		fprintf(fp, "\n\nU32 gMessageAccessorLayoutHash = 0x%08x;\n", gMessageSystem->getTemplateLayoutHash());
+		fclose(fp);
+	}
+}
+
 bool start_messaging_system(
 	const std::string& template_name,
 	U32 port,
@@ -2522,6 +2643,7 @@ bool start_messaging_system(
 	if (b_dump_prehash_file)
 	{
 		dump_prehash_files();
+		dump_message_accessor_files();
 		exit(0);
 	}
 	else
@@ -2535,6 +2657,12 @@ bool start_messaging_system(
 		{
 			LL_DEBUGS("AppInit") << "Message template version matches prehash version number" << llendl;
 		}
+
+		if (!gMessageSystem->hasAccessorLayout())
+		{
+			LL_WARNS("AppInit") << "Message template layout does not match message_accessors.h, handlers will read fields by name" << LL_ENDL;
+			LL_WARNS("AppInit") << "Run simulator with -prehash command line option to rebuild message accessors" << llendl;
+		}
 	}
 
 	gMessageSystem->setHandlerFuncFast(_PREHASH_StartPingCheck,			process_start_ping_check,		NULL);
@@ -2624,6 +2752,12 @@ void LLMessageSystem::summarizeLogs(std::ostream& str)
 	str << buffer << std::endl;
 	tmp_str = U64_to_str(savings/(mPacketsIn+1));
 	buffer = llformat( "Avg overall comp savings:  %20s (%5.2f : 1)", tmp_str.c_str(), ((F32) mTotalBytesIn + (F32) savings)/((F32) mTotalBytesIn + 1.f));
+	str << buffer << std::endl;
+	U64 receive_calls = mPacketRing.getReceiveCalls();
+	tmp_str = U64_to_str(receive_calls);
+	buffer = llformat( "Total receive calls:       %20s (%5.2f%% empty)", tmp_str.c_str(), 100.f * ((F32) mPacketRing.getEmptyReceiveCalls())/((F32) receive_calls + 1));
+	str << buffer << std::endl;
+	buffer = llformat( "Packets per receive call:  %20.2f", ((F32) mPacketRing.getReceivedPackets())/((F32) (receive_calls - mPacketRing.getEmptyReceiveCalls()) + 1.f));
 
 	// Outgoing
 	str << buffer << std::endl << std::endl << "Outgoing:" << std::endl;
@@ -3956,6 +4090,291 @@ void LLMessageSystem::getString(const char *block, const char *var,
 				  blocknum);
 }
 
+void LLMessageSystem::getIndexNames(S32 block, S32 var, 
+									const char*& blockname, const char*& varname) const
+{
+	blockname = NULL;
+	varname = NULL;
+
+	char* namep = LLMessageStringTable::getInstance()->getString(mMessageReader->getMessageName());
+	message_template_name_map_t::const_iterator iter = mMessageTemplates.find(namep);
+	if (iter == mMessageTemplates.end())
+	{
+		LL_ERRS("Messaging") << "No template for message " << namep << llendl;
+		return;
+	}
+
+	const LLMessageTemplate* templatep = iter->second;
+	if (block < 0 || block >= (S32)templatep->mMemberBlocks.size())
+	{
+		LL_ERRS("Messaging") << "Block index " << block << " not in message "
+			<< namep << llendl;
+		return;
+	}
+
+	const LLMessageBlock* blockp = *(templatep->mMemberBlocks.begin() + block);
+	blockname = blockp->mName;
+	if (var < 0)
+	{
+		return;
+	}
+	if (var >= (S32)blockp->mMemberVariables.size())
+	{
+		LL_ERRS("Messaging") << "Variable index " << var << " not in message "
+			<< namep << " block " << blockname << llendl;
+		return;
+	}
+	varname = (*(blockp->mMemberVariables.begin() + var))->getName();
+}
+
+void LLMessageSystem::getBinaryDataIndex(S32 block, S32 var, void *datap, 
+										 S32 size, S32 blocknum, S32 max_size)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, datap, size, blocknum, max_size);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getBinaryData(blockname, varname, datap, size, blocknum, max_size);
+}
+
+void LLMessageSystem::getBOOLIndex(S32 block, S32 var, BOOL &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		U8 value;
+		mTemplateMessageReader->getDataIndex(block, var, &value, sizeof(U8), blocknum);
+		d = (BOOL)value;
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getBOOL(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getU8Index(S32 block, S32 var, U8 &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &d, sizeof(U8), blocknum);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getU8(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getU16Index(S32 block, S32 var, U16 &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &d, sizeof(U16), blocknum);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getU16(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getS32Index(S32 block, S32 var, S32 &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &d, sizeof(S32), blocknum);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getS32(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getU32Index(S32 block, S32 var, U32 &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &d, sizeof(U32), blocknum);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getU32(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getU64Index(S32 block, S32 var, U64 &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &d, sizeof(U64), blocknum);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getU64(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getF32Index(S32 block, S32 var, F32 &d, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &d, sizeof(F32), blocknum);
+		if (!llfinite(d))
+		{
+			LL_WARNS("Messaging") << "non-finite in getF32Index " << block << " " << var << llendl;
+			d = 0;
+		}
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getF32(blockname, varname, d, blocknum);
+}
+
+void LLMessageSystem::getVector3Index(S32 block, S32 var, LLVector3 &v, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &v.mV[0], sizeof(v.mV), blocknum);
+		if (!v.isFinite())
+		{
+			LL_WARNS("Messaging") << "non-finite in getVector3Index " << block << " " << var << llendl;
+			v.zeroVec();
+		}
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getVector3(blockname, varname, v, blocknum);
+}
+
+void LLMessageSystem::getQuatIndex(S32 block, S32 var, LLQuaternion &q, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		LLVector3 vec;
+		mTemplateMessageReader->getDataIndex(block, var, &vec.mV[0], sizeof(vec.mV), blocknum);
+		if (vec.isFinite())
+		{
+			q.unpackFromVector3(vec);
+		}
+		else
+		{
+			LL_WARNS("Messaging") << "non-finite in getQuatIndex " << block << " " << var << llendl;
+			q.loadIdentity();
+		}
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getQuat(blockname, varname, q, blocknum);
+}
+
+void LLMessageSystem::getUUIDIndex(S32 block, S32 var, LLUUID &u, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		mTemplateMessageReader->getDataIndex(block, var, &u.mData[0], sizeof(u.mData), blocknum);
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getUUID(blockname, varname, u, blocknum);
+}
+
+void LLMessageSystem::getStringIndex(S32 block, S32 var, std::string& outstr, S32 blocknum)
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		char s[MTUBYTES];
+		s[0] = '\0';
+		mTemplateMessageReader->getDataIndex(block, var, s, 0, blocknum, MTUBYTES);
+		s[MTUBYTES - 1] = '\0';
+		outstr = s;
+		return;
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	mMessageReader->getString(blockname, varname, outstr, blocknum);
+}
+
+S32 LLMessageSystem::getNumberOfBlocksIndex(S32 block) const
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		return mTemplateMessageReader->getNumberOfBlocksIndex(block);
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, -1, blockname, varname);
+	return mMessageReader->getNumberOfBlocks(blockname);
+}
+
+S32 LLMessageSystem::getSizeIndex(S32 block, S32 var, S32 blocknum) const
+{
+	if (mMessageReader == mTemplateMessageReader)
+	{
+		return mTemplateMessageReader->getSizeIndex(block, var, blocknum);
+	}
+	const char* blockname;
+	const char* varname;
+	getIndexNames(block, var, blockname, varname);
+	return mMessageReader->getSize(blockname, blocknum, varname);
+}
+
+static void hash_layout_name(U32& hash, char tag, const char* name)
+{
+	// FNV-1a, the tag keeps message, block and variable names apart
+	hash = (hash ^ (U8)tag) * 16777619U;
+	for (const char* c = name; *c; ++c)
+	{
+		hash = (hash ^ (U8)*c) * 16777619U;
+	}
+}
+
+U32 LLMessageSystem::getTemplateLayoutHash() const
+{
+	// sort by name, the template map is keyed by string table pointer
+	std::map<std::string, const LLMessageTemplate*> sorted;
+	for (message_template_name_map_t::const_iterator iter = mMessageTemplates.begin();
+		 iter != mMessageTemplates.end(); ++iter)
+	{
+		sorted[iter->second->mName] = iter->second;
+	}
+
+	U32 hash = 2166136261U;
+	for (std::map<std::string, const LLMessageTemplate*>::const_iterator iter = sorted.begin();
+		 iter != sorted.end(); ++iter)
+	{
+		const LLMessageTemplate* templatep = iter->second;
+		hash_layout_name(hash, 'm', templatep->mName);
+		for (LLMessageTemplate::message_block_map_t::const_iterator block_iter = templatep->mMemberBlocks.begin();
+			 block_iter != templatep->mMemberBlocks.end(); ++block_iter)
+		{
+			const LLMessageBlock* blockp = *block_iter;
+			hash_layout_name(hash, 'b', blockp->mName);
+			for (LLMessageBlock::message_variable_map_t::const_iterator var_iter = blockp->mMemberVariables.begin();
+				 var_iter != blockp->mMemberVariables.end(); ++var_iter)
+			{
+				hash_layout_name(hash, 'v', (*var_iter)->getName());
+			}
+		}
+	}
+	return hash;
+}
+
 BOOL	LLMessageSystem::has(const char *blockname) const
 {
 	return getNumberOfBlocks(blockname) > 0;
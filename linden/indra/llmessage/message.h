@@ -219,6 +219,7 @@ class LLMessageSystem
 	BOOL mVerboseLog;
 
 	F32                                     mMessageFileVersionNumber;
+	BOOL                                    mAccessorLayoutMatches;
 
 	typedef std::map<const char *, LLMessageTemplate*> message_template_name_map_t;
 	typedef std::map<U32, LLMessageTemplate*> message_template_number_map_t;
@@ -519,6 +520,31 @@ public:
 	void getStringFast(	const char *block, const char *var, std::string& outstr, S32 blocknum = 0);
 	void	getString(	const char *block, const char *var, std::string& outstr, S32 blocknum = 0);
 
+	// Index based getters for the hottest handlers.  block and var are
+	// the constants from message_accessors.h for the message being
+	// handled, which skips the block and variable name lookups.
+	void	getBinaryDataIndex(S32 block, S32 var, void *datap, S32 size, S32 blocknum = 0, S32 max_size = S32_MAX);
+	void	getBOOLIndex(	S32 block, S32 var, BOOL &data, S32 blocknum = 0);
+	void	getU8Index(		S32 block, S32 var, U8 &data, S32 blocknum = 0);
+	void	getU16Index(	S32 block, S32 var, U16 &data, S32 blocknum = 0);
+	void	getS32Index(	S32 block, S32 var, S32 &data, S32 blocknum = 0);
+	void	getU32Index(	S32 block, S32 var, U32 &data, S32 blocknum = 0);
+	void	getU64Index(	S32 block, S32 var, U64 &data, S32 blocknum = 0);
+	void	getF32Index(	S32 block, S32 var, F32 &data, S32 blocknum = 0);
+	void	getVector3Index(S32 block, S32 var, LLVector3 &vec, S32 blocknum = 0);
+	void	getQuatIndex(	S32 block, S32 var, LLQuaternion &q, S32 blocknum = 0);
+	void	getUUIDIndex(	S32 block, S32 var, LLUUID &uuid, S32 blocknum = 0);
+	void	getStringIndex(	S32 block, S32 var, std::string& outstr, S32 blocknum = 0);
+	S32		getNumberOfBlocksIndex(S32 block) const;
+	S32		getSizeIndex(S32 block, S32 var, S32 blocknum = 0) const;
+
+	// Hash of the block and variable order of every template, compared
+	// against the one message_accessors.h was generated from.
+	U32		getTemplateLayoutHash() const;
+	// FALSE when the loaded template doesn't match message_accessors.h.
+	// Handlers must then read by name, the indices point at other fields.
+	BOOL	hasAccessorLayout() const { return mAccessorLayoutMatches; }
+
 
 	// Utility functions to generate a replay-resistant digest check
 	// against the shared secret. The window specifies how much of a
@@ -574,6 +600,10 @@ private:
 	// related to sendDenyTrustedCircuit()
 	void	reallySendDenyTrustedCircuit(const LLHost &host);
 
+	// Canonical names behind an index for readers that can't take
+	// indices, such as messages dispatched from LLSD.
+	void	getIndexNames(S32 block, S32 var, const char*& blockname, const char*& varname) const;
+
 public:
 	// Use this to establish trust to and from a host.  This blocks
 	// until trust has been established, and probably should only be
@@ -627,6 +657,7 @@ public:
 
 	// friends
 	friend std::ostream&	operator<<(std::ostream& s, LLMessageSystem &msg);
+	friend void dump_message_accessor_files();
 
 	void setMaxMessageTime(const F32 seconds);	// Max time to process messages before warning and dumping (neg to disable)
 	void setMaxMessageCounts(const S32 num);	// Max number of messages before dumping (neg to disable)
@@ -0,0 +1,8341 @@
+/** 
+ * @file message_accessors.h
+ * @brief block and variable indices of every message template.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_MESSAGE_ACCESSORS_H
+#define LL_MESSAGE_ACCESSORS_H
+
+/**
+ * Generated from message template version number 2.000
+ */
+
+
+extern U32 gMessageAccessorLayoutHash;
+
+namespace LLMsgIndex
+{
+
+namespace AbortXfer
+{
+	enum EBlock
+	{
+		BLOCK_XferID = 0
+	};
+	enum EVariable
+	{
+		XferID_ID = 0,
+		XferID_Result = 1
+	};
+}
+
+namespace AcceptCallingCard
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionBlock = 1,
+		BLOCK_FolderData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		TransactionBlock_TransactionID = 0,
+		FolderData_FolderID = 0
+	};
+}
+
+namespace AcceptFriendship
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionBlock = 1,
+		BLOCK_FolderData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		TransactionBlock_TransactionID = 0,
+		FolderData_FolderID = 0
+	};
+}
+
+namespace ActivateGestures
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Flags = 2,
+		Data_ItemID = 0,
+		Data_AssetID = 1,
+		Data_GestureFlags = 2
+	};
+}
+
+namespace ActivateGroup
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2
+	};
+}
+
+namespace AddCircuitCode
+{
+	enum EBlock
+	{
+		BLOCK_CircuitCode = 0
+	};
+	enum EVariable
+	{
+		CircuitCode_Code = 0,
+		CircuitCode_SessionID = 1,
+		CircuitCode_AgentID = 2
+	};
+}
+
+namespace AgentAlertMessage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_AlertData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AlertData_Modal = 0,
+		AlertData_Message = 1
+	};
+}
+
+namespace AgentAnimation
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_AnimationList = 1,
+		BLOCK_PhysicalAvatarEventList = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AnimationList_AnimID = 0,
+		AnimationList_StartAnim = 1,
+		PhysicalAvatarEventList_TypeData = 0
+	};
+}
+
+namespace AgentCachedTexture
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_WearableData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_SerialNum = 2,
+		WearableData_ID = 0,
+		WearableData_TextureIndex = 1
+	};
+}
+
+namespace AgentCachedTextureResponse
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_WearableData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_SerialNum = 2,
+		WearableData_TextureID = 0,
+		WearableData_TextureIndex = 1,
+		WearableData_HostName = 2
+	};
+}
+
+namespace AgentDataUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_FirstName = 1,
+		AgentData_LastName = 2,
+		AgentData_GroupTitle = 3,
+		AgentData_ActiveGroupID = 4,
+		AgentData_GroupPowers = 5,
+		AgentData_GroupName = 6
+	};
+}
+
+namespace AgentDataUpdateRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace AgentDropGroup
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1
+	};
+}
+
+namespace AgentFOV
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FOVBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_CircuitCode = 2,
+		FOVBlock_GenCounter = 0,
+		FOVBlock_VerticalAngle = 1
+	};
+}
+
+namespace AgentGroupDataUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		GroupData_GroupPowers = 1,
+		GroupData_AcceptNotices = 2,
+		GroupData_GroupInsigniaID = 3,
+		GroupData_Contribution = 4,
+		GroupData_GroupName = 5
+	};
+}
+
+namespace AgentHeightWidth
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_HeightWidthBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_CircuitCode = 2,
+		HeightWidthBlock_GenCounter = 0,
+		HeightWidthBlock_Height = 1,
+		HeightWidthBlock_Width = 2
+	};
+}
+
+namespace AgentIsNowWearing
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_WearableData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		WearableData_ItemID = 0,
+		WearableData_WearableType = 1
+	};
+}
+
+namespace AgentMovementComplete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1,
+		BLOCK_SimData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_Position = 0,
+		Data_LookAt = 1,
+		Data_RegionHandle = 2,
+		Data_Timestamp = 3,
+		SimData_ChannelVersion = 0
+	};
+}
+
+namespace AgentPause
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_SerialNum = 2
+	};
+}
+
+namespace AgentQuitCopy
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FuseBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		FuseBlock_ViewerCircuitCode = 0
+	};
+}
+
+namespace AgentRequestSit
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TargetObject = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		TargetObject_TargetID = 0,
+		TargetObject_Offset = 1
+	};
+}
+
+namespace AgentResume
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_SerialNum = 2
+	};
+}
+
+namespace AgentSetAppearance
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_WearableData = 1,
+		BLOCK_ObjectData = 2,
+		BLOCK_VisualParam = 3
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_SerialNum = 2,
+		AgentData_Size = 3,
+		WearableData_CacheID = 0,
+		WearableData_TextureIndex = 1,
+		ObjectData_TextureEntry = 0,
+		VisualParam_ParamValue = 0
+	};
+}
+
+namespace AgentSit
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace AgentThrottle
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Throttle = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_CircuitCode = 2,
+		Throttle_GenCounter = 0,
+		Throttle_Throttles = 1
+	};
+}
+
+namespace AgentUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_BodyRotation = 2,
+		AgentData_HeadRotation = 3,
+		AgentData_State = 4,
+		AgentData_CameraCenter = 5,
+		AgentData_CameraAtAxis = 6,
+		AgentData_CameraLeftAxis = 7,
+		AgentData_CameraUpAxis = 8,
+		AgentData_Far = 9,
+		AgentData_ControlFlags = 10,
+		AgentData_Flags = 11
+	};
+}
+
+namespace AgentWearablesRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace AgentWearablesUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_WearableData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_SerialNum = 2,
+		WearableData_ItemID = 0,
+		WearableData_AssetID = 1,
+		WearableData_WearableType = 2
+	};
+}
+
+namespace AlertMessage
+{
+	enum EBlock
+	{
+		BLOCK_AlertData = 0
+	};
+	enum EVariable
+	{
+		AlertData_Message = 0
+	};
+}
+
+namespace AssetUploadComplete
+{
+	enum EBlock
+	{
+		BLOCK_AssetBlock = 0
+	};
+	enum EVariable
+	{
+		AssetBlock_UUID = 0,
+		AssetBlock_Type = 1,
+		AssetBlock_Success = 2
+	};
+}
+
+namespace AssetUploadRequest
+{
+	enum EBlock
+	{
+		BLOCK_AssetBlock = 0
+	};
+	enum EVariable
+	{
+		AssetBlock_TransactionID = 0,
+		AssetBlock_Type = 1,
+		AssetBlock_Tempfile = 2,
+		AssetBlock_StoreLocal = 3,
+		AssetBlock_AssetData = 4
+	};
+}
+
+namespace AtomicPassObject
+{
+	enum EBlock
+	{
+		BLOCK_TaskData = 0
+	};
+	enum EVariable
+	{
+		TaskData_TaskID = 0,
+		TaskData_AttachmentNeedsSave = 1
+	};
+}
+
+namespace AttachedSound
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_SoundID = 0,
+		DataBlock_ObjectID = 1,
+		DataBlock_OwnerID = 2,
+		DataBlock_Gain = 3,
+		DataBlock_Flags = 4
+	};
+}
+
+namespace AttachedSoundGainChange
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_ObjectID = 0,
+		DataBlock_Gain = 1
+	};
+}
+
+namespace AvatarAnimation
+{
+	enum EBlock
+	{
+		BLOCK_Sender = 0,
+		BLOCK_AnimationList = 1,
+		BLOCK_AnimationSourceList = 2,
+		BLOCK_PhysicalAvatarEventList = 3
+	};
+	enum EVariable
+	{
+		Sender_ID = 0,
+		AnimationList_AnimID = 0,
+		AnimationList_AnimSequenceID = 1,
+		AnimationSourceList_ObjectID = 0,
+		PhysicalAvatarEventList_TypeData = 0
+	};
+}
+
+namespace AvatarAppearance
+{
+	enum EBlock
+	{
+		BLOCK_Sender = 0,
+		BLOCK_ObjectData = 1,
+		BLOCK_VisualParam = 2
+	};
+	enum EVariable
+	{
+		Sender_ID = 0,
+		Sender_IsTrial = 1,
+		ObjectData_TextureEntry = 0,
+		VisualParam_ParamValue = 0
+	};
+}
+
+namespace AvatarClassifiedReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_TargetID = 1,
+		Data_ClassifiedID = 0,
+		Data_Name = 1
+	};
+}
+
+namespace AvatarGroupsReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_NewGroupData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_AvatarID = 1,
+		GroupData_GroupPowers = 0,
+		GroupData_AcceptNotices = 1,
+		GroupData_GroupTitle = 2,
+		GroupData_GroupID = 3,
+		GroupData_GroupName = 4,
+		GroupData_GroupInsigniaID = 5,
+		NewGroupData_ListInProfile = 0
+	};
+}
+
+namespace AvatarInterestsReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_PropertiesData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_AvatarID = 1,
+		PropertiesData_WantToMask = 0,
+		PropertiesData_WantToText = 1,
+		PropertiesData_SkillsMask = 2,
+		PropertiesData_SkillsText = 3,
+		PropertiesData_LanguagesText = 4
+	};
+}
+
+namespace AvatarInterestsUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_PropertiesData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		PropertiesData_WantToMask = 0,
+		PropertiesData_WantToText = 1,
+		PropertiesData_SkillsMask = 2,
+		PropertiesData_SkillsText = 3,
+		PropertiesData_LanguagesText = 4
+	};
+}
+
+namespace AvatarNotesReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Data_TargetID = 0,
+		Data_Notes = 1
+	};
+}
+
+namespace AvatarNotesUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_TargetID = 0,
+		Data_Notes = 1
+	};
+}
+
+namespace AvatarPickerReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_QueryID = 1,
+		Data_AvatarID = 0,
+		Data_FirstName = 1,
+		Data_LastName = 2
+	};
+}
+
+namespace AvatarPickerRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_QueryID = 2,
+		Data_Name = 0
+	};
+}
+
+namespace AvatarPickerRequestBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_QueryID = 2,
+		AgentData_GodLevel = 3,
+		Data_Name = 0
+	};
+}
+
+namespace AvatarPicksReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_TargetID = 1,
+		Data_PickID = 0,
+		Data_PickName = 1
+	};
+}
+
+namespace AvatarPropertiesReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_PropertiesData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_AvatarID = 1,
+		PropertiesData_ImageID = 0,
+		PropertiesData_FLImageID = 1,
+		PropertiesData_PartnerID = 2,
+		PropertiesData_AboutText = 3,
+		PropertiesData_FLAboutText = 4,
+		PropertiesData_BornOn = 5,
+		PropertiesData_ProfileURL = 6,
+		PropertiesData_CharterMember = 7,
+		PropertiesData_Flags = 8
+	};
+}
+
+namespace AvatarPropertiesRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_AvatarID = 2
+	};
+}
+
+namespace AvatarPropertiesRequestBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_AvatarID = 1,
+		AgentData_GodLevel = 2,
+		AgentData_WebProfilesDisabled = 3
+	};
+}
+
+namespace AvatarPropertiesUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_PropertiesData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		PropertiesData_ImageID = 0,
+		PropertiesData_FLImageID = 1,
+		PropertiesData_AboutText = 2,
+		PropertiesData_FLAboutText = 3,
+		PropertiesData_AllowPublish = 4,
+		PropertiesData_MaturePublish = 5,
+		PropertiesData_ProfileURL = 6
+	};
+}
+
+namespace AvatarSitResponse
+{
+	enum EBlock
+	{
+		BLOCK_SitObject = 0,
+		BLOCK_SitTransform = 1
+	};
+	enum EVariable
+	{
+		SitObject_ID = 0,
+		SitTransform_AutoPilot = 0,
+		SitTransform_SitPosition = 1,
+		SitTransform_SitRotation = 2,
+		SitTransform_CameraEyeOffset = 3,
+		SitTransform_CameraAtOffset = 4,
+		SitTransform_ForceMouselook = 5
+	};
+}
+
+namespace AvatarTextureUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_WearableData = 1,
+		BLOCK_TextureData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_TexturesChanged = 1,
+		WearableData_CacheID = 0,
+		WearableData_TextureIndex = 1,
+		WearableData_HostName = 2,
+		TextureData_TextureID = 0
+	};
+}
+
+namespace BulkUpdateInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FolderData = 1,
+		BLOCK_ItemData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_TransactionID = 1,
+		FolderData_FolderID = 0,
+		FolderData_ParentID = 1,
+		FolderData_Type = 2,
+		FolderData_Name = 3,
+		ItemData_ItemID = 0,
+		ItemData_CallbackID = 1,
+		ItemData_FolderID = 2,
+		ItemData_CreatorID = 3,
+		ItemData_OwnerID = 4,
+		ItemData_GroupID = 5,
+		ItemData_BaseMask = 6,
+		ItemData_OwnerMask = 7,
+		ItemData_GroupMask = 8,
+		ItemData_EveryoneMask = 9,
+		ItemData_NextOwnerMask = 10,
+		ItemData_GroupOwned = 11,
+		ItemData_AssetID = 12,
+		ItemData_Type = 13,
+		ItemData_InvType = 14,
+		ItemData_Flags = 15,
+		ItemData_SaleType = 16,
+		ItemData_SalePrice = 17,
+		ItemData_Name = 18,
+		ItemData_Description = 19,
+		ItemData_CreationDate = 20,
+		ItemData_CRC = 21
+	};
+}
+
+namespace BuyObjectInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ObjectID = 0,
+		Data_ItemID = 1,
+		Data_FolderID = 2
+	};
+}
+
+namespace CameraConstraint
+{
+	enum EBlock
+	{
+		BLOCK_CameraCollidePlane = 0
+	};
+	enum EVariable
+	{
+		CameraCollidePlane_Plane = 0
+	};
+}
+
+namespace CancelAuction
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0
+	};
+}
+
+namespace ChangeInventoryItemFlags
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_ItemID = 0,
+		InventoryData_Flags = 1
+	};
+}
+
+namespace ChangeUserRights
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Rights = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Rights_AgentRelated = 0,
+		Rights_RelatedRights = 1
+	};
+}
+
+namespace ChatFromSimulator
+{
+	enum EBlock
+	{
+		BLOCK_ChatData = 0
+	};
+	enum EVariable
+	{
+		ChatData_FromName = 0,
+		ChatData_SourceID = 1,
+		ChatData_OwnerID = 2,
+		ChatData_SourceType = 3,
+		ChatData_ChatType = 4,
+		ChatData_Audible = 5,
+		ChatData_Position = 6,
+		ChatData_Message = 7
+	};
+}
+
+namespace ChatFromViewer
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ChatData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ChatData_Message = 0,
+		ChatData_Type = 1,
+		ChatData_Channel = 2
+	};
+}
+
+namespace ChatPass
+{
+	enum EBlock
+	{
+		BLOCK_ChatData = 0
+	};
+	enum EVariable
+	{
+		ChatData_Channel = 0,
+		ChatData_Position = 1,
+		ChatData_ID = 2,
+		ChatData_OwnerID = 3,
+		ChatData_Name = 4,
+		ChatData_SourceType = 5,
+		ChatData_Type = 6,
+		ChatData_Radius = 7,
+		ChatData_SimAccess = 8,
+		ChatData_Message = 9
+	};
+}
+
+namespace CheckParcelAuctions
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0
+	};
+}
+
+namespace CheckParcelSales
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0
+	};
+}
+
+namespace ChildAgentAlive
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_RegionHandle = 0,
+		AgentData_ViewerCircuitCode = 1,
+		AgentData_AgentID = 2,
+		AgentData_SessionID = 3
+	};
+}
+
+namespace ChildAgentDying
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace ChildAgentPositionUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_RegionHandle = 0,
+		AgentData_ViewerCircuitCode = 1,
+		AgentData_AgentID = 2,
+		AgentData_SessionID = 3,
+		AgentData_AgentPos = 4,
+		AgentData_AgentVel = 5,
+		AgentData_Center = 6,
+		AgentData_Size = 7,
+		AgentData_AtAxis = 8,
+		AgentData_LeftAxis = 9,
+		AgentData_UpAxis = 10,
+		AgentData_ChangedGrid = 11
+	};
+}
+
+namespace ChildAgentUnknown
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace ChildAgentUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_AnimationData = 2,
+		BLOCK_GranterBlock = 3,
+		BLOCK_NVPairData = 4,
+		BLOCK_VisualParam = 5
+	};
+	enum EVariable
+	{
+		AgentData_RegionHandle = 0,
+		AgentData_ViewerCircuitCode = 1,
+		AgentData_AgentID = 2,
+		AgentData_SessionID = 3,
+		AgentData_AgentPos = 4,
+		AgentData_AgentVel = 5,
+		AgentData_Center = 6,
+		AgentData_Size = 7,
+		AgentData_AtAxis = 8,
+		AgentData_LeftAxis = 9,
+		AgentData_UpAxis = 10,
+		AgentData_ChangedGrid = 11,
+		AgentData_Far = 12,
+		AgentData_Aspect = 13,
+		AgentData_Throttles = 14,
+		AgentData_LocomotionState = 15,
+		AgentData_HeadRotation = 16,
+		AgentData_BodyRotation = 17,
+		AgentData_ControlFlags = 18,
+		AgentData_EnergyLevel = 19,
+		AgentData_GodLevel = 20,
+		AgentData_AlwaysRun = 21,
+		AgentData_PreyAgent = 22,
+		AgentData_AgentAccess = 23,
+		AgentData_AgentTextures = 24,
+		AgentData_ActiveGroupID = 25,
+		GroupData_GroupID = 0,
+		GroupData_GroupPowers = 1,
+		GroupData_AcceptNotices = 2,
+		AnimationData_Animation = 0,
+		AnimationData_ObjectID = 1,
+		GranterBlock_GranterID = 0,
+		NVPairData_NVPairs = 0,
+		VisualParam_ParamValue = 0
+	};
+}
+
+namespace ClassifiedDelete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ClassifiedID = 0
+	};
+}
+
+namespace ClassifiedGodDelete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ClassifiedID = 0,
+		Data_QueryID = 1
+	};
+}
+
+namespace ClassifiedInfoReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Data_ClassifiedID = 0,
+		Data_CreatorID = 1,
+		Data_CreationDate = 2,
+		Data_ExpirationDate = 3,
+		Data_Category = 4,
+		Data_Name = 5,
+		Data_Desc = 6,
+		Data_ParcelID = 7,
+		Data_ParentEstate = 8,
+		Data_SnapshotID = 9,
+		Data_SimName = 10,
+		Data_PosGlobal = 11,
+		Data_ParcelName = 12,
+		Data_ClassifiedFlags = 13,
+		Data_PriceForListing = 14
+	};
+}
+
+namespace ClassifiedInfoRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ClassifiedID = 0
+	};
+}
+
+namespace ClassifiedInfoUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ClassifiedID = 0,
+		Data_Category = 1,
+		Data_Name = 2,
+		Data_Desc = 3,
+		Data_ParcelID = 4,
+		Data_ParentEstate = 5,
+		Data_SnapshotID = 6,
+		Data_PosGlobal = 7,
+		Data_ClassifiedFlags = 8,
+		Data_PriceForListing = 9
+	};
+}
+
+namespace ClearFollowCamProperties
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0
+	};
+	enum EVariable
+	{
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace CoarseLocationUpdate
+{
+	enum EBlock
+	{
+		BLOCK_Location = 0,
+		BLOCK_Index = 1,
+		BLOCK_AgentData = 2
+	};
+	enum EVariable
+	{
+		Location_X = 0,
+		Location_Y = 1,
+		Location_Z = 2,
+		Index_You = 0,
+		Index_Prey = 1,
+		AgentData_AgentID = 0
+	};
+}
+
+namespace CompleteAgentMovement
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_CircuitCode = 2
+	};
+}
+
+namespace CompleteAuction
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0
+	};
+}
+
+namespace CompletePingCheck
+{
+	enum EBlock
+	{
+		BLOCK_PingID = 0
+	};
+	enum EVariable
+	{
+		PingID_PingID = 0
+	};
+}
+
+namespace ConfirmAuctionStart
+{
+	enum EBlock
+	{
+		BLOCK_AuctionData = 0
+	};
+	enum EVariable
+	{
+		AuctionData_ParcelID = 0,
+		AuctionData_AuctionID = 1
+	};
+}
+
+namespace ConfirmEnableSimulator
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace ConfirmXferPacket
+{
+	enum EBlock
+	{
+		BLOCK_XferID = 0
+	};
+	enum EVariable
+	{
+		XferID_ID = 0,
+		XferID_Packet = 1
+	};
+}
+
+namespace CopyInventoryFromNotecard
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_NotecardData = 1,
+		BLOCK_InventoryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		NotecardData_NotecardItemID = 0,
+		NotecardData_ObjectID = 1,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1
+	};
+}
+
+namespace CopyInventoryItem
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_CallbackID = 0,
+		InventoryData_OldAgentID = 1,
+		InventoryData_OldItemID = 2,
+		InventoryData_NewFolderID = 3,
+		InventoryData_NewName = 4
+	};
+}
+
+namespace CreateGroupReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ReplyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		ReplyData_GroupID = 0,
+		ReplyData_Success = 1,
+		ReplyData_Message = 2
+	};
+}
+
+namespace CreateGroupRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_Name = 0,
+		GroupData_Charter = 1,
+		GroupData_ShowInList = 2,
+		GroupData_InsigniaID = 3,
+		GroupData_MembershipFee = 4,
+		GroupData_OpenEnrollment = 5,
+		GroupData_AllowPublish = 6,
+		GroupData_MaturePublish = 7
+	};
+}
+
+namespace CreateInventoryFolder
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FolderData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		FolderData_FolderID = 0,
+		FolderData_ParentID = 1,
+		FolderData_Type = 2,
+		FolderData_Name = 3
+	};
+}
+
+namespace CreateInventoryItem
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryBlock_CallbackID = 0,
+		InventoryBlock_FolderID = 1,
+		InventoryBlock_TransactionID = 2,
+		InventoryBlock_NextOwnerMask = 3,
+		InventoryBlock_Type = 4,
+		InventoryBlock_InvType = 5,
+		InventoryBlock_WearableType = 6,
+		InventoryBlock_Name = 7,
+		InventoryBlock_Description = 8
+	};
+}
+
+namespace CreateLandmarkForEvent
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_EventData = 1,
+		BLOCK_InventoryBlock = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		EventData_EventID = 0,
+		InventoryBlock_FolderID = 0,
+		InventoryBlock_Name = 1
+	};
+}
+
+namespace CreateNewOutfitAttachments
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_HeaderData = 1,
+		BLOCK_ObjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		HeaderData_NewFolderID = 0,
+		ObjectData_OldItemID = 0,
+		ObjectData_OldFolderID = 1
+	};
+}
+
+namespace CreateTrustedCircuit
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_EndPointID = 0,
+		DataBlock_Digest = 1
+	};
+}
+
+namespace CrossedRegion
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RegionData = 1,
+		BLOCK_Info = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RegionData_SimIP = 0,
+		RegionData_SimPort = 1,
+		RegionData_RegionHandle = 2,
+		RegionData_SeedCapability = 3,
+		Info_Position = 0,
+		Info_LookAt = 1
+	};
+}
+
+namespace DataHomeLocationReply
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_RegionHandle = 1,
+		Info_Position = 2,
+		Info_LookAt = 3
+	};
+}
+
+namespace DataHomeLocationRequest
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_KickedFromEstateID = 1
+	};
+}
+
+namespace DataServerLogout
+{
+	enum EBlock
+	{
+		BLOCK_UserData = 0
+	};
+	enum EVariable
+	{
+		UserData_AgentID = 0,
+		UserData_ViewerIP = 1,
+		UserData_Disconnect = 2,
+		UserData_SessionID = 3
+	};
+}
+
+namespace DeRezAck
+{
+	enum EBlock
+	{
+		BLOCK_TransactionData = 0
+	};
+	enum EVariable
+	{
+		TransactionData_TransactionID = 0,
+		TransactionData_Success = 1
+	};
+}
+
+namespace DeRezObject
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_AgentBlock = 1,
+		BLOCK_ObjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentBlock_GroupID = 0,
+		AgentBlock_Destination = 1,
+		AgentBlock_DestinationID = 2,
+		AgentBlock_TransactionID = 3,
+		AgentBlock_PacketCount = 4,
+		AgentBlock_PacketNumber = 5,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace DeactivateGestures
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Flags = 2,
+		Data_ItemID = 0,
+		Data_GestureFlags = 1
+	};
+}
+
+namespace DeclineCallingCard
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		TransactionBlock_TransactionID = 0
+	};
+}
+
+namespace DeclineFriendship
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		TransactionBlock_TransactionID = 0
+	};
+}
+
+namespace DenyTrustedCircuit
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_EndPointID = 0
+	};
+}
+
+namespace DerezContainer
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_ObjectID = 0,
+		Data_Delete = 1
+	};
+}
+
+namespace DetachAttachmentIntoInv
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0
+	};
+	enum EVariable
+	{
+		ObjectData_AgentID = 0,
+		ObjectData_ItemID = 1
+	};
+}
+
+namespace DirClassifiedQuery
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_Category = 3,
+		QueryData_QueryStart = 4
+	};
+}
+
+namespace DirClassifiedQueryBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_Category = 3,
+		QueryData_EstateID = 4,
+		QueryData_Godlike = 5,
+		QueryData_QueryStart = 6
+	};
+}
+
+namespace DirClassifiedReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_ClassifiedID = 0,
+		QueryReplies_Name = 1,
+		QueryReplies_ClassifiedFlags = 2,
+		QueryReplies_CreationDate = 3,
+		QueryReplies_ExpirationDate = 4,
+		QueryReplies_PriceForListing = 5
+	};
+}
+
+namespace DirEventsReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_OwnerID = 0,
+		QueryReplies_Name = 1,
+		QueryReplies_EventID = 2,
+		QueryReplies_Date = 3,
+		QueryReplies_UnixTime = 4,
+		QueryReplies_EventFlags = 5
+	};
+}
+
+namespace DirFindQuery
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_QueryStart = 3
+	};
+}
+
+namespace DirFindQueryBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_QueryStart = 3,
+		QueryData_EstateID = 4,
+		QueryData_Godlike = 5
+	};
+}
+
+namespace DirGroupsReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_GroupID = 0,
+		QueryReplies_GroupName = 1,
+		QueryReplies_Members = 2,
+		QueryReplies_SearchOrder = 3
+	};
+}
+
+namespace DirLandQuery
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		QueryData_QueryID = 0,
+		QueryData_QueryFlags = 1,
+		QueryData_SearchType = 2,
+		QueryData_Price = 3,
+		QueryData_Area = 4,
+		QueryData_QueryStart = 5
+	};
+}
+
+namespace DirLandQueryBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryData_QueryFlags = 1,
+		QueryData_SearchType = 2,
+		QueryData_Price = 3,
+		QueryData_Area = 4,
+		QueryData_QueryStart = 5,
+		QueryData_EstateID = 6,
+		QueryData_Godlike = 7
+	};
+}
+
+namespace DirLandReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_ParcelID = 0,
+		QueryReplies_Name = 1,
+		QueryReplies_Auction = 2,
+		QueryReplies_ForSale = 3,
+		QueryReplies_SalePrice = 4,
+		QueryReplies_ActualArea = 5
+	};
+}
+
+namespace DirPeopleReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_AgentID = 0,
+		QueryReplies_FirstName = 1,
+		QueryReplies_LastName = 2,
+		QueryReplies_Group = 3,
+		QueryReplies_Online = 4,
+		QueryReplies_Reputation = 5
+	};
+}
+
+namespace DirPlacesQuery
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_Category = 3,
+		QueryData_SimName = 4,
+		QueryData_QueryStart = 5
+	};
+}
+
+namespace DirPlacesQueryBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_Category = 3,
+		QueryData_SimName = 4,
+		QueryData_EstateID = 5,
+		QueryData_Godlike = 6,
+		QueryData_QueryStart = 7
+	};
+}
+
+namespace DirPlacesReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_ParcelID = 0,
+		QueryReplies_Name = 1,
+		QueryReplies_ForSale = 2,
+		QueryReplies_Auction = 3,
+		QueryReplies_Dwell = 4
+	};
+}
+
+namespace DirPopularQuery
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		QueryData_QueryID = 0,
+		QueryData_QueryFlags = 1
+	};
+}
+
+namespace DirPopularQueryBackend
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryData_QueryFlags = 1,
+		QueryData_EstateID = 2,
+		QueryData_Godlike = 3
+	};
+}
+
+namespace DirPopularReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_QueryData = 1,
+		BLOCK_QueryReplies = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		QueryData_QueryID = 0,
+		QueryReplies_ParcelID = 0,
+		QueryReplies_Name = 1,
+		QueryReplies_Dwell = 2
+	};
+}
+
+namespace EconomyData
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_ObjectCapacity = 0,
+		Info_ObjectCount = 1,
+		Info_PriceEnergyUnit = 2,
+		Info_PriceObjectClaim = 3,
+		Info_PricePublicObjectDecay = 4,
+		Info_PricePublicObjectDelete = 5,
+		Info_PriceParcelClaim = 6,
+		Info_PriceParcelClaimFactor = 7,
+		Info_PriceUpload = 8,
+		Info_PriceRentLight = 9,
+		Info_TeleportMinPrice = 10,
+		Info_TeleportPriceExponent = 11,
+		Info_EnergyEfficiency = 12,
+		Info_PriceObjectRent = 13,
+		Info_PriceObjectScaleFactor = 14,
+		Info_PriceParcelRent = 15,
+		Info_PriceGroupCreate = 16
+	};
+}
+
+namespace EdgeDataPacket
+{
+	enum EBlock
+	{
+		BLOCK_EdgeData = 0
+	};
+	enum EVariable
+	{
+		EdgeData_LayerType = 0,
+		EdgeData_Direction = 1,
+		EdgeData_LayerData = 2
+	};
+}
+
+namespace EjectGroupMemberReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_EjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		EjectData_Success = 0
+	};
+}
+
+namespace EjectGroupMemberRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_EjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		EjectData_EjecteeID = 0
+	};
+}
+
+namespace EjectUser
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_TargetID = 0,
+		Data_Flags = 1
+	};
+}
+
+namespace EmailMessageReply
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_ObjectID = 0,
+		DataBlock_More = 1,
+		DataBlock_Time = 2,
+		DataBlock_FromAddress = 3,
+		DataBlock_Subject = 4,
+		DataBlock_Data = 5,
+		DataBlock_MailFilter = 6
+	};
+}
+
+namespace EmailMessageRequest
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_ObjectID = 0,
+		DataBlock_FromAddress = 1,
+		DataBlock_Subject = 2
+	};
+}
+
+namespace EnableSimulator
+{
+	enum EBlock
+	{
+		BLOCK_SimulatorInfo = 0
+	};
+	enum EVariable
+	{
+		SimulatorInfo_Handle = 0,
+		SimulatorInfo_IP = 1,
+		SimulatorInfo_Port = 2
+	};
+}
+
+namespace Error
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Data_Code = 0,
+		Data_Token = 1,
+		Data_ID = 2,
+		Data_System = 3,
+		Data_Message = 4,
+		Data_Data = 5
+	};
+}
+
+namespace EstateCovenantReply
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_CovenantID = 0,
+		Data_CovenantTimestamp = 1,
+		Data_EstateName = 2,
+		Data_EstateOwnerID = 3
+	};
+}
+
+namespace EstateCovenantRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace EstateOwnerMessage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MethodData = 1,
+		BLOCK_ParamList = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_TransactionID = 2,
+		MethodData_Method = 0,
+		MethodData_Invoice = 1,
+		ParamList_Parameter = 0
+	};
+}
+
+namespace EventGodDelete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_EventData = 1,
+		BLOCK_QueryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		EventData_EventID = 0,
+		QueryData_QueryID = 0,
+		QueryData_QueryText = 1,
+		QueryData_QueryFlags = 2,
+		QueryData_QueryStart = 3
+	};
+}
+
+namespace EventInfoReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_EventData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		EventData_EventID = 0,
+		EventData_Creator = 1,
+		EventData_Name = 2,
+		EventData_Category = 3,
+		EventData_Desc = 4,
+		EventData_Date = 5,
+		EventData_DateUTC = 6,
+		EventData_Duration = 7,
+		EventData_Cover = 8,
+		EventData_Amount = 9,
+		EventData_SimName = 10,
+		EventData_GlobalPos = 11,
+		EventData_EventFlags = 12
+	};
+}
+
+namespace EventInfoRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_EventData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		EventData_EventID = 0
+	};
+}
+
+namespace EventLocationReply
+{
+	enum EBlock
+	{
+		BLOCK_QueryData = 0,
+		BLOCK_EventData = 1
+	};
+	enum EVariable
+	{
+		QueryData_QueryID = 0,
+		EventData_Success = 0,
+		EventData_RegionID = 1,
+		EventData_RegionPos = 2
+	};
+}
+
+namespace EventLocationRequest
+{
+	enum EBlock
+	{
+		BLOCK_QueryData = 0,
+		BLOCK_EventData = 1
+	};
+	enum EVariable
+	{
+		QueryData_QueryID = 0,
+		EventData_EventID = 0
+	};
+}
+
+namespace EventNotificationAddRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_EventData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		EventData_EventID = 0
+	};
+}
+
+namespace EventNotificationRemoveRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_EventData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		EventData_EventID = 0
+	};
+}
+
+namespace FeatureDisabled
+{
+	enum EBlock
+	{
+		BLOCK_FailureInfo = 0
+	};
+	enum EVariable
+	{
+		FailureInfo_ErrorMessage = 0,
+		FailureInfo_AgentID = 1,
+		FailureInfo_TransactionID = 2
+	};
+}
+
+namespace FetchInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_OwnerID = 0,
+		InventoryData_ItemID = 1
+	};
+}
+
+namespace FetchInventoryDescendents
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_FolderID = 0,
+		InventoryData_OwnerID = 1,
+		InventoryData_SortOrder = 2,
+		InventoryData_FetchFolders = 3,
+		InventoryData_FetchItems = 4
+	};
+}
+
+namespace FetchInventoryReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_CreatorID = 2,
+		InventoryData_OwnerID = 3,
+		InventoryData_GroupID = 4,
+		InventoryData_BaseMask = 5,
+		InventoryData_OwnerMask = 6,
+		InventoryData_GroupMask = 7,
+		InventoryData_EveryoneMask = 8,
+		InventoryData_NextOwnerMask = 9,
+		InventoryData_GroupOwned = 10,
+		InventoryData_AssetID = 11,
+		InventoryData_Type = 12,
+		InventoryData_InvType = 13,
+		InventoryData_Flags = 14,
+		InventoryData_SaleType = 15,
+		InventoryData_SalePrice = 16,
+		InventoryData_Name = 17,
+		InventoryData_Description = 18,
+		InventoryData_CreationDate = 19,
+		InventoryData_CRC = 20
+	};
+}
+
+namespace FindAgent
+{
+	enum EBlock
+	{
+		BLOCK_AgentBlock = 0,
+		BLOCK_LocationBlock = 1
+	};
+	enum EVariable
+	{
+		AgentBlock_Hunter = 0,
+		AgentBlock_Prey = 1,
+		AgentBlock_SpaceIP = 2,
+		LocationBlock_GlobalX = 0,
+		LocationBlock_GlobalY = 1
+	};
+}
+
+namespace ForceObjectSelect
+{
+	enum EBlock
+	{
+		BLOCK_Header = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		Header_ResetList = 0,
+		Data_LocalID = 0
+	};
+}
+
+namespace ForceScriptControlRelease
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace FormFriendship
+{
+	enum EBlock
+	{
+		BLOCK_AgentBlock = 0
+	};
+	enum EVariable
+	{
+		AgentBlock_SourceID = 0,
+		AgentBlock_DestID = 1
+	};
+}
+
+namespace FreezeUser
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_TargetID = 0,
+		Data_Flags = 1
+	};
+}
+
+namespace GenericMessage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MethodData = 1,
+		BLOCK_ParamList = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_TransactionID = 2,
+		MethodData_Method = 0,
+		MethodData_Invoice = 1,
+		ParamList_Parameter = 0
+	};
+}
+
+namespace GetScriptRunning
+{
+	enum EBlock
+	{
+		BLOCK_Script = 0
+	};
+	enum EVariable
+	{
+		Script_ObjectID = 0,
+		Script_ItemID = 1
+	};
+}
+
+namespace GodKickUser
+{
+	enum EBlock
+	{
+		BLOCK_UserInfo = 0
+	};
+	enum EVariable
+	{
+		UserInfo_GodID = 0,
+		UserInfo_GodSessionID = 1,
+		UserInfo_AgentID = 2,
+		UserInfo_KickFlags = 3,
+		UserInfo_Reason = 4
+	};
+}
+
+namespace GodUpdateRegionInfo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RegionInfo = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RegionInfo_SimName = 0,
+		RegionInfo_EstateID = 1,
+		RegionInfo_ParentEstateID = 2,
+		RegionInfo_RegionFlags = 3,
+		RegionInfo_BillableFactor = 4,
+		RegionInfo_PricePerMeter = 5,
+		RegionInfo_RedirectGridX = 6,
+		RegionInfo_RedirectGridY = 7
+	};
+}
+
+namespace GodlikeMessage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MethodData = 1,
+		BLOCK_ParamList = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_TransactionID = 2,
+		MethodData_Method = 0,
+		MethodData_Invoice = 1,
+		ParamList_Parameter = 0
+	};
+}
+
+namespace GrantGodlikePowers
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GrantData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GrantData_GodLevel = 0,
+		GrantData_Token = 1
+	};
+}
+
+namespace GrantUserRights
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Rights = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Rights_AgentRelated = 0,
+		Rights_RelatedRights = 1
+	};
+}
+
+namespace GroupAccountDetailsReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1,
+		BLOCK_HistoryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		MoneyData_RequestID = 0,
+		MoneyData_IntervalDays = 1,
+		MoneyData_CurrentInterval = 2,
+		MoneyData_StartDate = 3,
+		HistoryData_Description = 0,
+		HistoryData_Amount = 1
+	};
+}
+
+namespace GroupAccountDetailsRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		MoneyData_RequestID = 0,
+		MoneyData_IntervalDays = 1,
+		MoneyData_CurrentInterval = 2
+	};
+}
+
+namespace GroupAccountSummaryReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		MoneyData_RequestID = 0,
+		MoneyData_IntervalDays = 1,
+		MoneyData_CurrentInterval = 2,
+		MoneyData_StartDate = 3,
+		MoneyData_Balance = 4,
+		MoneyData_TotalCredits = 5,
+		MoneyData_TotalDebits = 6,
+		MoneyData_ObjectTaxCurrent = 7,
+		MoneyData_LightTaxCurrent = 8,
+		MoneyData_LandTaxCurrent = 9,
+		MoneyData_GroupTaxCurrent = 10,
+		MoneyData_ParcelDirFeeCurrent = 11,
+		MoneyData_ObjectTaxEstimate = 12,
+		MoneyData_LightTaxEstimate = 13,
+		MoneyData_LandTaxEstimate = 14,
+		MoneyData_GroupTaxEstimate = 15,
+		MoneyData_ParcelDirFeeEstimate = 16,
+		MoneyData_NonExemptMembers = 17,
+		MoneyData_LastTaxDate = 18,
+		MoneyData_TaxDate = 19
+	};
+}
+
+namespace GroupAccountSummaryRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		MoneyData_RequestID = 0,
+		MoneyData_IntervalDays = 1,
+		MoneyData_CurrentInterval = 2
+	};
+}
+
+namespace GroupAccountTransactionsReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1,
+		BLOCK_HistoryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		MoneyData_RequestID = 0,
+		MoneyData_IntervalDays = 1,
+		MoneyData_CurrentInterval = 2,
+		MoneyData_StartDate = 3,
+		HistoryData_Time = 0,
+		HistoryData_User = 1,
+		HistoryData_Type = 2,
+		HistoryData_Item = 3,
+		HistoryData_Amount = 4
+	};
+}
+
+namespace GroupAccountTransactionsRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		MoneyData_RequestID = 0,
+		MoneyData_IntervalDays = 1,
+		MoneyData_CurrentInterval = 2
+	};
+}
+
+namespace GroupActiveProposalItemReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionData = 1,
+		BLOCK_ProposalData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		TransactionData_TransactionID = 0,
+		TransactionData_TotalNumItems = 1,
+		ProposalData_VoteID = 0,
+		ProposalData_VoteInitiator = 1,
+		ProposalData_TerseDateID = 2,
+		ProposalData_StartDateTime = 3,
+		ProposalData_EndDateTime = 4,
+		ProposalData_AlreadyVoted = 5,
+		ProposalData_VoteCast = 6,
+		ProposalData_Majority = 7,
+		ProposalData_Quorum = 8,
+		ProposalData_ProposalText = 9
+	};
+}
+
+namespace GroupActiveProposalsRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_TransactionData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		TransactionData_TransactionID = 0
+	};
+}
+
+namespace GroupDataUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentGroupData = 0
+	};
+	enum EVariable
+	{
+		AgentGroupData_AgentID = 0,
+		AgentGroupData_GroupID = 1,
+		AgentGroupData_AgentPowers = 2,
+		AgentGroupData_GroupTitle = 3
+	};
+}
+
+namespace GroupMembersReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_MemberData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		GroupData_RequestID = 1,
+		GroupData_MemberCount = 2,
+		MemberData_AgentID = 0,
+		MemberData_Contribution = 1,
+		MemberData_OnlineStatus = 2,
+		MemberData_AgentPowers = 3,
+		MemberData_Title = 4,
+		MemberData_IsOwner = 5
+	};
+}
+
+namespace GroupMembersRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		GroupData_RequestID = 1
+	};
+}
+
+namespace GroupNoticeAdd
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MessageBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		MessageBlock_ToGroupID = 0,
+		MessageBlock_ID = 1,
+		MessageBlock_Dialog = 2,
+		MessageBlock_FromAgentName = 3,
+		MessageBlock_Message = 4,
+		MessageBlock_BinaryBucket = 5
+	};
+}
+
+namespace GroupNoticeRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupNoticeID = 0
+	};
+}
+
+namespace GroupNoticesListReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		Data_NoticeID = 0,
+		Data_Timestamp = 1,
+		Data_FromName = 2,
+		Data_Subject = 3,
+		Data_HasAttachment = 4,
+		Data_AssetType = 5
+	};
+}
+
+namespace GroupNoticesListRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupID = 0
+	};
+}
+
+namespace GroupProfileReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		GroupData_Name = 1,
+		GroupData_Charter = 2,
+		GroupData_ShowInList = 3,
+		GroupData_MemberTitle = 4,
+		GroupData_PowersMask = 5,
+		GroupData_InsigniaID = 6,
+		GroupData_FounderID = 7,
+		GroupData_MembershipFee = 8,
+		GroupData_OpenEnrollment = 9,
+		GroupData_Money = 10,
+		GroupData_GroupMembershipCount = 11,
+		GroupData_GroupRolesCount = 12,
+		GroupData_AllowPublish = 13,
+		GroupData_MaturePublish = 14,
+		GroupData_OwnerRole = 15
+	};
+}
+
+namespace GroupProfileRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0
+	};
+}
+
+namespace GroupProposalBallot
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ProposalData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ProposalData_ProposalID = 0,
+		ProposalData_GroupID = 1,
+		ProposalData_VoteCast = 2
+	};
+}
+
+namespace GroupRoleChanges
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RoleChange = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		RoleChange_RoleID = 0,
+		RoleChange_MemberID = 1,
+		RoleChange_Change = 2
+	};
+}
+
+namespace GroupRoleDataReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_RoleData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		GroupData_RequestID = 1,
+		GroupData_RoleCount = 2,
+		RoleData_RoleID = 0,
+		RoleData_Name = 1,
+		RoleData_Title = 2,
+		RoleData_Description = 3,
+		RoleData_Powers = 4,
+		RoleData_Members = 5
+	};
+}
+
+namespace GroupRoleDataRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		GroupData_RequestID = 1
+	};
+}
+
+namespace GroupRoleMembersReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MemberData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		AgentData_RequestID = 2,
+		AgentData_TotalPairs = 3,
+		MemberData_RoleID = 0,
+		MemberData_MemberID = 1
+	};
+}
+
+namespace GroupRoleMembersRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		GroupData_RequestID = 1
+	};
+}
+
+namespace GroupRoleUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RoleData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		RoleData_RoleID = 0,
+		RoleData_Name = 1,
+		RoleData_Description = 2,
+		RoleData_Title = 3,
+		RoleData_Powers = 4,
+		RoleData_UpdateType = 5
+	};
+}
+
+namespace GroupTitleUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		AgentData_TitleRoleID = 3
+	};
+}
+
+namespace GroupTitlesReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		AgentData_RequestID = 2,
+		GroupData_Title = 0,
+		GroupData_RoleID = 1,
+		GroupData_Selected = 2
+	};
+}
+
+namespace GroupTitlesRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		AgentData_RequestID = 3
+	};
+}
+
+namespace GroupVoteHistoryItemReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionData = 1,
+		BLOCK_HistoryItemData = 2,
+		BLOCK_VoteItem = 3
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_GroupID = 1,
+		TransactionData_TransactionID = 0,
+		TransactionData_TotalNumItems = 1,
+		HistoryItemData_VoteID = 0,
+		HistoryItemData_TerseDateID = 1,
+		HistoryItemData_StartDateTime = 2,
+		HistoryItemData_EndDateTime = 3,
+		HistoryItemData_VoteInitiator = 4,
+		HistoryItemData_VoteType = 5,
+		HistoryItemData_VoteResult = 6,
+		HistoryItemData_Majority = 7,
+		HistoryItemData_Quorum = 8,
+		HistoryItemData_ProposalText = 9,
+		VoteItem_CandidateID = 0,
+		VoteItem_VoteCast = 1,
+		VoteItem_NumVotes = 2
+	};
+}
+
+namespace GroupVoteHistoryRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_TransactionData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		TransactionData_TransactionID = 0
+	};
+}
+
+namespace HealthMessage
+{
+	enum EBlock
+	{
+		BLOCK_HealthData = 0
+	};
+	enum EVariable
+	{
+		HealthData_Health = 0
+	};
+}
+
+namespace ImageData
+{
+	enum EBlock
+	{
+		BLOCK_ImageID = 0,
+		BLOCK_ImageData = 1
+	};
+	enum EVariable
+	{
+		ImageID_ID = 0,
+		ImageID_Codec = 1,
+		ImageID_Size = 2,
+		ImageID_Packets = 3,
+		ImageData_Data = 0
+	};
+}
+
+namespace ImageNotInDatabase
+{
+	enum EBlock
+	{
+		BLOCK_ImageID = 0
+	};
+	enum EVariable
+	{
+		ImageID_ID = 0
+	};
+}
+
+namespace ImagePacket
+{
+	enum EBlock
+	{
+		BLOCK_ImageID = 0,
+		BLOCK_ImageData = 1
+	};
+	enum EVariable
+	{
+		ImageID_ID = 0,
+		ImageID_Packet = 1,
+		ImageData_Data = 0
+	};
+}
+
+namespace ImprovedInstantMessage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MessageBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		MessageBlock_FromGroup = 0,
+		MessageBlock_ToAgentID = 1,
+		MessageBlock_ParentEstateID = 2,
+		MessageBlock_RegionID = 3,
+		MessageBlock_Position = 4,
+		MessageBlock_Offline = 5,
+		MessageBlock_Dialog = 6,
+		MessageBlock_ID = 7,
+		MessageBlock_Timestamp = 8,
+		MessageBlock_FromAgentName = 9,
+		MessageBlock_Message = 10,
+		MessageBlock_BinaryBucket = 11
+	};
+}
+
+namespace ImprovedTerseObjectUpdate
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0,
+		RegionData_TimeDilation = 1,
+		ObjectData_Data = 0,
+		ObjectData_TextureEntry = 1
+	};
+}
+
+namespace InitiateDownload
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FileData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		FileData_SimFilename = 0,
+		FileData_ViewerFilename = 1
+	};
+}
+
+namespace InternalScriptMail
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_From = 0,
+		DataBlock_To = 1,
+		DataBlock_Subject = 2,
+		DataBlock_Body = 3
+	};
+}
+
+namespace InventoryAssetResponse
+{
+	enum EBlock
+	{
+		BLOCK_QueryData = 0
+	};
+	enum EVariable
+	{
+		QueryData_QueryID = 0,
+		QueryData_AssetID = 1,
+		QueryData_IsReadable = 2
+	};
+}
+
+namespace InventoryDescendents
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FolderData = 1,
+		BLOCK_ItemData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_FolderID = 1,
+		AgentData_OwnerID = 2,
+		AgentData_Version = 3,
+		AgentData_Descendents = 4,
+		FolderData_FolderID = 0,
+		FolderData_ParentID = 1,
+		FolderData_Type = 2,
+		FolderData_Name = 3,
+		ItemData_ItemID = 0,
+		ItemData_FolderID = 1,
+		ItemData_CreatorID = 2,
+		ItemData_OwnerID = 3,
+		ItemData_GroupID = 4,
+		ItemData_BaseMask = 5,
+		ItemData_OwnerMask = 6,
+		ItemData_GroupMask = 7,
+		ItemData_EveryoneMask = 8,
+		ItemData_NextOwnerMask = 9,
+		ItemData_GroupOwned = 10,
+		ItemData_AssetID = 11,
+		ItemData_Type = 12,
+		ItemData_InvType = 13,
+		ItemData_Flags = 14,
+		ItemData_SaleType = 15,
+		ItemData_SalePrice = 16,
+		ItemData_Name = 17,
+		ItemData_Description = 18,
+		ItemData_CreationDate = 19,
+		ItemData_CRC = 20
+	};
+}
+
+namespace InviteGroupRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1,
+		BLOCK_InviteData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		InviteData_InviteeID = 0,
+		InviteData_RoleID = 1
+	};
+}
+
+namespace InviteGroupResponse
+{
+	enum EBlock
+	{
+		BLOCK_InviteData = 0
+	};
+	enum EVariable
+	{
+		InviteData_AgentID = 0,
+		InviteData_InviteeID = 1,
+		InviteData_GroupID = 2,
+		InviteData_RoleID = 3,
+		InviteData_MembershipFee = 4
+	};
+}
+
+namespace JoinGroupReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		GroupData_Success = 1
+	};
+}
+
+namespace JoinGroupRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0
+	};
+}
+
+namespace KickUser
+{
+	enum EBlock
+	{
+		BLOCK_TargetBlock = 0,
+		BLOCK_UserInfo = 1
+	};
+	enum EVariable
+	{
+		TargetBlock_TargetIP = 0,
+		TargetBlock_TargetPort = 1,
+		UserInfo_AgentID = 0,
+		UserInfo_SessionID = 1,
+		UserInfo_Reason = 2
+	};
+}
+
+namespace KickUserAck
+{
+	enum EBlock
+	{
+		BLOCK_UserInfo = 0
+	};
+	enum EVariable
+	{
+		UserInfo_SessionID = 0,
+		UserInfo_Flags = 1
+	};
+}
+
+namespace KillChildAgents
+{
+	enum EBlock
+	{
+		BLOCK_IDBlock = 0
+	};
+	enum EVariable
+	{
+		IDBlock_AgentID = 0
+	};
+}
+
+namespace KillObject
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0
+	};
+	enum EVariable
+	{
+		ObjectData_ID = 0
+	};
+}
+
+namespace LandStatReply
+{
+	enum EBlock
+	{
+		BLOCK_RequestData = 0,
+		BLOCK_ReportData = 1
+	};
+	enum EVariable
+	{
+		RequestData_ReportType = 0,
+		RequestData_RequestFlags = 1,
+		RequestData_TotalObjectCount = 2,
+		ReportData_TaskLocalID = 0,
+		ReportData_TaskID = 1,
+		ReportData_LocationX = 2,
+		ReportData_LocationY = 3,
+		ReportData_LocationZ = 4,
+		ReportData_Score = 5,
+		ReportData_TaskName = 6,
+		ReportData_OwnerName = 7
+	};
+}
+
+namespace LandStatRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RequestData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RequestData_ReportType = 0,
+		RequestData_RequestFlags = 1,
+		RequestData_Filter = 2,
+		RequestData_ParcelLocalID = 3
+	};
+}
+
+namespace LayerData
+{
+	enum EBlock
+	{
+		BLOCK_LayerID = 0,
+		BLOCK_LayerData = 1
+	};
+	enum EVariable
+	{
+		LayerID_Type = 0,
+		LayerData_Data = 0
+	};
+}
+
+namespace LeaveGroupReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		GroupData_GroupID = 0,
+		GroupData_Success = 1
+	};
+}
+
+namespace LeaveGroupRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0
+	};
+}
+
+namespace LiveHelpGroupReply
+{
+	enum EBlock
+	{
+		BLOCK_ReplyData = 0
+	};
+	enum EVariable
+	{
+		ReplyData_RequestID = 0,
+		ReplyData_GroupID = 1,
+		ReplyData_Selection = 2
+	};
+}
+
+namespace LiveHelpGroupRequest
+{
+	enum EBlock
+	{
+		BLOCK_RequestData = 0
+	};
+	enum EVariable
+	{
+		RequestData_RequestID = 0,
+		RequestData_AgentID = 1
+	};
+}
+
+namespace LoadURL
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_ObjectName = 0,
+		Data_ObjectID = 1,
+		Data_OwnerID = 2,
+		Data_OwnerIsGroup = 3,
+		Data_Message = 4,
+		Data_URL = 5
+	};
+}
+
+namespace LogDwellTime
+{
+	enum EBlock
+	{
+		BLOCK_DwellInfo = 0
+	};
+	enum EVariable
+	{
+		DwellInfo_AgentID = 0,
+		DwellInfo_SessionID = 1,
+		DwellInfo_Duration = 2,
+		DwellInfo_SimName = 3,
+		DwellInfo_RegionX = 4,
+		DwellInfo_RegionY = 5,
+		DwellInfo_AvgAgentsInView = 6,
+		DwellInfo_AvgViewerFPS = 7
+	};
+}
+
+namespace LogFailedMoneyTransaction
+{
+	enum EBlock
+	{
+		BLOCK_TransactionData = 0
+	};
+	enum EVariable
+	{
+		TransactionData_TransactionID = 0,
+		TransactionData_TransactionTime = 1,
+		TransactionData_TransactionType = 2,
+		TransactionData_SourceID = 3,
+		TransactionData_DestID = 4,
+		TransactionData_Flags = 5,
+		TransactionData_Amount = 6,
+		TransactionData_SimulatorIP = 7,
+		TransactionData_GridX = 8,
+		TransactionData_GridY = 9,
+		TransactionData_FailureType = 10
+	};
+}
+
+namespace LogParcelChanges
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RegionData = 1,
+		BLOCK_ParcelData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		RegionData_RegionHandle = 0,
+		ParcelData_ParcelID = 0,
+		ParcelData_OwnerID = 1,
+		ParcelData_IsOwnerGroup = 2,
+		ParcelData_ActualArea = 3,
+		ParcelData_Action = 4,
+		ParcelData_TransactionID = 5
+	};
+}
+
+namespace LogTextMessage
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_FromAgentId = 0,
+		DataBlock_ToAgentId = 1,
+		DataBlock_GlobalX = 2,
+		DataBlock_GlobalY = 3,
+		DataBlock_Time = 4,
+		DataBlock_Message = 5
+	};
+}
+
+namespace LogoutReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_ItemID = 0
+	};
+}
+
+namespace LogoutRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace MapBlockReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_Flags = 1,
+		Data_X = 0,
+		Data_Y = 1,
+		Data_Name = 2,
+		Data_Access = 3,
+		Data_RegionFlags = 4,
+		Data_WaterHeight = 5,
+		Data_Agents = 6,
+		Data_MapImageID = 7
+	};
+}
+
+namespace MapBlockRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_PositionData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Flags = 2,
+		AgentData_EstateID = 3,
+		AgentData_Godlike = 4,
+		PositionData_MinX = 0,
+		PositionData_MaxX = 1,
+		PositionData_MinY = 2,
+		PositionData_MaxY = 3
+	};
+}
+
+namespace MapItemReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RequestData = 1,
+		BLOCK_Data = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_Flags = 1,
+		RequestData_ItemType = 0,
+		Data_X = 0,
+		Data_Y = 1,
+		Data_ID = 2,
+		Data_Extra = 3,
+		Data_Extra2 = 4,
+		Data_Name = 5
+	};
+}
+
+namespace MapItemRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RequestData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Flags = 2,
+		AgentData_EstateID = 3,
+		AgentData_Godlike = 4,
+		RequestData_ItemType = 0,
+		RequestData_RegionHandle = 1
+	};
+}
+
+namespace MapLayerReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_LayerData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_Flags = 1,
+		LayerData_Left = 0,
+		LayerData_Right = 1,
+		LayerData_Top = 2,
+		LayerData_Bottom = 3,
+		LayerData_ImageID = 4
+	};
+}
+
+namespace MapLayerRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Flags = 2,
+		AgentData_EstateID = 3,
+		AgentData_Godlike = 4
+	};
+}
+
+namespace MapNameRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_NameData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Flags = 2,
+		AgentData_EstateID = 3,
+		AgentData_Godlike = 4,
+		NameData_Name = 0
+	};
+}
+
+namespace MeanCollisionAlert
+{
+	enum EBlock
+	{
+		BLOCK_MeanCollision = 0
+	};
+	enum EVariable
+	{
+		MeanCollision_Victim = 0,
+		MeanCollision_Perp = 1,
+		MeanCollision_Time = 2,
+		MeanCollision_Mag = 3,
+		MeanCollision_Type = 4
+	};
+}
+
+namespace MergeParcel
+{
+	enum EBlock
+	{
+		BLOCK_MasterParcelData = 0,
+		BLOCK_SlaveParcelData = 1
+	};
+	enum EVariable
+	{
+		MasterParcelData_MasterID = 0,
+		SlaveParcelData_SlaveID = 0
+	};
+}
+
+namespace ModifyLand
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ModifyBlock = 1,
+		BLOCK_ParcelData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ModifyBlock_Action = 0,
+		ModifyBlock_BrushSize = 1,
+		ModifyBlock_Seconds = 2,
+		ModifyBlock_Height = 3,
+		ParcelData_LocalID = 0,
+		ParcelData_West = 1,
+		ParcelData_South = 2,
+		ParcelData_East = 3,
+		ParcelData_North = 4
+	};
+}
+
+namespace MoneyBalanceReply
+{
+	enum EBlock
+	{
+		BLOCK_MoneyData = 0
+	};
+	enum EVariable
+	{
+		MoneyData_AgentID = 0,
+		MoneyData_TransactionID = 1,
+		MoneyData_TransactionSuccess = 2,
+		MoneyData_MoneyBalance = 3,
+		MoneyData_SquareMetersCredit = 4,
+		MoneyData_SquareMetersCommitted = 5,
+		MoneyData_Description = 6
+	};
+}
+
+namespace MoneyBalanceRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		MoneyData_TransactionID = 0
+	};
+}
+
+namespace MoneyTransferBackend
+{
+	enum EBlock
+	{
+		BLOCK_MoneyData = 0
+	};
+	enum EVariable
+	{
+		MoneyData_TransactionID = 0,
+		MoneyData_TransactionTime = 1,
+		MoneyData_SourceID = 2,
+		MoneyData_DestID = 3,
+		MoneyData_Flags = 4,
+		MoneyData_Amount = 5,
+		MoneyData_AggregatePermNextOwner = 6,
+		MoneyData_AggregatePermInventory = 7,
+		MoneyData_TransactionType = 8,
+		MoneyData_RegionID = 9,
+		MoneyData_GridX = 10,
+		MoneyData_GridY = 11,
+		MoneyData_Description = 12
+	};
+}
+
+namespace MoneyTransferRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		MoneyData_SourceID = 0,
+		MoneyData_DestID = 1,
+		MoneyData_Flags = 2,
+		MoneyData_Amount = 3,
+		MoneyData_AggregatePermNextOwner = 4,
+		MoneyData_AggregatePermInventory = 5,
+		MoneyData_TransactionType = 6,
+		MoneyData_Description = 7
+	};
+}
+
+namespace MoveInventoryFolder
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Stamp = 2,
+		InventoryData_FolderID = 0,
+		InventoryData_ParentID = 1
+	};
+}
+
+namespace MoveInventoryItem
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Stamp = 2,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_NewName = 2
+	};
+}
+
+namespace MoveTaskInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_FolderID = 2,
+		InventoryData_LocalID = 0,
+		InventoryData_ItemID = 1
+	};
+}
+
+namespace MultipleObjectUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_Type = 1,
+		ObjectData_Data = 2
+	};
+}
+
+namespace MuteListRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MuteData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		MuteData_MuteCRC = 0
+	};
+}
+
+namespace MuteListUpdate
+{
+	enum EBlock
+	{
+		BLOCK_MuteData = 0
+	};
+	enum EVariable
+	{
+		MuteData_AgentID = 0,
+		MuteData_Filename = 1
+	};
+}
+
+namespace NameValuePair
+{
+	enum EBlock
+	{
+		BLOCK_TaskData = 0,
+		BLOCK_NameValueData = 1
+	};
+	enum EVariable
+	{
+		TaskData_ID = 0,
+		NameValueData_NVPair = 0
+	};
+}
+
+namespace NearestLandingRegionReply
+{
+	enum EBlock
+	{
+		BLOCK_LandingRegionData = 0
+	};
+	enum EVariable
+	{
+		LandingRegionData_RegionHandle = 0
+	};
+}
+
+namespace NearestLandingRegionRequest
+{
+	enum EBlock
+	{
+		BLOCK_RequestingRegionData = 0
+	};
+	enum EVariable
+	{
+		RequestingRegionData_RegionHandle = 0
+	};
+}
+
+namespace NearestLandingRegionUpdated
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0
+	};
+}
+
+namespace NeighborList
+{
+	enum EBlock
+	{
+		BLOCK_NeighborBlock = 0
+	};
+	enum EVariable
+	{
+		NeighborBlock_IP = 0,
+		NeighborBlock_Port = 1,
+		NeighborBlock_PublicIP = 2,
+		NeighborBlock_PublicPort = 3,
+		NeighborBlock_RegionID = 4,
+		NeighborBlock_Name = 5,
+		NeighborBlock_SimAccess = 6
+	};
+}
+
+namespace NetTest
+{
+	enum EBlock
+	{
+		BLOCK_NetBlock = 0
+	};
+	enum EVariable
+	{
+		NetBlock_Port = 0
+	};
+}
+
+namespace ObjectAdd
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		ObjectData_PCode = 0,
+		ObjectData_Material = 1,
+		ObjectData_AddFlags = 2,
+		ObjectData_PathCurve = 3,
+		ObjectData_ProfileCurve = 4,
+		ObjectData_PathBegin = 5,
+		ObjectData_PathEnd = 6,
+		ObjectData_PathScaleX = 7,
+		ObjectData_PathScaleY = 8,
+		ObjectData_PathShearX = 9,
+		ObjectData_PathShearY = 10,
+		ObjectData_PathTwist = 11,
+		ObjectData_PathTwistBegin = 12,
+		ObjectData_PathRadiusOffset = 13,
+		ObjectData_PathTaperX = 14,
+		ObjectData_PathTaperY = 15,
+		ObjectData_PathRevolutions = 16,
+		ObjectData_PathSkew = 17,
+		ObjectData_ProfileBegin = 18,
+		ObjectData_ProfileEnd = 19,
+		ObjectData_ProfileHollow = 20,
+		ObjectData_BypassRaycast = 21,
+		ObjectData_RayStart = 22,
+		ObjectData_RayEnd = 23,
+		ObjectData_RayTargetID = 24,
+		ObjectData_RayEndIsIntersection = 25,
+		ObjectData_Scale = 26,
+		ObjectData_Rotation = 27,
+		ObjectData_State = 28
+	};
+}
+
+namespace ObjectAttach
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_AttachmentPoint = 2,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_Rotation = 1
+	};
+}
+
+namespace ObjectBuy
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		AgentData_CategoryID = 3,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_SaleType = 1,
+		ObjectData_SalePrice = 2
+	};
+}
+
+namespace ObjectCategory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_LocalID = 0,
+		ObjectData_Category = 1
+	};
+}
+
+namespace ObjectClickAction
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_ClickAction = 1
+	};
+}
+
+namespace ObjectDeGrab
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1,
+		BLOCK_SurfaceInfo = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_LocalID = 0,
+		SurfaceInfo_UVCoord = 0,
+		SurfaceInfo_STCoord = 1,
+		SurfaceInfo_FaceIndex = 2,
+		SurfaceInfo_Position = 3,
+		SurfaceInfo_Normal = 4,
+		SurfaceInfo_Binormal = 5
+	};
+}
+
+namespace ObjectDelete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_Force = 2,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectDelink
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectDescription
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_LocalID = 0,
+		ObjectData_Description = 1
+	};
+}
+
+namespace ObjectDeselect
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectDetach
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectDrop
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectDuplicate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_SharedData = 1,
+		BLOCK_ObjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		SharedData_Offset = 0,
+		SharedData_DuplicateFlags = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectDuplicateOnRay
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		AgentData_RayStart = 3,
+		AgentData_RayEnd = 4,
+		AgentData_BypassRaycast = 5,
+		AgentData_RayEndIsIntersection = 6,
+		AgentData_CopyCenters = 7,
+		AgentData_CopyRotates = 8,
+		AgentData_RayTargetID = 9,
+		AgentData_DuplicateFlags = 10,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectExportSelected
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_RequestID = 1,
+		AgentData_VolumeDetail = 2,
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace ObjectExtraParams
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_ParamType = 1,
+		ObjectData_ParamInUse = 2,
+		ObjectData_ParamSize = 3,
+		ObjectData_ParamData = 4
+	};
+}
+
+namespace ObjectFlagUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_ObjectLocalID = 2,
+		AgentData_UsePhysics = 3,
+		AgentData_IsTemporary = 4,
+		AgentData_IsPhantom = 5,
+		AgentData_CastsShadows = 6
+	};
+}
+
+namespace ObjectGrab
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1,
+		BLOCK_SurfaceInfo = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_LocalID = 0,
+		ObjectData_GrabOffset = 1,
+		SurfaceInfo_UVCoord = 0,
+		SurfaceInfo_STCoord = 1,
+		SurfaceInfo_FaceIndex = 2,
+		SurfaceInfo_Position = 3,
+		SurfaceInfo_Normal = 4,
+		SurfaceInfo_Binormal = 5
+	};
+}
+
+namespace ObjectGrabUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1,
+		BLOCK_SurfaceInfo = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectID = 0,
+		ObjectData_GrabOffsetInitial = 1,
+		ObjectData_GrabPosition = 2,
+		ObjectData_TimeSinceLast = 3,
+		SurfaceInfo_UVCoord = 0,
+		SurfaceInfo_STCoord = 1,
+		SurfaceInfo_FaceIndex = 2,
+		SurfaceInfo_Position = 3,
+		SurfaceInfo_Normal = 4,
+		SurfaceInfo_Binormal = 5
+	};
+}
+
+namespace ObjectGroup
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectImage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_MediaURL = 1,
+		ObjectData_TextureEntry = 2
+	};
+}
+
+namespace ObjectIncludeInSearch
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_IncludeInSearch = 1
+	};
+}
+
+namespace ObjectLink
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectMaterial
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_Material = 1
+	};
+}
+
+namespace ObjectName
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_LocalID = 0,
+		ObjectData_Name = 1
+	};
+}
+
+namespace ObjectOwner
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_HeaderData = 1,
+		BLOCK_ObjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		HeaderData_Override = 0,
+		HeaderData_OwnerID = 1,
+		HeaderData_GroupID = 2,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectPermissions
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_HeaderData = 1,
+		BLOCK_ObjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		HeaderData_Override = 0,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_Field = 1,
+		ObjectData_Set = 2,
+		ObjectData_Mask = 3
+	};
+}
+
+namespace ObjectProperties
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0
+	};
+	enum EVariable
+	{
+		ObjectData_ObjectID = 0,
+		ObjectData_CreatorID = 1,
+		ObjectData_OwnerID = 2,
+		ObjectData_GroupID = 3,
+		ObjectData_CreationDate = 4,
+		ObjectData_BaseMask = 5,
+		ObjectData_OwnerMask = 6,
+		ObjectData_GroupMask = 7,
+		ObjectData_EveryoneMask = 8,
+		ObjectData_NextOwnerMask = 9,
+		ObjectData_OwnershipCost = 10,
+		ObjectData_SaleType = 11,
+		ObjectData_SalePrice = 12,
+		ObjectData_AggregatePerms = 13,
+		ObjectData_AggregatePermTextures = 14,
+		ObjectData_AggregatePermTexturesOwner = 15,
+		ObjectData_Category = 16,
+		ObjectData_InventorySerial = 17,
+		ObjectData_ItemID = 18,
+		ObjectData_FolderID = 19,
+		ObjectData_FromTaskID = 20,
+		ObjectData_LastOwnerID = 21,
+		ObjectData_Name = 22,
+		ObjectData_Description = 23,
+		ObjectData_TouchName = 24,
+		ObjectData_SitName = 25,
+		ObjectData_TextureID = 26
+	};
+}
+
+namespace ObjectPropertiesFamily
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0
+	};
+	enum EVariable
+	{
+		ObjectData_RequestFlags = 0,
+		ObjectData_ObjectID = 1,
+		ObjectData_OwnerID = 2,
+		ObjectData_GroupID = 3,
+		ObjectData_BaseMask = 4,
+		ObjectData_OwnerMask = 5,
+		ObjectData_GroupMask = 6,
+		ObjectData_EveryoneMask = 7,
+		ObjectData_NextOwnerMask = 8,
+		ObjectData_OwnershipCost = 9,
+		ObjectData_SaleType = 10,
+		ObjectData_SalePrice = 11,
+		ObjectData_Category = 12,
+		ObjectData_LastOwnerID = 13,
+		ObjectData_Name = 14,
+		ObjectData_Description = 15
+	};
+}
+
+namespace ObjectRotation
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_Rotation = 1
+	};
+}
+
+namespace ObjectSaleInfo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_LocalID = 0,
+		ObjectData_SaleType = 1,
+		ObjectData_SalePrice = 2
+	};
+}
+
+namespace ObjectSelect
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0
+	};
+}
+
+namespace ObjectShape
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectLocalID = 0,
+		ObjectData_PathCurve = 1,
+		ObjectData_ProfileCurve = 2,
+		ObjectData_PathBegin = 3,
+		ObjectData_PathEnd = 4,
+		ObjectData_PathScaleX = 5,
+		ObjectData_PathScaleY = 6,
+		ObjectData_PathShearX = 7,
+		ObjectData_PathShearY = 8,
+		ObjectData_PathTwist = 9,
+		ObjectData_PathTwistBegin = 10,
+		ObjectData_PathRadiusOffset = 11,
+		ObjectData_PathTaperX = 12,
+		ObjectData_PathTaperY = 13,
+		ObjectData_PathRevolutions = 14,
+		ObjectData_PathSkew = 15,
+		ObjectData_ProfileBegin = 16,
+		ObjectData_ProfileEnd = 17,
+		ObjectData_ProfileHollow = 18
+	};
+}
+
+namespace ObjectSpinStart
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace ObjectSpinStop
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace ObjectSpinUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ObjectID = 0,
+		ObjectData_Rotation = 1
+	};
+}
+
+namespace ObjectUpdate
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0,
+		RegionData_TimeDilation = 1,
+		ObjectData_ID = 0,
+		ObjectData_State = 1,
+		ObjectData_FullID = 2,
+		ObjectData_CRC = 3,
+		ObjectData_PCode = 4,
+		ObjectData_Material = 5,
+		ObjectData_ClickAction = 6,
+		ObjectData_Scale = 7,
+		ObjectData_ObjectData = 8,
+		ObjectData_ParentID = 9,
+		ObjectData_UpdateFlags = 10,
+		ObjectData_PathCurve = 11,
+		ObjectData_ProfileCurve = 12,
+		ObjectData_PathBegin = 13,
+		ObjectData_PathEnd = 14,
+		ObjectData_PathScaleX = 15,
+		ObjectData_PathScaleY = 16,
+		ObjectData_PathShearX = 17,
+		ObjectData_PathShearY = 18,
+		ObjectData_PathTwist = 19,
+		ObjectData_PathTwistBegin = 20,
+		ObjectData_PathRadiusOffset = 21,
+		ObjectData_PathTaperX = 22,
+		ObjectData_PathTaperY = 23,
+		ObjectData_PathRevolutions = 24,
+		ObjectData_PathSkew = 25,
+		ObjectData_ProfileBegin = 26,
+		ObjectData_ProfileEnd = 27,
+		ObjectData_ProfileHollow = 28,
+		ObjectData_TextureEntry = 29,
+		ObjectData_TextureAnim = 30,
+		ObjectData_NameValue = 31,
+		ObjectData_Data = 32,
+		ObjectData_Text = 33,
+		ObjectData_TextColor = 34,
+		ObjectData_MediaURL = 35,
+		ObjectData_PSBlock = 36,
+		ObjectData_ExtraParams = 37,
+		ObjectData_Sound = 38,
+		ObjectData_OwnerID = 39,
+		ObjectData_Gain = 40,
+		ObjectData_Flags = 41,
+		ObjectData_Radius = 42,
+		ObjectData_JointType = 43,
+		ObjectData_JointPivot = 44,
+		ObjectData_JointAxisOrAnchor = 45
+	};
+}
+
+namespace ObjectUpdateCached
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0,
+		RegionData_TimeDilation = 1,
+		ObjectData_ID = 0,
+		ObjectData_CRC = 1,
+		ObjectData_UpdateFlags = 2
+	};
+}
+
+namespace ObjectUpdateCompressed
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0,
+		RegionData_TimeDilation = 1,
+		ObjectData_UpdateFlags = 0,
+		ObjectData_Data = 1
+	};
+}
+
+namespace OfferCallingCard
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_AgentBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentBlock_DestID = 0,
+		AgentBlock_TransactionID = 1
+	};
+}
+
+namespace OfflineNotification
+{
+	enum EBlock
+	{
+		BLOCK_AgentBlock = 0
+	};
+	enum EVariable
+	{
+		AgentBlock_AgentID = 0
+	};
+}
+
+namespace OnlineNotification
+{
+	enum EBlock
+	{
+		BLOCK_AgentBlock = 0
+	};
+	enum EVariable
+	{
+		AgentBlock_AgentID = 0
+	};
+}
+
+namespace OpenCircuit
+{
+	enum EBlock
+	{
+		BLOCK_CircuitInfo = 0
+	};
+	enum EVariable
+	{
+		CircuitInfo_IP = 0,
+		CircuitInfo_Port = 1
+	};
+}
+
+namespace PacketAck
+{
+	enum EBlock
+	{
+		BLOCK_Packets = 0
+	};
+	enum EVariable
+	{
+		Packets_ID = 0
+	};
+}
+
+namespace ParcelAccessListReply
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0,
+		BLOCK_List = 1
+	};
+	enum EVariable
+	{
+		Data_AgentID = 0,
+		Data_SequenceID = 1,
+		Data_Flags = 2,
+		Data_LocalID = 3,
+		List_ID = 0,
+		List_Time = 1,
+		List_Flags = 2
+	};
+}
+
+namespace ParcelAccessListRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_SequenceID = 0,
+		Data_Flags = 1,
+		Data_LocalID = 2
+	};
+}
+
+namespace ParcelAccessListUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1,
+		BLOCK_List = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_Flags = 0,
+		Data_LocalID = 1,
+		Data_TransactionID = 2,
+		Data_SequenceID = 3,
+		Data_Sections = 4,
+		List_ID = 0,
+		List_Time = 1,
+		List_Flags = 2
+	};
+}
+
+namespace ParcelAuctions
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0,
+		ParcelData_WinnerID = 1
+	};
+}
+
+namespace ParcelBuy
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1,
+		BLOCK_ParcelData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupID = 0,
+		Data_IsGroupOwned = 1,
+		Data_RemoveContribution = 2,
+		Data_LocalID = 3,
+		Data_Final = 4,
+		ParcelData_Price = 0,
+		ParcelData_Area = 1
+	};
+}
+
+namespace ParcelBuyPass
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0
+	};
+}
+
+namespace ParcelClaim
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1,
+		BLOCK_ParcelData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupID = 0,
+		Data_IsGroupOwned = 1,
+		Data_Final = 2,
+		ParcelData_West = 0,
+		ParcelData_South = 1,
+		ParcelData_East = 2,
+		ParcelData_North = 3
+	};
+}
+
+namespace ParcelDeedToGroup
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupID = 0,
+		Data_LocalID = 1
+	};
+}
+
+namespace ParcelDisableObjects
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1,
+		BLOCK_TaskIDs = 2,
+		BLOCK_OwnerIDs = 3
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0,
+		ParcelData_ReturnType = 1,
+		TaskIDs_TaskID = 0,
+		OwnerIDs_OwnerID = 0
+	};
+}
+
+namespace ParcelDivide
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_West = 0,
+		ParcelData_South = 1,
+		ParcelData_East = 2,
+		ParcelData_North = 3
+	};
+}
+
+namespace ParcelDwellReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Data_LocalID = 0,
+		Data_ParcelID = 1,
+		Data_Dwell = 2
+	};
+}
+
+namespace ParcelDwellRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_LocalID = 0,
+		Data_ParcelID = 1
+	};
+}
+
+namespace ParcelGodForceOwner
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_OwnerID = 0,
+		Data_LocalID = 1
+	};
+}
+
+namespace ParcelGodMarkAsContent
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0
+	};
+}
+
+namespace ParcelInfoReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Data_ParcelID = 0,
+		Data_OwnerID = 1,
+		Data_Name = 2,
+		Data_Desc = 3,
+		Data_ActualArea = 4,
+		Data_BillableArea = 5,
+		Data_Flags = 6,
+		Data_GlobalX = 7,
+		Data_GlobalY = 8,
+		Data_GlobalZ = 9,
+		Data_SimName = 10,
+		Data_SnapshotID = 11,
+		Data_Dwell = 12,
+		Data_SalePrice = 13,
+		Data_AuctionID = 14
+	};
+}
+
+namespace ParcelInfoRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ParcelID = 0
+	};
+}
+
+namespace ParcelJoin
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_West = 0,
+		ParcelData_South = 1,
+		ParcelData_East = 2,
+		ParcelData_North = 3
+	};
+}
+
+namespace ParcelMediaCommandMessage
+{
+	enum EBlock
+	{
+		BLOCK_CommandBlock = 0
+	};
+	enum EVariable
+	{
+		CommandBlock_Flags = 0,
+		CommandBlock_Command = 1,
+		CommandBlock_Time = 2
+	};
+}
+
+namespace ParcelMediaUpdate
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0,
+		BLOCK_DataBlockExtended = 1
+	};
+	enum EVariable
+	{
+		DataBlock_MediaURL = 0,
+		DataBlock_MediaID = 1,
+		DataBlock_MediaAutoScale = 2,
+		DataBlockExtended_MediaType = 0,
+		DataBlockExtended_MediaDesc = 1,
+		DataBlockExtended_MediaWidth = 2,
+		DataBlockExtended_MediaHeight = 3,
+		DataBlockExtended_MediaLoop = 4
+	};
+}
+
+namespace ParcelObjectOwnersReply
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_OwnerID = 0,
+		Data_IsGroupOwned = 1,
+		Data_Count = 2,
+		Data_OnlineStatus = 3
+	};
+}
+
+namespace ParcelObjectOwnersRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0
+	};
+}
+
+namespace ParcelOverlay
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_SequenceID = 0,
+		ParcelData_Data = 1
+	};
+}
+
+namespace ParcelProperties
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0,
+		BLOCK_AgeVerificationBlock = 1
+	};
+	enum EVariable
+	{
+		ParcelData_RequestResult = 0,
+		ParcelData_SequenceID = 1,
+		ParcelData_SnapSelection = 2,
+		ParcelData_SelfCount = 3,
+		ParcelData_OtherCount = 4,
+		ParcelData_PublicCount = 5,
+		ParcelData_LocalID = 6,
+		ParcelData_OwnerID = 7,
+		ParcelData_IsGroupOwned = 8,
+		ParcelData_AuctionID = 9,
+		ParcelData_ClaimDate = 10,
+		ParcelData_ClaimPrice = 11,
+		ParcelData_RentPrice = 12,
+		ParcelData_AABBMin = 13,
+		ParcelData_AABBMax = 14,
+		ParcelData_Bitmap = 15,
+		ParcelData_Area = 16,
+		ParcelData_Status = 17,
+		ParcelData_SimWideMaxPrims = 18,
+		ParcelData_SimWideTotalPrims = 19,
+		ParcelData_MaxPrims = 20,
+		ParcelData_TotalPrims = 21,
+		ParcelData_OwnerPrims = 22,
+		ParcelData_GroupPrims = 23,
+		ParcelData_OtherPrims = 24,
+		ParcelData_SelectedPrims = 25,
+		ParcelData_ParcelPrimBonus = 26,
+		ParcelData_OtherCleanTime = 27,
+		ParcelData_ParcelFlags = 28,
+		ParcelData_SalePrice = 29,
+		ParcelData_Name = 30,
+		ParcelData_Desc = 31,
+		ParcelData_MusicURL = 32,
+		ParcelData_MediaURL = 33,
+		ParcelData_MediaID = 34,
+		ParcelData_MediaAutoScale = 35,
+		ParcelData_GroupID = 36,
+		ParcelData_PassPrice = 37,
+		ParcelData_PassHours = 38,
+		ParcelData_Category = 39,
+		ParcelData_AuthBuyerID = 40,
+		ParcelData_SnapshotID = 41,
+		ParcelData_UserLocation = 42,
+		ParcelData_UserLookAt = 43,
+		ParcelData_LandingType = 44,
+		ParcelData_RegionPushOverride = 45,
+		ParcelData_RegionDenyAnonymous = 46,
+		ParcelData_RegionDenyIdentified = 47,
+		ParcelData_RegionDenyTransacted = 48,
+		AgeVerificationBlock_RegionDenyAgeUnverified = 0
+	};
+}
+
+namespace ParcelPropertiesRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_SequenceID = 0,
+		ParcelData_West = 1,
+		ParcelData_South = 2,
+		ParcelData_East = 3,
+		ParcelData_North = 4,
+		ParcelData_SnapSelection = 5
+	};
+}
+
+namespace ParcelPropertiesRequestByID
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_SequenceID = 0,
+		ParcelData_LocalID = 1
+	};
+}
+
+namespace ParcelPropertiesUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0,
+		ParcelData_Flags = 1,
+		ParcelData_ParcelFlags = 2,
+		ParcelData_SalePrice = 3,
+		ParcelData_Name = 4,
+		ParcelData_Desc = 5,
+		ParcelData_MusicURL = 6,
+		ParcelData_MediaURL = 7,
+		ParcelData_MediaID = 8,
+		ParcelData_MediaAutoScale = 9,
+		ParcelData_GroupID = 10,
+		ParcelData_PassPrice = 11,
+		ParcelData_PassHours = 12,
+		ParcelData_Category = 13,
+		ParcelData_AuthBuyerID = 14,
+		ParcelData_SnapshotID = 15,
+		ParcelData_UserLocation = 16,
+		ParcelData_UserLookAt = 17,
+		ParcelData_LandingType = 18
+	};
+}
+
+namespace ParcelReclaim
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_LocalID = 0
+	};
+}
+
+namespace ParcelRelease
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_LocalID = 0
+	};
+}
+
+namespace ParcelRename
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0,
+		ParcelData_NewName = 1
+	};
+}
+
+namespace ParcelReturnObjects
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1,
+		BLOCK_TaskIDs = 2,
+		BLOCK_OwnerIDs = 3
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0,
+		ParcelData_ReturnType = 1,
+		TaskIDs_TaskID = 0,
+		OwnerIDs_OwnerID = 0
+	};
+}
+
+namespace ParcelSales
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0,
+		ParcelData_BuyerID = 1
+	};
+}
+
+namespace ParcelSelectObjects
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1,
+		BLOCK_ReturnIDs = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0,
+		ParcelData_ReturnType = 1,
+		ReturnIDs_ReturnID = 0
+	};
+}
+
+namespace ParcelSetOtherCleanTime
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0,
+		ParcelData_OtherCleanTime = 1
+	};
+}
+
+namespace PayPriceReply
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0,
+		BLOCK_ButtonData = 1
+	};
+	enum EVariable
+	{
+		ObjectData_ObjectID = 0,
+		ObjectData_DefaultPayPrice = 1,
+		ButtonData_PayButton = 0
+	};
+}
+
+namespace PickDelete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_PickID = 0
+	};
+}
+
+namespace PickGodDelete
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_PickID = 0,
+		Data_QueryID = 1
+	};
+}
+
+namespace PickInfoReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Data_PickID = 0,
+		Data_CreatorID = 1,
+		Data_TopPick = 2,
+		Data_ParcelID = 3,
+		Data_Name = 4,
+		Data_Desc = 5,
+		Data_SnapshotID = 6,
+		Data_User = 7,
+		Data_OriginalName = 8,
+		Data_SimName = 9,
+		Data_PosGlobal = 10,
+		Data_SortOrder = 11,
+		Data_Enabled = 12
+	};
+}
+
+namespace PickInfoUpdate
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_PickID = 0,
+		Data_CreatorID = 1,
+		Data_TopPick = 2,
+		Data_ParcelID = 3,
+		Data_Name = 4,
+		Data_Desc = 5,
+		Data_SnapshotID = 6,
+		Data_PosGlobal = 7,
+		Data_SortOrder = 8,
+		Data_Enabled = 9
+	};
+}
+
+namespace PlacesQuery
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionData = 1,
+		BLOCK_QueryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_QueryID = 2,
+		TransactionData_TransactionID = 0,
+		QueryData_QueryText = 0,
+		QueryData_QueryFlags = 1,
+		QueryData_Category = 2,
+		QueryData_SimName = 3
+	};
+}
+
+namespace PlacesReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TransactionData = 1,
+		BLOCK_QueryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_QueryID = 1,
+		TransactionData_TransactionID = 0,
+		QueryData_OwnerID = 0,
+		QueryData_Name = 1,
+		QueryData_Desc = 2,
+		QueryData_ActualArea = 3,
+		QueryData_BillableArea = 4,
+		QueryData_Flags = 5,
+		QueryData_GlobalX = 6,
+		QueryData_GlobalY = 7,
+		QueryData_GlobalZ = 8,
+		QueryData_SimName = 9,
+		QueryData_SnapshotID = 10,
+		QueryData_Dwell = 11,
+		QueryData_Price = 12
+	};
+}
+
+namespace PreloadSound
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_ObjectID = 0,
+		DataBlock_OwnerID = 1,
+		DataBlock_SoundID = 2
+	};
+}
+
+namespace PurgeInventoryDescendents
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_FolderID = 0
+	};
+}
+
+namespace RebakeAvatarTextures
+{
+	enum EBlock
+	{
+		BLOCK_TextureData = 0
+	};
+	enum EVariable
+	{
+		TextureData_TextureID = 0
+	};
+}
+
+namespace Redo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace RegionHandleRequest
+{
+	enum EBlock
+	{
+		BLOCK_RequestBlock = 0
+	};
+	enum EVariable
+	{
+		RequestBlock_RegionID = 0
+	};
+}
+
+namespace RegionHandshake
+{
+	enum EBlock
+	{
+		BLOCK_RegionInfo = 0,
+		BLOCK_RegionInfo2 = 1
+	};
+	enum EVariable
+	{
+		RegionInfo_RegionFlags = 0,
+		RegionInfo_SimAccess = 1,
+		RegionInfo_SimName = 2,
+		RegionInfo_SimOwner = 3,
+		RegionInfo_IsEstateManager = 4,
+		RegionInfo_WaterHeight = 5,
+		RegionInfo_BillableFactor = 6,
+		RegionInfo_CacheID = 7,
+		RegionInfo_TerrainBase0 = 8,
+		RegionInfo_TerrainBase1 = 9,
+		RegionInfo_TerrainBase2 = 10,
+		RegionInfo_TerrainBase3 = 11,
+		RegionInfo_TerrainDetail0 = 12,
+		RegionInfo_TerrainDetail1 = 13,
+		RegionInfo_TerrainDetail2 = 14,
+		RegionInfo_TerrainDetail3 = 15,
+		RegionInfo_TerrainStartHeight00 = 16,
+		RegionInfo_TerrainStartHeight01 = 17,
+		RegionInfo_TerrainStartHeight10 = 18,
+		RegionInfo_TerrainStartHeight11 = 19,
+		RegionInfo_TerrainHeightRange00 = 20,
+		RegionInfo_TerrainHeightRange01 = 21,
+		RegionInfo_TerrainHeightRange10 = 22,
+		RegionInfo_TerrainHeightRange11 = 23,
+		RegionInfo2_RegionID = 0
+	};
+}
+
+namespace RegionHandshakeReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RegionInfo = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RegionInfo_Flags = 0
+	};
+}
+
+namespace RegionIDAndHandleReply
+{
+	enum EBlock
+	{
+		BLOCK_ReplyBlock = 0
+	};
+	enum EVariable
+	{
+		ReplyBlock_RegionID = 0,
+		ReplyBlock_RegionHandle = 1
+	};
+}
+
+namespace RegionInfo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RegionInfo = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RegionInfo_SimName = 0,
+		RegionInfo_EstateID = 1,
+		RegionInfo_ParentEstateID = 2,
+		RegionInfo_RegionFlags = 3,
+		RegionInfo_SimAccess = 4,
+		RegionInfo_MaxAgents = 5,
+		RegionInfo_BillableFactor = 6,
+		RegionInfo_ObjectBonusFactor = 7,
+		RegionInfo_WaterHeight = 8,
+		RegionInfo_TerrainRaiseLimit = 9,
+		RegionInfo_TerrainLowerLimit = 10,
+		RegionInfo_PricePerMeter = 11,
+		RegionInfo_RedirectGridX = 12,
+		RegionInfo_RedirectGridY = 13,
+		RegionInfo_UseEstateSun = 14,
+		RegionInfo_SunHour = 15
+	};
+}
+
+namespace RegionPresenceRequestByHandle
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0
+	};
+}
+
+namespace RegionPresenceRequestByRegionID
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionID = 0
+	};
+}
+
+namespace RegionPresenceResponse
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionID = 0,
+		RegionData_RegionHandle = 1,
+		RegionData_InternalRegionIP = 2,
+		RegionData_ExternalRegionIP = 3,
+		RegionData_RegionPort = 4,
+		RegionData_ValidUntil = 5,
+		RegionData_Message = 6
+	};
+}
+
+namespace RemoveAttachment
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_AttachmentBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AttachmentBlock_AttachmentPoint = 0,
+		AttachmentBlock_ItemID = 1
+	};
+}
+
+namespace RemoveInventoryFolder
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FolderData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		FolderData_FolderID = 0
+	};
+}
+
+namespace RemoveInventoryItem
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_ItemID = 0
+	};
+}
+
+namespace RemoveInventoryObjects
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FolderData = 1,
+		BLOCK_ItemData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		FolderData_FolderID = 0,
+		ItemData_ItemID = 0
+	};
+}
+
+namespace RemoveMuteListEntry
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MuteData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		MuteData_MuteID = 0,
+		MuteData_MuteName = 1
+	};
+}
+
+namespace RemoveNameValuePair
+{
+	enum EBlock
+	{
+		BLOCK_TaskData = 0,
+		BLOCK_NameValueData = 1
+	};
+	enum EVariable
+	{
+		TaskData_ID = 0,
+		NameValueData_NVPair = 0
+	};
+}
+
+namespace RemoveParcel
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0
+	};
+}
+
+namespace RemoveTaskInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_LocalID = 0,
+		InventoryData_ItemID = 1
+	};
+}
+
+namespace ReplyTaskInventory
+{
+	enum EBlock
+	{
+		BLOCK_InventoryData = 0
+	};
+	enum EVariable
+	{
+		InventoryData_TaskID = 0,
+		InventoryData_Serial = 1,
+		InventoryData_Filename = 2
+	};
+}
+
+namespace ReportAutosaveCrash
+{
+	enum EBlock
+	{
+		BLOCK_AutosaveData = 0
+	};
+	enum EVariable
+	{
+		AutosaveData_PID = 0,
+		AutosaveData_Status = 1
+	};
+}
+
+namespace RequestGodlikePowers
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RequestBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RequestBlock_Godlike = 0,
+		RequestBlock_Token = 1
+	};
+}
+
+namespace RequestImage
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RequestImage = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		RequestImage_Image = 0,
+		RequestImage_DiscardLevel = 1,
+		RequestImage_DownloadPriority = 2,
+		RequestImage_Packet = 3,
+		RequestImage_Type = 4
+	};
+}
+
+namespace RequestInventoryAsset
+{
+	enum EBlock
+	{
+		BLOCK_QueryData = 0
+	};
+	enum EVariable
+	{
+		QueryData_QueryID = 0,
+		QueryData_AgentID = 1,
+		QueryData_OwnerID = 2,
+		QueryData_ItemID = 3
+	};
+}
+
+namespace RequestMultipleObjects
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_CacheMissType = 0,
+		ObjectData_ID = 1
+	};
+}
+
+namespace RequestObjectPropertiesFamily
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_RequestFlags = 0,
+		ObjectData_ObjectID = 1
+	};
+}
+
+namespace RequestParcelTransfer
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_TransactionID = 0,
+		Data_TransactionTime = 1,
+		Data_SourceID = 2,
+		Data_DestID = 3,
+		Data_OwnerID = 4,
+		Data_Flags = 5,
+		Data_TransactionType = 6,
+		Data_Amount = 7,
+		Data_BillableArea = 8,
+		Data_ActualArea = 9,
+		Data_Final = 10
+	};
+}
+
+namespace RequestPayPrice
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0
+	};
+	enum EVariable
+	{
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace RequestRegionInfo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace RequestTaskInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		InventoryData_LocalID = 0
+	};
+}
+
+namespace RequestXfer
+{
+	enum EBlock
+	{
+		BLOCK_XferID = 0
+	};
+	enum EVariable
+	{
+		XferID_ID = 0,
+		XferID_Filename = 1,
+		XferID_FilePath = 2,
+		XferID_DeleteOnCompletion = 3,
+		XferID_UseBigPackets = 4,
+		XferID_VFileID = 5,
+		XferID_VFileType = 6
+	};
+}
+
+namespace RetrieveInstantMessages
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace RevokePermissions
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ObjectID = 0,
+		Data_ObjectPermissions = 1
+	};
+}
+
+namespace RezMultipleAttachmentsFromInv
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_HeaderData = 1,
+		BLOCK_ObjectData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		HeaderData_CompoundMsgID = 0,
+		HeaderData_TotalObjects = 1,
+		HeaderData_FirstDetachAll = 2,
+		ObjectData_ItemID = 0,
+		ObjectData_OwnerID = 1,
+		ObjectData_AttachmentPt = 2,
+		ObjectData_ItemFlags = 3,
+		ObjectData_GroupMask = 4,
+		ObjectData_EveryoneMask = 5,
+		ObjectData_NextOwnerMask = 6,
+		ObjectData_Name = 7,
+		ObjectData_Description = 8
+	};
+}
+
+namespace RezObject
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RezData = 1,
+		BLOCK_InventoryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		RezData_FromTaskID = 0,
+		RezData_BypassRaycast = 1,
+		RezData_RayStart = 2,
+		RezData_RayEnd = 3,
+		RezData_RayTargetID = 4,
+		RezData_RayEndIsIntersection = 5,
+		RezData_RezSelected = 6,
+		RezData_RemoveItem = 7,
+		RezData_ItemFlags = 8,
+		RezData_GroupMask = 9,
+		RezData_EveryoneMask = 10,
+		RezData_NextOwnerMask = 11,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_CreatorID = 2,
+		InventoryData_OwnerID = 3,
+		InventoryData_GroupID = 4,
+		InventoryData_BaseMask = 5,
+		InventoryData_OwnerMask = 6,
+		InventoryData_GroupMask = 7,
+		InventoryData_EveryoneMask = 8,
+		InventoryData_NextOwnerMask = 9,
+		InventoryData_GroupOwned = 10,
+		InventoryData_TransactionID = 11,
+		InventoryData_Type = 12,
+		InventoryData_InvType = 13,
+		InventoryData_Flags = 14,
+		InventoryData_SaleType = 15,
+		InventoryData_SalePrice = 16,
+		InventoryData_Name = 17,
+		InventoryData_Description = 18,
+		InventoryData_CreationDate = 19,
+		InventoryData_CRC = 20
+	};
+}
+
+namespace RezObjectFromNotecard
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_RezData = 1,
+		BLOCK_NotecardData = 2,
+		BLOCK_InventoryData = 3
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		RezData_FromTaskID = 0,
+		RezData_BypassRaycast = 1,
+		RezData_RayStart = 2,
+		RezData_RayEnd = 3,
+		RezData_RayTargetID = 4,
+		RezData_RayEndIsIntersection = 5,
+		RezData_RezSelected = 6,
+		RezData_RemoveItem = 7,
+		RezData_ItemFlags = 8,
+		RezData_GroupMask = 9,
+		RezData_EveryoneMask = 10,
+		RezData_NextOwnerMask = 11,
+		NotecardData_NotecardItemID = 0,
+		NotecardData_ObjectID = 1,
+		InventoryData_ItemID = 0
+	};
+}
+
+namespace RezScript
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_UpdateBlock = 1,
+		BLOCK_InventoryBlock = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		UpdateBlock_ObjectLocalID = 0,
+		UpdateBlock_Enabled = 1,
+		InventoryBlock_ItemID = 0,
+		InventoryBlock_FolderID = 1,
+		InventoryBlock_CreatorID = 2,
+		InventoryBlock_OwnerID = 3,
+		InventoryBlock_GroupID = 4,
+		InventoryBlock_BaseMask = 5,
+		InventoryBlock_OwnerMask = 6,
+		InventoryBlock_GroupMask = 7,
+		InventoryBlock_EveryoneMask = 8,
+		InventoryBlock_NextOwnerMask = 9,
+		InventoryBlock_GroupOwned = 10,
+		InventoryBlock_TransactionID = 11,
+		InventoryBlock_Type = 12,
+		InventoryBlock_InvType = 13,
+		InventoryBlock_Flags = 14,
+		InventoryBlock_SaleType = 15,
+		InventoryBlock_SalePrice = 16,
+		InventoryBlock_Name = 17,
+		InventoryBlock_Description = 18,
+		InventoryBlock_CreationDate = 19,
+		InventoryBlock_CRC = 20
+	};
+}
+
+namespace RezSingleAttachmentFromInv
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ObjectData_ItemID = 0,
+		ObjectData_OwnerID = 1,
+		ObjectData_AttachmentPt = 2,
+		ObjectData_ItemFlags = 3,
+		ObjectData_GroupMask = 4,
+		ObjectData_EveryoneMask = 5,
+		ObjectData_NextOwnerMask = 6,
+		ObjectData_Name = 7,
+		ObjectData_Description = 8
+	};
+}
+
+namespace RoutedMoneyBalanceReply
+{
+	enum EBlock
+	{
+		BLOCK_TargetBlock = 0,
+		BLOCK_MoneyData = 1
+	};
+	enum EVariable
+	{
+		TargetBlock_TargetIP = 0,
+		TargetBlock_TargetPort = 1,
+		MoneyData_AgentID = 0,
+		MoneyData_TransactionID = 1,
+		MoneyData_TransactionSuccess = 2,
+		MoneyData_MoneyBalance = 3,
+		MoneyData_SquareMetersCredit = 4,
+		MoneyData_SquareMetersCommitted = 5,
+		MoneyData_Description = 6
+	};
+}
+
+namespace RpcChannelReply
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_TaskID = 0,
+		DataBlock_ItemID = 1,
+		DataBlock_ChannelID = 2
+	};
+}
+
+namespace RpcChannelRequest
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_GridX = 0,
+		DataBlock_GridY = 1,
+		DataBlock_TaskID = 2,
+		DataBlock_ItemID = 3
+	};
+}
+
+namespace RpcScriptReplyInbound
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_TaskID = 0,
+		DataBlock_ItemID = 1,
+		DataBlock_ChannelID = 2,
+		DataBlock_IntValue = 3,
+		DataBlock_StringValue = 4
+	};
+}
+
+namespace RpcScriptRequestInbound
+{
+	enum EBlock
+	{
+		BLOCK_TargetBlock = 0,
+		BLOCK_DataBlock = 1
+	};
+	enum EVariable
+	{
+		TargetBlock_GridX = 0,
+		TargetBlock_GridY = 1,
+		DataBlock_TaskID = 0,
+		DataBlock_ItemID = 1,
+		DataBlock_ChannelID = 2,
+		DataBlock_IntValue = 3,
+		DataBlock_StringValue = 4
+	};
+}
+
+namespace RpcScriptRequestInboundForward
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_RPCServerIP = 0,
+		DataBlock_RPCServerPort = 1,
+		DataBlock_TaskID = 2,
+		DataBlock_ItemID = 3,
+		DataBlock_ChannelID = 4,
+		DataBlock_IntValue = 5,
+		DataBlock_StringValue = 6
+	};
+}
+
+namespace SaveAssetIntoInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		InventoryData_ItemID = 0,
+		InventoryData_NewAssetID = 1
+	};
+}
+
+namespace ScriptAnswerYes
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_TaskID = 0,
+		Data_ItemID = 1,
+		Data_Questions = 2
+	};
+}
+
+namespace ScriptControlChange
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_TakeControls = 0,
+		Data_Controls = 1,
+		Data_PassToAgent = 2
+	};
+}
+
+namespace ScriptDataReply
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_Hash = 0,
+		DataBlock_Reply = 1
+	};
+}
+
+namespace ScriptDataRequest
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_Hash = 0,
+		DataBlock_RequestType = 1,
+		DataBlock_Request = 2
+	};
+}
+
+namespace ScriptDialog
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0,
+		BLOCK_Buttons = 1
+	};
+	enum EVariable
+	{
+		Data_ObjectID = 0,
+		Data_FirstName = 1,
+		Data_LastName = 2,
+		Data_ObjectName = 3,
+		Data_Message = 4,
+		Data_ChatChannel = 5,
+		Data_ImageID = 6,
+		Buttons_ButtonLabel = 0
+	};
+}
+
+namespace ScriptDialogReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_ObjectID = 0,
+		Data_ChatChannel = 1,
+		Data_ButtonIndex = 2,
+		Data_ButtonLabel = 3
+	};
+}
+
+namespace ScriptMailRegistration
+{
+	enum EBlock
+	{
+		BLOCK_DataBlock = 0
+	};
+	enum EVariable
+	{
+		DataBlock_TargetIP = 0,
+		DataBlock_TargetPort = 1,
+		DataBlock_TaskID = 2,
+		DataBlock_Flags = 3
+	};
+}
+
+namespace ScriptQuestion
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_TaskID = 0,
+		Data_ItemID = 1,
+		Data_ObjectName = 2,
+		Data_ObjectOwner = 3,
+		Data_Questions = 4
+	};
+}
+
+namespace ScriptReset
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Script = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Script_ObjectID = 0,
+		Script_ItemID = 1
+	};
+}
+
+namespace ScriptRunningReply
+{
+	enum EBlock
+	{
+		BLOCK_Script = 0
+	};
+	enum EVariable
+	{
+		Script_ObjectID = 0,
+		Script_ItemID = 1,
+		Script_Running = 2
+	};
+}
+
+namespace ScriptSensorReply
+{
+	enum EBlock
+	{
+		BLOCK_Requester = 0,
+		BLOCK_SensedData = 1
+	};
+	enum EVariable
+	{
+		Requester_SourceID = 0,
+		SensedData_ObjectID = 0,
+		SensedData_OwnerID = 1,
+		SensedData_GroupID = 2,
+		SensedData_Position = 3,
+		SensedData_Velocity = 4,
+		SensedData_Rotation = 5,
+		SensedData_Name = 6,
+		SensedData_Type = 7,
+		SensedData_Range = 8
+	};
+}
+
+namespace ScriptSensorRequest
+{
+	enum EBlock
+	{
+		BLOCK_Requester = 0
+	};
+	enum EVariable
+	{
+		Requester_SourceID = 0,
+		Requester_RequestID = 1,
+		Requester_SearchID = 2,
+		Requester_SearchPos = 3,
+		Requester_SearchDir = 4,
+		Requester_SearchName = 5,
+		Requester_Type = 6,
+		Requester_Range = 7,
+		Requester_Arc = 8,
+		Requester_RegionHandle = 9,
+		Requester_SearchRegions = 10
+	};
+}
+
+namespace ScriptTeleportRequest
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_ObjectName = 0,
+		Data_SimName = 1,
+		Data_SimPosition = 2,
+		Data_LookAt = 3
+	};
+}
+
+namespace SendPostcard
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_AssetID = 2,
+		AgentData_PosGlobal = 3,
+		AgentData_To = 4,
+		AgentData_From = 5,
+		AgentData_Name = 6,
+		AgentData_Subject = 7,
+		AgentData_Msg = 8,
+		AgentData_AllowPublish = 9,
+		AgentData_MaturePublish = 10
+	};
+}
+
+namespace SendXferPacket
+{
+	enum EBlock
+	{
+		BLOCK_XferID = 0,
+		BLOCK_DataPacket = 1
+	};
+	enum EVariable
+	{
+		XferID_ID = 0,
+		XferID_Packet = 1,
+		DataPacket_Data = 0
+	};
+}
+
+namespace SetAlwaysRun
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_AlwaysRun = 2
+	};
+}
+
+namespace SetCPURatio
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_Ratio = 0
+	};
+}
+
+namespace SetFollowCamProperties
+{
+	enum EBlock
+	{
+		BLOCK_ObjectData = 0,
+		BLOCK_CameraProperty = 1
+	};
+	enum EVariable
+	{
+		ObjectData_ObjectID = 0,
+		CameraProperty_Type = 0,
+		CameraProperty_Value = 1
+	};
+}
+
+namespace SetGroupAcceptNotices
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1,
+		BLOCK_NewData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupID = 0,
+		Data_AcceptNotices = 1,
+		NewData_ListInProfile = 0
+	};
+}
+
+namespace SetGroupContribution
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Data = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Data_GroupID = 0,
+		Data_Contribution = 1
+	};
+}
+
+namespace SetScriptRunning
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Script = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Script_ObjectID = 0,
+		Script_ItemID = 1,
+		Script_Running = 2
+	};
+}
+
+namespace SetSimPresenceInDatabase
+{
+	enum EBlock
+	{
+		BLOCK_SimData = 0
+	};
+	enum EVariable
+	{
+		SimData_RegionID = 0,
+		SimData_HostName = 1,
+		SimData_GridX = 2,
+		SimData_GridY = 3,
+		SimData_PID = 4,
+		SimData_AgentCount = 5,
+		SimData_TimeToLive = 6,
+		SimData_Status = 7
+	};
+}
+
+namespace SetSimStatusInDatabase
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0
+	};
+	enum EVariable
+	{
+		Data_RegionID = 0,
+		Data_HostName = 1,
+		Data_X = 2,
+		Data_Y = 3,
+		Data_PID = 4,
+		Data_AgentCount = 5,
+		Data_TimeToLive = 6,
+		Data_Status = 7
+	};
+}
+
+namespace SetStartLocation
+{
+	enum EBlock
+	{
+		BLOCK_StartLocationData = 0
+	};
+	enum EVariable
+	{
+		StartLocationData_AgentID = 0,
+		StartLocationData_RegionID = 1,
+		StartLocationData_LocationID = 2,
+		StartLocationData_RegionHandle = 3,
+		StartLocationData_LocationPos = 4,
+		StartLocationData_LocationLookAt = 5
+	};
+}
+
+namespace SetStartLocationRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_StartLocationData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		StartLocationData_SimName = 0,
+		StartLocationData_LocationID = 1,
+		StartLocationData_LocationPos = 2,
+		StartLocationData_LocationLookAt = 3
+	};
+}
+
+namespace SimCrashed
+{
+	enum EBlock
+	{
+		BLOCK_Data = 0,
+		BLOCK_Users = 1
+	};
+	enum EVariable
+	{
+		Data_RegionX = 0,
+		Data_RegionY = 1,
+		Users_AgentID = 0
+	};
+}
+
+namespace SimStats
+{
+	enum EBlock
+	{
+		BLOCK_Region = 0,
+		BLOCK_Stat = 1,
+		BLOCK_PidStat = 2
+	};
+	enum EVariable
+	{
+		Region_RegionX = 0,
+		Region_RegionY = 1,
+		Region_RegionFlags = 2,
+		Region_ObjectCapacity = 3,
+		Stat_StatID = 0,
+		Stat_StatValue = 1,
+		PidStat_PID = 0
+	};
+}
+
+namespace SimStatus
+{
+	enum EBlock
+	{
+		BLOCK_SimStatus = 0
+	};
+	enum EVariable
+	{
+		SimStatus_CanAcceptAgents = 0,
+		SimStatus_CanAcceptTasks = 1
+	};
+}
+
+namespace SimWideDeletes
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_DataBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		DataBlock_TargetID = 0,
+		DataBlock_Flags = 1
+	};
+}
+
+namespace SimulatorLoad
+{
+	enum EBlock
+	{
+		BLOCK_SimulatorLoad = 0,
+		BLOCK_AgentList = 1
+	};
+	enum EVariable
+	{
+		SimulatorLoad_TimeDilation = 0,
+		SimulatorLoad_AgentCount = 1,
+		SimulatorLoad_CanAcceptAgents = 2,
+		AgentList_CircuitCode = 0,
+		AgentList_X = 1,
+		AgentList_Y = 2
+	};
+}
+
+namespace SimulatorMapUpdate
+{
+	enum EBlock
+	{
+		BLOCK_MapData = 0
+	};
+	enum EVariable
+	{
+		MapData_Flags = 0
+	};
+}
+
+namespace SimulatorPresentAtLocation
+{
+	enum EBlock
+	{
+		BLOCK_SimulatorPublicHostBlock = 0,
+		BLOCK_NeighborBlock = 1,
+		BLOCK_SimulatorBlock = 2,
+		BLOCK_TelehubBlock = 3
+	};
+	enum EVariable
+	{
+		SimulatorPublicHostBlock_Port = 0,
+		SimulatorPublicHostBlock_SimulatorIP = 1,
+		SimulatorPublicHostBlock_GridX = 2,
+		SimulatorPublicHostBlock_GridY = 3,
+		NeighborBlock_IP = 0,
+		NeighborBlock_Port = 1,
+		SimulatorBlock_SimName = 0,
+		SimulatorBlock_SimAccess = 1,
+		SimulatorBlock_RegionFlags = 2,
+		SimulatorBlock_RegionID = 3,
+		SimulatorBlock_EstateID = 4,
+		SimulatorBlock_ParentEstateID = 5,
+		TelehubBlock_HasTelehub = 0,
+		TelehubBlock_TelehubPos = 1
+	};
+}
+
+namespace SimulatorReady
+{
+	enum EBlock
+	{
+		BLOCK_SimulatorBlock = 0,
+		BLOCK_TelehubBlock = 1
+	};
+	enum EVariable
+	{
+		SimulatorBlock_SimName = 0,
+		SimulatorBlock_SimAccess = 1,
+		SimulatorBlock_RegionFlags = 2,
+		SimulatorBlock_RegionID = 3,
+		SimulatorBlock_EstateID = 4,
+		SimulatorBlock_ParentEstateID = 5,
+		TelehubBlock_HasTelehub = 0,
+		TelehubBlock_TelehubPos = 1
+	};
+}
+
+namespace SimulatorSetMap
+{
+	enum EBlock
+	{
+		BLOCK_MapData = 0
+	};
+	enum EVariable
+	{
+		MapData_RegionHandle = 0,
+		MapData_Type = 1,
+		MapData_MapImage = 2
+	};
+}
+
+namespace SimulatorViewerTimeMessage
+{
+	enum EBlock
+	{
+		BLOCK_TimeInfo = 0
+	};
+	enum EVariable
+	{
+		TimeInfo_UsecSinceStart = 0,
+		TimeInfo_SecPerDay = 1,
+		TimeInfo_SecPerYear = 2,
+		TimeInfo_SunDirection = 3,
+		TimeInfo_SunPhase = 4,
+		TimeInfo_SunAngVelocity = 5
+	};
+}
+
+namespace SoundTrigger
+{
+	enum EBlock
+	{
+		BLOCK_SoundData = 0
+	};
+	enum EVariable
+	{
+		SoundData_SoundID = 0,
+		SoundData_OwnerID = 1,
+		SoundData_ObjectID = 2,
+		SoundData_ParentID = 3,
+		SoundData_Handle = 4,
+		SoundData_Position = 5,
+		SoundData_Gain = 6
+	};
+}
+
+namespace StartAuction
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		ParcelData_ParcelID = 0,
+		ParcelData_SnapshotID = 1,
+		ParcelData_Name = 2
+	};
+}
+
+namespace StartGroupProposal
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ProposalData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ProposalData_GroupID = 0,
+		ProposalData_Quorum = 1,
+		ProposalData_Majority = 2,
+		ProposalData_Duration = 3,
+		ProposalData_ProposalText = 4
+	};
+}
+
+namespace StartLure
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Info = 1,
+		BLOCK_TargetData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Info_LureType = 0,
+		Info_Message = 1,
+		TargetData_TargetID = 0
+	};
+}
+
+namespace StartPingCheck
+{
+	enum EBlock
+	{
+		BLOCK_PingID = 0
+	};
+	enum EVariable
+	{
+		PingID_PingID = 0,
+		PingID_OldestUnacked = 1
+	};
+}
+
+namespace StateSave
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_DataBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		DataBlock_Filename = 0
+	};
+}
+
+namespace SystemKickUser
+{
+	enum EBlock
+	{
+		BLOCK_AgentInfo = 0
+	};
+	enum EVariable
+	{
+		AgentInfo_AgentID = 0
+	};
+}
+
+namespace SystemMessage
+{
+	enum EBlock
+	{
+		BLOCK_MethodData = 0,
+		BLOCK_ParamList = 1
+	};
+	enum EVariable
+	{
+		MethodData_Method = 0,
+		MethodData_Invoice = 1,
+		MethodData_Digest = 2,
+		ParamList_Parameter = 0
+	};
+}
+
+namespace TelehubInfo
+{
+	enum EBlock
+	{
+		BLOCK_TelehubBlock = 0,
+		BLOCK_SpawnPointBlock = 1
+	};
+	enum EVariable
+	{
+		TelehubBlock_ObjectID = 0,
+		TelehubBlock_ObjectName = 1,
+		TelehubBlock_TelehubPos = 2,
+		TelehubBlock_TelehubRot = 3,
+		SpawnPointBlock_SpawnPointPos = 0
+	};
+}
+
+namespace TeleportCancel
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_SessionID = 1
+	};
+}
+
+namespace TeleportFailed
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_Reason = 1
+	};
+}
+
+namespace TeleportFinish
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_LocationID = 1,
+		Info_SimIP = 2,
+		Info_SimPort = 3,
+		Info_RegionHandle = 4,
+		Info_SeedCapability = 5,
+		Info_SimAccess = 6,
+		Info_TeleportFlags = 7
+	};
+}
+
+namespace TeleportLandingStatusChanged
+{
+	enum EBlock
+	{
+		BLOCK_RegionData = 0
+	};
+	enum EVariable
+	{
+		RegionData_RegionHandle = 0
+	};
+}
+
+namespace TeleportLandmarkRequest
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_SessionID = 1,
+		Info_LandmarkID = 2
+	};
+}
+
+namespace TeleportLocal
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_LocationID = 1,
+		Info_Position = 2,
+		Info_LookAt = 3,
+		Info_TeleportFlags = 4
+	};
+}
+
+namespace TeleportLocationRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Info = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Info_RegionHandle = 0,
+		Info_Position = 1,
+		Info_LookAt = 2
+	};
+}
+
+namespace TeleportLureRequest
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_AgentID = 0,
+		Info_SessionID = 1,
+		Info_LureID = 2,
+		Info_TeleportFlags = 3
+	};
+}
+
+namespace TeleportProgress
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Info = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		Info_TeleportFlags = 0,
+		Info_Message = 1
+	};
+}
+
+namespace TeleportRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Info = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Info_RegionID = 0,
+		Info_Position = 1,
+		Info_LookAt = 2
+	};
+}
+
+namespace TeleportStart
+{
+	enum EBlock
+	{
+		BLOCK_Info = 0
+	};
+	enum EVariable
+	{
+		Info_TeleportFlags = 0
+	};
+}
+
+namespace TerminateFriendship
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ExBlock = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ExBlock_OtherID = 0
+	};
+}
+
+namespace TestMessage
+{
+	enum EBlock
+	{
+		BLOCK_TestBlock1 = 0,
+		BLOCK_NeighborBlock = 1
+	};
+	enum EVariable
+	{
+		TestBlock1_Test1 = 0,
+		NeighborBlock_Test0 = 0,
+		NeighborBlock_Test1 = 1,
+		NeighborBlock_Test2 = 2
+	};
+}
+
+namespace TrackAgent
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_TargetData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		TargetData_PreyID = 0
+	};
+}
+
+namespace TransferAbort
+{
+	enum EBlock
+	{
+		BLOCK_TransferInfo = 0
+	};
+	enum EVariable
+	{
+		TransferInfo_TransferID = 0,
+		TransferInfo_ChannelType = 1
+	};
+}
+
+namespace TransferInfo
+{
+	enum EBlock
+	{
+		BLOCK_TransferInfo = 0
+	};
+	enum EVariable
+	{
+		TransferInfo_TransferID = 0,
+		TransferInfo_ChannelType = 1,
+		TransferInfo_TargetType = 2,
+		TransferInfo_Status = 3,
+		TransferInfo_Size = 4,
+		TransferInfo_Params = 5
+	};
+}
+
+namespace TransferInventory
+{
+	enum EBlock
+	{
+		BLOCK_InfoBlock = 0,
+		BLOCK_InventoryBlock = 1
+	};
+	enum EVariable
+	{
+		InfoBlock_SourceID = 0,
+		InfoBlock_DestID = 1,
+		InfoBlock_TransactionID = 2,
+		InventoryBlock_InventoryID = 0,
+		InventoryBlock_Type = 1
+	};
+}
+
+namespace TransferInventoryAck
+{
+	enum EBlock
+	{
+		BLOCK_InfoBlock = 0
+	};
+	enum EVariable
+	{
+		InfoBlock_TransactionID = 0,
+		InfoBlock_InventoryID = 1
+	};
+}
+
+namespace TransferPacket
+{
+	enum EBlock
+	{
+		BLOCK_TransferData = 0
+	};
+	enum EVariable
+	{
+		TransferData_TransferID = 0,
+		TransferData_ChannelType = 1,
+		TransferData_Packet = 2,
+		TransferData_Status = 3,
+		TransferData_Data = 4
+	};
+}
+
+namespace TransferRequest
+{
+	enum EBlock
+	{
+		BLOCK_TransferInfo = 0
+	};
+	enum EVariable
+	{
+		TransferInfo_TransferID = 0,
+		TransferInfo_ChannelType = 1,
+		TransferInfo_SourceType = 2,
+		TransferInfo_Priority = 3,
+		TransferInfo_Params = 4
+	};
+}
+
+namespace UUIDGroupNameReply
+{
+	enum EBlock
+	{
+		BLOCK_UUIDNameBlock = 0
+	};
+	enum EVariable
+	{
+		UUIDNameBlock_ID = 0,
+		UUIDNameBlock_GroupName = 1
+	};
+}
+
+namespace UUIDGroupNameRequest
+{
+	enum EBlock
+	{
+		BLOCK_UUIDNameBlock = 0
+	};
+	enum EVariable
+	{
+		UUIDNameBlock_ID = 0
+	};
+}
+
+namespace UUIDNameReply
+{
+	enum EBlock
+	{
+		BLOCK_UUIDNameBlock = 0
+	};
+	enum EVariable
+	{
+		UUIDNameBlock_ID = 0,
+		UUIDNameBlock_FirstName = 1,
+		UUIDNameBlock_LastName = 2
+	};
+}
+
+namespace UUIDNameRequest
+{
+	enum EBlock
+	{
+		BLOCK_UUIDNameBlock = 0
+	};
+	enum EVariable
+	{
+		UUIDNameBlock_ID = 0
+	};
+}
+
+namespace Undo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ObjectData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_GroupID = 2,
+		ObjectData_ObjectID = 0
+	};
+}
+
+namespace UndoLand
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace UpdateAttachment
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_AttachmentBlock = 1,
+		BLOCK_OperationData = 2,
+		BLOCK_InventoryData = 3
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AttachmentBlock_AttachmentPoint = 0,
+		OperationData_AddItem = 0,
+		OperationData_UseExistingAsset = 1,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_CreatorID = 2,
+		InventoryData_OwnerID = 3,
+		InventoryData_GroupID = 4,
+		InventoryData_BaseMask = 5,
+		InventoryData_OwnerMask = 6,
+		InventoryData_GroupMask = 7,
+		InventoryData_EveryoneMask = 8,
+		InventoryData_NextOwnerMask = 9,
+		InventoryData_GroupOwned = 10,
+		InventoryData_AssetID = 11,
+		InventoryData_Type = 12,
+		InventoryData_InvType = 13,
+		InventoryData_Flags = 14,
+		InventoryData_SaleType = 15,
+		InventoryData_SalePrice = 16,
+		InventoryData_Name = 17,
+		InventoryData_Description = 18,
+		InventoryData_CreationDate = 19,
+		InventoryData_CRC = 20
+	};
+}
+
+namespace UpdateCreateInventoryItem
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SimApproved = 1,
+		AgentData_TransactionID = 2,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_CallbackID = 2,
+		InventoryData_CreatorID = 3,
+		InventoryData_OwnerID = 4,
+		InventoryData_GroupID = 5,
+		InventoryData_BaseMask = 6,
+		InventoryData_OwnerMask = 7,
+		InventoryData_GroupMask = 8,
+		InventoryData_EveryoneMask = 9,
+		InventoryData_NextOwnerMask = 10,
+		InventoryData_GroupOwned = 11,
+		InventoryData_AssetID = 12,
+		InventoryData_Type = 13,
+		InventoryData_InvType = 14,
+		InventoryData_Flags = 15,
+		InventoryData_SaleType = 16,
+		InventoryData_SalePrice = 17,
+		InventoryData_Name = 18,
+		InventoryData_Description = 19,
+		InventoryData_CreationDate = 20,
+		InventoryData_CRC = 21
+	};
+}
+
+namespace UpdateGroupInfo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_GroupData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		GroupData_GroupID = 0,
+		GroupData_Charter = 1,
+		GroupData_ShowInList = 2,
+		GroupData_InsigniaID = 3,
+		GroupData_MembershipFee = 4,
+		GroupData_OpenEnrollment = 5,
+		GroupData_AllowPublish = 6,
+		GroupData_MaturePublish = 7
+	};
+}
+
+namespace UpdateInventoryFolder
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_FolderData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		FolderData_FolderID = 0,
+		FolderData_ParentID = 1,
+		FolderData_Type = 2,
+		FolderData_Name = 3
+	};
+}
+
+namespace UpdateInventoryItem
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_InventoryData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_TransactionID = 2,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_CallbackID = 2,
+		InventoryData_CreatorID = 3,
+		InventoryData_OwnerID = 4,
+		InventoryData_GroupID = 5,
+		InventoryData_BaseMask = 6,
+		InventoryData_OwnerMask = 7,
+		InventoryData_GroupMask = 8,
+		InventoryData_EveryoneMask = 9,
+		InventoryData_NextOwnerMask = 10,
+		InventoryData_GroupOwned = 11,
+		InventoryData_TransactionID = 12,
+		InventoryData_Type = 13,
+		InventoryData_InvType = 14,
+		InventoryData_Flags = 15,
+		InventoryData_SaleType = 16,
+		InventoryData_SalePrice = 17,
+		InventoryData_Name = 18,
+		InventoryData_Description = 19,
+		InventoryData_CreationDate = 20,
+		InventoryData_CRC = 21
+	};
+}
+
+namespace UpdateMuteListEntry
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_MuteData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		MuteData_MuteID = 0,
+		MuteData_MuteName = 1,
+		MuteData_MuteType = 2,
+		MuteData_MuteFlags = 3
+	};
+}
+
+namespace UpdateParcel
+{
+	enum EBlock
+	{
+		BLOCK_ParcelData = 0
+	};
+	enum EVariable
+	{
+		ParcelData_ParcelID = 0,
+		ParcelData_RegionHandle = 1,
+		ParcelData_OwnerID = 2,
+		ParcelData_GroupOwned = 3,
+		ParcelData_Status = 4,
+		ParcelData_Name = 5,
+		ParcelData_Description = 6,
+		ParcelData_MusicURL = 7,
+		ParcelData_RegionX = 8,
+		ParcelData_RegionY = 9,
+		ParcelData_ActualArea = 10,
+		ParcelData_BillableArea = 11,
+		ParcelData_ShowDir = 12,
+		ParcelData_IsForSale = 13,
+		ParcelData_Category = 14,
+		ParcelData_SnapshotID = 15,
+		ParcelData_UserLocation = 16,
+		ParcelData_SalePrice = 17,
+		ParcelData_AuthorizedBuyerID = 18,
+		ParcelData_AllowPublish = 19,
+		ParcelData_MaturePublish = 20
+	};
+}
+
+namespace UpdateSimulator
+{
+	enum EBlock
+	{
+		BLOCK_SimulatorInfo = 0
+	};
+	enum EVariable
+	{
+		SimulatorInfo_RegionID = 0,
+		SimulatorInfo_SimName = 1,
+		SimulatorInfo_EstateID = 2,
+		SimulatorInfo_SimAccess = 3
+	};
+}
+
+namespace UpdateTaskInventory
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_UpdateData = 1,
+		BLOCK_InventoryData = 2
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		UpdateData_LocalID = 0,
+		UpdateData_Key = 1,
+		InventoryData_ItemID = 0,
+		InventoryData_FolderID = 1,
+		InventoryData_CreatorID = 2,
+		InventoryData_OwnerID = 3,
+		InventoryData_GroupID = 4,
+		InventoryData_BaseMask = 5,
+		InventoryData_OwnerMask = 6,
+		InventoryData_GroupMask = 7,
+		InventoryData_EveryoneMask = 8,
+		InventoryData_NextOwnerMask = 9,
+		InventoryData_GroupOwned = 10,
+		InventoryData_TransactionID = 11,
+		InventoryData_Type = 12,
+		InventoryData_InvType = 13,
+		InventoryData_Flags = 14,
+		InventoryData_SaleType = 15,
+		InventoryData_SalePrice = 16,
+		InventoryData_Name = 17,
+		InventoryData_Description = 18,
+		InventoryData_CreationDate = 19,
+		InventoryData_CRC = 20
+	};
+}
+
+namespace UpdateUserInfo
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_UserData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		UserData_IMViaEMail = 0,
+		UserData_DirectoryVisibility = 1
+	};
+}
+
+namespace UseCachedMuteList
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0
+	};
+}
+
+namespace UseCircuitCode
+{
+	enum EBlock
+	{
+		BLOCK_CircuitCode = 0
+	};
+	enum EVariable
+	{
+		CircuitCode_Code = 0,
+		CircuitCode_SessionID = 1,
+		CircuitCode_ID = 2
+	};
+}
+
+namespace UserInfoReply
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_UserData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		UserData_IMViaEMail = 0,
+		UserData_DirectoryVisibility = 1,
+		UserData_EMail = 2
+	};
+}
+
+namespace UserInfoRequest
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace UserReport
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ReportData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ReportData_ReportType = 0,
+		ReportData_Category = 1,
+		ReportData_Position = 2,
+		ReportData_CheckFlags = 3,
+		ReportData_ScreenshotID = 4,
+		ReportData_ObjectID = 5,
+		ReportData_AbuserID = 6,
+		ReportData_AbuseRegionName = 7,
+		ReportData_AbuseRegionID = 8,
+		ReportData_Summary = 9,
+		ReportData_Details = 10,
+		ReportData_VersionString = 11
+	};
+}
+
+namespace UserReportInternal
+{
+	enum EBlock
+	{
+		BLOCK_ReportData = 0
+	};
+	enum EVariable
+	{
+		ReportData_ReportType = 0,
+		ReportData_Category = 1,
+		ReportData_ReporterID = 2,
+		ReportData_ViewerPosition = 3,
+		ReportData_AgentPosition = 4,
+		ReportData_ScreenshotID = 5,
+		ReportData_ObjectID = 6,
+		ReportData_OwnerID = 7,
+		ReportData_LastOwnerID = 8,
+		ReportData_CreatorID = 9,
+		ReportData_RegionID = 10,
+		ReportData_AbuserID = 11,
+		ReportData_AbuseRegionName = 12,
+		ReportData_AbuseRegionID = 13,
+		ReportData_Summary = 14,
+		ReportData_Details = 15,
+		ReportData_VersionString = 16
+	};
+}
+
+namespace VelocityInterpolateOff
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace VelocityInterpolateOn
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1
+	};
+}
+
+namespace ViewerEffect
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_Effect = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		Effect_ID = 0,
+		Effect_AgentID = 1,
+		Effect_Type = 2,
+		Effect_Duration = 3,
+		Effect_Color = 4,
+		Effect_TypeData = 5
+	};
+}
+
+namespace ViewerFrozenMessage
+{
+	enum EBlock
+	{
+		BLOCK_FrozenData = 0
+	};
+	enum EVariable
+	{
+		FrozenData_Data = 0
+	};
+}
+
+namespace ViewerStartAuction
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_ParcelData = 1
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		ParcelData_LocalID = 0,
+		ParcelData_SnapshotID = 1
+	};
+}
+
+namespace ViewerStats
+{
+	enum EBlock
+	{
+		BLOCK_AgentData = 0,
+		BLOCK_DownloadTotals = 1,
+		BLOCK_NetStats = 2,
+		BLOCK_FailStats = 3,
+		BLOCK_MiscStats = 4
+	};
+	enum EVariable
+	{
+		AgentData_AgentID = 0,
+		AgentData_SessionID = 1,
+		AgentData_IP = 2,
+		AgentData_StartTime = 3,
+		AgentData_RunTime = 4,
+		AgentData_SimFPS = 5,
+		AgentData_FPS = 6,
+		AgentData_AgentsInView = 7,
+		AgentData_Ping = 8,
+		AgentData_MetersTraveled = 9,
+		AgentData_RegionsVisited = 10,
+		AgentData_SysRAM = 11,
+		AgentData_SysOS = 12,
+		AgentData_SysCPU = 13,
+		AgentData_SysGPU = 14,
+		DownloadTotals_World = 0,
+		DownloadTotals_Objects = 1,
+		DownloadTotals_Textures = 2,
+		NetStats_Bytes = 0,
+		NetStats_Packets = 1,
+		NetStats_Compressed = 2,
+		NetStats_Savings = 3,
+		FailStats_SendPacket = 0,
+		FailStats_Dropped = 1,
+		FailStats_Resent = 2,
+		FailStats_FailedResends = 3,
+		FailStats_OffCircuit = 4,
+		FailStats_Invalid = 5,
+		MiscStats_Type = 0,
+		MiscStats_Value = 1
+	};
+}
+
+}
+
+#endif
@@ -322,6 +322,20 @@ S32 receive_packet(int hSocket, char * receiveBuffer)
 	return nRet;
 }
 
+// Returns the number of datagrams received, at most one since winsock
+// has no batched receive.
+S32 receive_packets(int hSocket, char * receiveBuffers, S32 * sizes, LLHost * senders, S32 max_packets)
+{
+	S32 size = receive_packet(hSocket, receiveBuffers);
+	if (size <= 0 || max_packets < 1)
+	{
+		return 0;
+	}
+	sizes[0] = size;
+	senders[0] = get_sender();
+	return 1;
+}
+
 // Returns TRUE on success.
 BOOL send_packet(int hSocket, const char *sendBuffer, int size, U32 recipient, int nPort)
 {
@@ -492,6 +506,68 @@ int receive_packet(int hSocket, char * receiveBuffer)
 	return nRet;
 }
 
+// Returns the number of datagrams received, 0 if none.
+S32 receive_packets(int hSocket, char * receiveBuffers, S32 * sizes, LLHost * senders, S32 max_packets)
+{
+	if (max_packets < 1)
+	{
+		return 0;
+	}
+
+#if LL_LINUX && defined(MSG_WAITFORONE)
+	// recvmmsg() showed up together with MSG_WAITFORONE
+	static bool has_recvmmsg = true;
+	if (has_recvmmsg && max_packets > 1)
+	{
+		const S32 MAX_BATCH = 64;
+		struct mmsghdr msgs[MAX_BATCH];
+		struct iovec iovecs[MAX_BATCH];
+		struct sockaddr_in addrs[MAX_BATCH];
+
+		max_packets = llmin(max_packets, MAX_BATCH);
+		memset(msgs, 0, sizeof(msgs[0]) * max_packets);
+		for (S32 i = 0; i < max_packets; i++)
+		{
+			iovecs[i].iov_base = receiveBuffers + i * NET_BUFFER_SIZE;
+			iovecs[i].iov_len = NET_BUFFER_SIZE;
+			msgs[i].msg_hdr.msg_iov = &iovecs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			msgs[i].msg_hdr.msg_name = &addrs[i];
+			msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+		}
+
+		int count = recvmmsg(hSocket, msgs, max_packets, MSG_DONTWAIT, NULL);
+		if (count > 0)
+		{
+			for (S32 i = 0; i < count; i++)
+			{
+				sizes[i] = msgs[i].msg_len;
+				senders[i] = LLHost(addrs[i].sin_addr.s_addr, ntohs(addrs[i].sin_port));
+			}
+			// keep get_sender() in step with receive_packet()
+			stSrcAddr = addrs[count - 1];
+			return count;
+		}
+		if (errno != ENOSYS)
+		{
+			// nothing waiting, or an error receive_packet() would also hide
+			return 0;
+		}
+		llinfos << "recvmmsg() not supported, receiving one packet per call" << llendl;
+		has_recvmmsg = false;
+	}
+#endif
+
+	S32 size = receive_packet(hSocket, receiveBuffers);
+	if (size <= 0)
+	{
+		return 0;
+	}
+	sizes[0] = size;
+	senders[0] = get_sender();
+	return 1;
+}
+
 BOOL send_packet(int hSocket, const char * sendBuffer, int size, U32 recipient, int nPort)
 {
 	int		ret;
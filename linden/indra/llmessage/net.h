@@ -48,6 +48,12 @@ void	end_net(S32& socket_out);
 // returns size of packet or -1 in case of error
 S32		receive_packet(int hSocket, char * receiveBuffer);
 
+// Receives up to max_packets datagrams with as few system calls as the
+// platform allows (recvmmsg on Linux).  receiveBuffers holds max_packets
+// buffers of NET_BUFFER_SIZE bytes each, sizes and senders are filled in
+// per datagram.  Returns the number of datagrams received, 0 if none.
+S32		receive_packets(int hSocket, char * receiveBuffers, S32 * sizes, LLHost * senders, S32 max_packets);
+
 BOOL	send_packet(int hSocket, const char *sendBuffer, int size, U32 recipient, int nPort);	// Returns TRUE on success.
 
 //void	get_sender(char * tmp);
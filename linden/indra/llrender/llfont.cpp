@@ -141,6 +141,8 @@ LLFont::LLFont(LLImageRaw *imagep)
 	mFallbackFontp = NULL;
 	mIsFallback = FALSE;
 	mFTFace = NULL;
+	mHasKerning = FALSE;
+	memset(mGlyphPages, 0, sizeof(mGlyphPages));
 }
 
 
@@ -155,6 +157,10 @@ LLFont::~LLFont()
 
 	// Delete glyph info
 	std::for_each(mCharGlyphInfoMap.begin(), mCharGlyphInfoMap.end(), DeletePairedPointer());
+	for (S32 i = 0; i < GLYPH_PAGE_COUNT; i++)
+	{
+		delete[] mGlyphPages[i];
+	}
 }
 
 void LLFont::setRawImage(LLImageRaw *imagep)
@@ -235,6 +241,7 @@ BOOL LLFont::loadFace(const std::string& filename, const F32 point_size, const F
 
 	mMaxCharWidth = llround(0.5f + (x_max - x_min));
 	mMaxCharHeight = llround(0.5f + (y_max - y_min));
+	mHasKerning = FT_HAS_KERNING(mFTFace) ? TRUE : FALSE;
 
 	if (!mFTFace->charmap)
 	{
@@ -317,6 +324,12 @@ void LLFont::resetBitmap()
 
 LLFontGlyphInfo* LLFont::getGlyphInfo(const llwchar wch) const
 {
+	if (wch < GLYPH_PAGE_SIZE * GLYPH_PAGE_COUNT)
+	{
+		LLFontGlyphInfo** page = mGlyphPages[wch / GLYPH_PAGE_SIZE];
+		return page ? page[wch % GLYPH_PAGE_SIZE] : NULL;
+	}
+
 	char_glyph_info_map_t::iterator iter = mCharGlyphInfoMap.find(wch);
 	if (iter != mCharGlyphInfoMap.end())
 	{
@@ -371,8 +384,8 @@ BOOL LLFont::addChar(const llwchar wch)
 		}
 	}
 	
-	char_glyph_info_map_t::iterator iter = mCharGlyphInfoMap.find(wch);
-	if (iter == mCharGlyphInfoMap.end() || !(iter->second->mIsRendered))
+	LLFontGlyphInfo* gi = getGlyphInfo(wch);
+	if (!gi || !gi->mIsRendered)
 	{
 		BOOL result = addGlyph(wch, glyph_index);
 		//imdebug("luma b=8 w=%d h=%d t=%s %p", mRawImagep->getWidth(), mRawImagep->getHeight(), mName.c_str(), mRawImagep->getData());
@@ -393,6 +406,17 @@ void LLFont::insertGlyphInfo(llwchar wch, LLFontGlyphInfo* gi) const
 	{
 		mCharGlyphInfoMap[wch] = gi;
 	}
+
+	if (wch < GLYPH_PAGE_SIZE * GLYPH_PAGE_COUNT)
+	{
+		LLFontGlyphInfo**& page = mGlyphPages[wch / GLYPH_PAGE_SIZE];
+		if (!page)
+		{
+			page = new LLFontGlyphInfo*[GLYPH_PAGE_SIZE];
+			memset(page, 0, GLYPH_PAGE_SIZE * sizeof(LLFontGlyphInfo*));
+		}
+		page[wch % GLYPH_PAGE_SIZE] = gi;
+	}
 }
 
 BOOL LLFont::addGlyphFromFont(LLFont *fontp, const llwchar wch, const U32 glyph_index)
@@ -560,16 +584,11 @@ F32 LLFont::getXAdvance(const llwchar wch) const
 		(const_cast<LLFont *>(fontp))->renderGlyph(glyph_index);
 
 		// Create the entry if it's not there
-		char_glyph_info_map_t::iterator iter2 = mCharGlyphInfoMap.find(wch);
-		if (iter2 == mCharGlyphInfoMap.end())
+		if (!gi)
 		{
 			gi = new LLFontGlyphInfo(glyph_index);
 			insertGlyphInfo(wch, gi);
 		}
-		else
-		{
-			gi = iter2->second;
-		}
 		
 		gi->mWidth = fontp->mFTFace->glyph->bitmap.width;
 		gi->mHeight = fontp->mFTFace->glyph->bitmap.rows;
@@ -582,7 +601,7 @@ F32 LLFont::getXAdvance(const llwchar wch) const
 	}
 	else
 	{
-		gi = get_if_there(mCharGlyphInfoMap, (llwchar)0, (LLFontGlyphInfo*)NULL);
+		gi = getGlyphInfo(0);
 		if (gi)
 		{
 			return gi->mXAdvance;
@@ -609,14 +628,14 @@ void LLFont::renderGlyph(const U32 glyph_index)
 
 F32 LLFont::getXKerning(const llwchar char_left, const llwchar char_right) const
 {
-	if (mFTFace == NULL)
+	if (mFTFace == NULL || !mHasKerning)
 		return 0.0;
 
 	llassert(!mIsFallback);
-	LLFontGlyphInfo* left_glyph_info = get_if_there(mCharGlyphInfoMap, char_left, (LLFontGlyphInfo*)NULL);
+	LLFontGlyphInfo* left_glyph_info = getGlyphInfo(char_left);
 	U32 left_glyph = left_glyph_info ? left_glyph_info->mGlyphIndex : 0;
 	// Kern this puppy.
-	LLFontGlyphInfo* right_glyph_info = get_if_there(mCharGlyphInfoMap, char_right, (LLFontGlyphInfo*)NULL);
+	LLFontGlyphInfo* right_glyph_info = getGlyphInfo(char_right);
 	U32 right_glyph = right_glyph_info ? right_glyph_info->mGlyphIndex : 0;
 
 	FT_Vector  delta;
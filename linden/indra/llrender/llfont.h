@@ -179,6 +179,18 @@ protected:
 	typedef std::map<llwchar, LLFontGlyphInfo*> char_glyph_info_map_t;
 	mutable char_glyph_info_map_t mCharGlyphInfoMap; // Information about glyph location in bitmap
 
+	// Direct index into mCharGlyphInfoMap for the Basic Multilingual Plane,
+	// which the map remains the owner of and the only lookup for beyond it.
+	// Pages of GLYPH_PAGE_SIZE characters are allocated on first use.
+	enum
+	{
+		GLYPH_PAGE_SIZE = 256,
+		GLYPH_PAGE_COUNT = 256
+	};
+	mutable LLFontGlyphInfo** mGlyphPages[GLYPH_PAGE_COUNT];
+
+	BOOL mHasKerning;	// FT_Get_Kerning() returns nothing for fonts without a kern table
+
 	BOOL mValid;
 	void setSubImageLuminanceAlpha(const U32 x,
 				       const U32 y,
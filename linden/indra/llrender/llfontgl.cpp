@@ -92,6 +92,31 @@ F32 llfont_round_y(F32 y)
 	return y;
 }
 
+// render() collects glyph quads and submits them to gGL in batches
+const S32 GLYPH_BATCH_SIZE = 32;
+const S32 MAX_QUADS_PER_GLYPH = 6;	// soft drop shadow: five shadow quads and the glyph
+const S32 MAX_BATCH_QUADS = GLYPH_BATCH_SIZE * MAX_QUADS_PER_GLYPH;
+
+// Same conversion as gGL.color4fv()
+static LLColor4U font_color4u(const LLColor4& color)
+{
+	return LLColor4U((U8)(llclamp(color.mV[VRED], 0.f, 1.f) * 255),
+					 (U8)(llclamp(color.mV[VGREEN], 0.f, 1.f) * 255),
+					 (U8)(llclamp(color.mV[VBLUE], 0.f, 1.f) * 255),
+					 (U8)(llclamp(color.mV[VALPHA], 0.f, 1.f) * 255));
+}
+
+static void flush_glyph_batch(S32& quad_count, const LLVector3* vertices, const LLVector2* uvs, const LLColor4U* colors)
+{
+	if (quad_count > 0)
+	{
+		gGL.begin(LLRender::QUADS);
+		gGL.vertexBatchPreTransformed(vertices, uvs, colors, quad_count * 4);
+		gGL.end();
+		quad_count = 0;
+	}
+}
+
 // static
 U8 LLFontGL::getStyleFromString(const std::string &style)
 {
@@ -620,6 +645,23 @@ S32 LLFontGL::render(const LLWString &wstr,
 		}
 	}
 
+	// Shadows fade with the text, embedded images are drawn in white
+	F32 shadow_alpha = drop_shadow_strength * ((style & DROP_SHADOW_SOFT) ? DROP_SHADOW_SOFT_STRENGTH : 1.f);
+	LLColor4 shadow_color = LLFontGL::sShadowColor;
+	shadow_color.mV[VALPHA] = color.mV[VALPHA] * shadow_alpha;
+	LLColor4 ext_shadow_color = LLFontGL::sShadowColor;
+	ext_shadow_color.mV[VALPHA] = shadow_alpha;
+	const LLColor4U text_color_u = font_color4u(color);
+	const LLColor4U shadow_color_u = font_color4u(shadow_color);
+	const LLColor4U ext_color_u = font_color4u(LLColor4::white);
+	const LLColor4U ext_shadow_color_u = font_color4u(ext_shadow_color);
+	const F32 slant_offset = (style & ITALIC) ? -mAscender * 0.2f : 0.f;
+
+	LLVector3 vertices[MAX_BATCH_QUADS * 4];
+	LLVector2 uvs[MAX_BATCH_QUADS * 4];
+	LLColor4U colors[MAX_BATCH_QUADS * 4];
+	S32 quad_count = 0;
+
 	gGL.pushMatrix();
 	glLoadIdentity();
 	gGL.translatef(floorf(sCurOrigin.mX*sScaleX), floorf(sCurOrigin.mY*sScaleY), sCurOrigin.mZ);
@@ -761,13 +803,17 @@ S32 LLFontGL::render(const LLWString &wstr,
 				break;
 			}
 
+			// the image needs its own texture, so draw what we have so far
+			flush_glyph_batch(quad_count, vertices, uvs, colors);
+
 			gGL.getTexUnit(0)->bind(ext_image);
 			const F32 ext_x = cur_render_x + (EXT_X_BEARING * sScaleX);
 			const F32 ext_y = cur_render_y + (EXT_Y_BEARING * sScaleY + mAscender - mLineHeight);
 
 			LLRectf uv_rect(0.f, 1.f, 1.f, 0.f);
 			LLRectf screen_rect(ext_x, ext_y + ext_height, ext_x + ext_width, ext_y);
-			drawGlyph(screen_rect, uv_rect, LLColor4::white, style, drop_shadow_strength);
+			drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, ext_color_u, ext_shadow_color_u, style, slant_offset);
+			flush_glyph_batch(quad_count, vertices, uvs, colors);
 
 			if (!label.empty())
 			{
@@ -801,6 +847,8 @@ S32 LLFontGL::render(const LLWString &wstr,
 		{
 			if (!hasGlyph(wch))
 			{
+				// adding a glyph can rebuild the bitmap under the batched ones
+				flush_glyph_batch(quad_count, vertices, uvs, colors);
 				(const_cast<LLFontGL*>(this))->addChar(wch);
 			}
 
@@ -818,16 +866,15 @@ S32 LLFontGL::render(const LLWString &wstr,
 
 			// Draw the text at the appropriate location
 			//Specify vertices and texture coordinates
-			LLRectf uv_rect((fgi->mXBitmapOffset - PAD_AMT) * inv_width,
-							(fgi->mYBitmapOffset + fgi->mHeight + PAD_AMT) * inv_height,
-							(fgi->mXBitmapOffset + fgi->mWidth + PAD_AMT) * inv_width,
-							(fgi->mYBitmapOffset - PAD_AMT) * inv_height);
-			LLRectf screen_rect(cur_render_x + (F32)fgi->mXBearing - PAD_AMT,
-								cur_render_y + (F32)fgi->mYBearing + PAD_AMT,
-								cur_render_x + (F32)fgi->mXBearing + (F32)fgi->mWidth + PAD_AMT,
-								cur_render_y + (F32)fgi->mYBearing - (F32)fgi->mHeight - PAD_AMT);
+			LLRectf screen_rect;
+			LLRectf uv_rect;
+			getGlyphRects(fgi, cur_render_x, cur_render_y, inv_width, inv_height, screen_rect, uv_rect);
 
-			drawGlyph(screen_rect, uv_rect, color, style, drop_shadow_strength);
+			if (quad_count > MAX_BATCH_QUADS - MAX_QUADS_PER_GLYPH)
+			{
+				flush_glyph_batch(quad_count, vertices, uvs, colors);
+			}
+			drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, text_color_u, shadow_color_u, style, slant_offset);
 
 			chars_drawn++;
 			cur_x += fgi->mXAdvance;
@@ -839,6 +886,7 @@ S32 LLFontGL::render(const LLWString &wstr,
 				// Kern this puppy.
 				if (!hasGlyph(next_char))
 				{
+					flush_glyph_batch(quad_count, vertices, uvs, colors);
 					(const_cast<LLFontGL*>(this))->addChar(next_char);
 				}
 				cur_x += getXKerning(wch, next_char);
@@ -856,6 +904,8 @@ S32 LLFontGL::render(const LLWString &wstr,
 		}
 	}
 
+	flush_glyph_batch(quad_count, vertices, uvs, colors);
+
 	if (right_x)
 	{
 		*right_x = cur_x / sScaleX;
@@ -1335,97 +1385,104 @@ void LLFontGL::removeEmbeddedChar( llwchar wc )
 }
 
 
-void LLFontGL::renderQuad(const LLRectf& screen_rect, const LLRectf& uv_rect, F32 slant_amt) const
+// static
+void LLFontGL::getGlyphRects(const LLFontGlyphInfo* fgi, F32 x, F32 y, F32 inv_width, F32 inv_height,
+							 LLRectf& screen_rect, LLRectf& uv_rect)
 {
-	gGL.texCoord2f(uv_rect.mRight, uv_rect.mTop);
-	gGL.vertex2f(llfont_round_x(screen_rect.mRight), 
-				llfont_round_y(screen_rect.mTop));
+	uv_rect = LLRectf((fgi->mXBitmapOffset - PAD_AMT) * inv_width,
+					  (fgi->mYBitmapOffset + fgi->mHeight + PAD_AMT) * inv_height,
+					  (fgi->mXBitmapOffset + fgi->mWidth + PAD_AMT) * inv_width,
+					  (fgi->mYBitmapOffset - PAD_AMT) * inv_height);
+	screen_rect = LLRectf(x + (F32)fgi->mXBearing - PAD_AMT,
+						  y + (F32)fgi->mYBearing + PAD_AMT,
+						  x + (F32)fgi->mXBearing + (F32)fgi->mWidth + PAD_AMT,
+						  y + (F32)fgi->mYBearing - (F32)fgi->mHeight - PAD_AMT);
+}
 
-	gGL.texCoord2f(uv_rect.mLeft, uv_rect.mTop);
-	gGL.vertex2f(llfont_round_x(screen_rect.mLeft), 
-				llfont_round_y(screen_rect.mTop));
+// static
+void LLFontGL::renderQuad(LLVector3* vertex_out, LLVector2* uv_out, LLColor4U* colors_out,
+						  const LLRectf& screen_rect, const LLRectf& uv_rect, const LLColor4U& color, F32 slant_amt)
+{
+	vertex_out[0] = LLVector3(llfont_round_x(screen_rect.mRight), llfont_round_y(screen_rect.mTop), 0.f);
+	uv_out[0] = LLVector2(uv_rect.mRight, uv_rect.mTop);
+	colors_out[0] = color;
+
+	vertex_out[1] = LLVector3(llfont_round_x(screen_rect.mLeft), llfont_round_y(screen_rect.mTop), 0.f);
+	uv_out[1] = LLVector2(uv_rect.mLeft, uv_rect.mTop);
+	colors_out[1] = color;
 
-	gGL.texCoord2f(uv_rect.mLeft, uv_rect.mBottom);
-	gGL.vertex2f(llfont_round_x(screen_rect.mLeft + slant_amt), 
-				llfont_round_y(screen_rect.mBottom));
+	vertex_out[2] = LLVector3(llfont_round_x(screen_rect.mLeft + slant_amt), llfont_round_y(screen_rect.mBottom), 0.f);
+	uv_out[2] = LLVector2(uv_rect.mLeft, uv_rect.mBottom);
+	colors_out[2] = color;
 
-	gGL.texCoord2f(uv_rect.mRight, uv_rect.mBottom);
-	gGL.vertex2f(llfont_round_x(screen_rect.mRight + slant_amt), 
-				llfont_round_y(screen_rect.mBottom));
+	vertex_out[3] = LLVector3(llfont_round_x(screen_rect.mRight + slant_amt), llfont_round_y(screen_rect.mBottom), 0.f);
+	uv_out[3] = LLVector2(uv_rect.mRight, uv_rect.mBottom);
+	colors_out[3] = color;
 }
 
-void LLFontGL::drawGlyph(const LLRectf& screen_rect, const LLRectf& uv_rect, const LLColor4& color, U8 style, F32 drop_shadow_strength) const
+// static
+void LLFontGL::drawGlyph(S32& quad_count, LLVector3* vertex_out, LLVector2* uv_out, LLColor4U* colors_out,
+						 const LLRectf& screen_rect, const LLRectf& uv_rect,
+						 const LLColor4U& color, const LLColor4U& shadow_color, U8 style, F32 slant_offset)
 {
-	F32 slant_offset;
-	slant_offset = ((style & ITALIC) ? ( -mAscender * 0.2f) : 0.f);
-
-	gGL.begin(LLRender::QUADS);
+	//FIXME: bold and drop shadow are mutually exclusive only for convenience
+	//Allow both when we need them.
+	if (style & BOLD)
 	{
-		//FIXME: bold and drop shadow are mutually exclusive only for convenience
-		//Allow both when we need them.
-		if (style & BOLD)
+		for (S32 pass = 0; pass < 2; pass++)
 		{
-			gGL.color4fv(color.mV);
-			for (S32 pass = 0; pass < 2; pass++)
-			{
-				LLRectf screen_rect_offset = screen_rect;
+			LLRectf screen_rect_offset = screen_rect;
 
-				screen_rect_offset.translate((F32)(pass * BOLD_OFFSET), 0.f);
-				renderQuad(screen_rect_offset, uv_rect, slant_offset);
-			}
+			screen_rect_offset.translate((F32)(pass * BOLD_OFFSET), 0.f);
+			renderQuad(&vertex_out[quad_count * 4], &uv_out[quad_count * 4], &colors_out[quad_count * 4], screen_rect_offset, uv_rect, color, slant_offset);
+			quad_count++;
 		}
-		else if (style & DROP_SHADOW_SOFT)
+	}
+	else if (style & DROP_SHADOW_SOFT)
+	{
+		for (S32 pass = 0; pass < 5; pass++)
 		{
-			LLColor4 shadow_color = LLFontGL::sShadowColor;
-			shadow_color.mV[VALPHA] = color.mV[VALPHA] * drop_shadow_strength * DROP_SHADOW_SOFT_STRENGTH;
-			gGL.color4fv(shadow_color.mV);
-			for (S32 pass = 0; pass < 5; pass++)
-			{
-				LLRectf screen_rect_offset = screen_rect;
+			LLRectf screen_rect_offset = screen_rect;
 
-				switch(pass)
-				{
-				case 0:
-					screen_rect_offset.translate(-1.f, -1.f);
-					break;
-				case 1:
-					screen_rect_offset.translate(1.f, -1.f);
-					break;
-				case 2:
-					screen_rect_offset.translate(1.f, 1.f);
-					break;
-				case 3:
-					screen_rect_offset.translate(-1.f, 1.f);
-					break;
-				case 4:
-					screen_rect_offset.translate(0, -2.f);
-					break;
-				}
-			
-				renderQuad(screen_rect_offset, uv_rect, slant_offset);
+			switch(pass)
+			{
+			case 0:
+				screen_rect_offset.translate(-1.f, -1.f);
+				break;
+			case 1:
+				screen_rect_offset.translate(1.f, -1.f);
+				break;
+			case 2:
+				screen_rect_offset.translate(1.f, 1.f);
+				break;
+			case 3:
+				screen_rect_offset.translate(-1.f, 1.f);
+				break;
+			case 4:
+				screen_rect_offset.translate(0, -2.f);
+				break;
 			}
-			gGL.color4fv(color.mV);
-			renderQuad(screen_rect, uv_rect, slant_offset);
-		}
-		else if (style & DROP_SHADOW)
-		{
-			LLColor4 shadow_color = LLFontGL::sShadowColor;
-			shadow_color.mV[VALPHA] = color.mV[VALPHA] * drop_shadow_strength;
-			gGL.color4fv(shadow_color.mV);
-			LLRectf screen_rect_shadow = screen_rect;
-			screen_rect_shadow.translate(1.f, -1.f);
-			renderQuad(screen_rect_shadow, uv_rect, slant_offset);
-			gGL.color4fv(color.mV);
-			renderQuad(screen_rect, uv_rect, slant_offset);
-		}
-		else // normal rendering
-		{
-			gGL.color4fv(color.mV);
-			renderQuad(screen_rect, uv_rect, slant_offset);
+		
+			renderQuad(&vertex_out[quad_count * 4], &uv_out[quad_count * 4], &colors_out[quad_count * 4], screen_rect_offset, uv_rect, shadow_color, slant_offset);
+			quad_count++;
 		}
-
+		renderQuad(&vertex_out[quad_count * 4], &uv_out[quad_count * 4], &colors_out[quad_count * 4], screen_rect, uv_rect, color, slant_offset);
+		quad_count++;
+	}
+	else if (style & DROP_SHADOW)
+	{
+		LLRectf screen_rect_shadow = screen_rect;
+		screen_rect_shadow.translate(1.f, -1.f);
+		renderQuad(&vertex_out[quad_count * 4], &uv_out[quad_count * 4], &colors_out[quad_count * 4], screen_rect_shadow, uv_rect, shadow_color, slant_offset);
+		quad_count++;
+		renderQuad(&vertex_out[quad_count * 4], &uv_out[quad_count * 4], &colors_out[quad_count * 4], screen_rect, uv_rect, color, slant_offset);
+		quad_count++;
+	}
+	else // normal rendering
+	{
+		renderQuad(&vertex_out[quad_count * 4], &uv_out[quad_count * 4], &colors_out[quad_count * 4], screen_rect, uv_rect, color, slant_offset);
+		quad_count++;
 	}
-	gGL.end();
 }
 
 // static
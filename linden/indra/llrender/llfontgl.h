@@ -40,6 +40,8 @@
 #include "llrect.h"
 
 class LLColor4;
+class LLColor4U;
+class LLVector3;
 
 class LLFontGL : public LLFont
 {
@@ -216,8 +218,16 @@ protected:
 	const embedded_data_t* getEmbeddedCharData(const llwchar wch) const;
 	F32 getEmbeddedCharAdvance(const embedded_data_t* ext_data) const;
 	void clearEmbeddedChars();
-	void renderQuad(const LLRectf& screen_rect, const LLRectf& uv_rect, F32 slant_amt) const;
-	void drawGlyph(const LLRectf& screen_rect, const LLRectf& uv_rect, const LLColor4& color, U8 style, F32 drop_shadow_fade) const;
+	// Glyph quads are written to the caller's arrays, which render() hands
+	// to gGL a batch at a time. No font or GL state is involved, so the
+	// unit tests can build quads without a GL context.
+	static void getGlyphRects(const LLFontGlyphInfo* fgi, F32 x, F32 y, F32 inv_width, F32 inv_height,
+							  LLRectf& screen_rect, LLRectf& uv_rect);
+	static void renderQuad(LLVector3* vertex_out, LLVector2* uv_out, LLColor4U* colors_out,
+						   const LLRectf& screen_rect, const LLRectf& uv_rect, const LLColor4U& color, F32 slant_amt);
+	static void drawGlyph(S32& quad_count, LLVector3* vertex_out, LLVector2* uv_out, LLColor4U* colors_out,
+						  const LLRectf& screen_rect, const LLRectf& uv_rect,
+						  const LLColor4U& color, const LLColor4U& shadow_color, U8 style, F32 slant_offset);
 
 public:
 	static F32 sVertDPI;
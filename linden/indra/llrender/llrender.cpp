@@ -944,6 +944,36 @@ void LLRender::color3fv(const GLfloat* c)
 	color4f(c[0],c[1],c[2],1);
 }
 
+void LLRender::vertexBatchPreTransformed(const LLVector3* verts, const LLVector2* uvs, const LLColor4U* colors, S32 vert_count)
+{
+	//the range of mVerticesp, mColorsp and mTexcoordsp is [0, 4095]
+	if (mCount + vert_count > 4094)
+	{
+		flush();
+		if (vert_count > 4094)
+		{
+			llwarns << "GL immediate mode overflow.  Some geometry not drawn." << llendl;
+			return;
+		}
+	}
+	if (vert_count <= 0)
+	{
+		return;
+	}
+
+	for (S32 i = 0; i < vert_count; i++)
+	{
+		mVerticesp[mCount] = verts[i];
+		mTexcoordsp[mCount] = uvs[i];
+		mColorsp[mCount] = colors[i];
+		mCount++;
+	}
+
+	mVerticesp[mCount] = mVerticesp[mCount-1];
+	mColorsp[mCount] = mColorsp[mCount-1];
+	mTexcoordsp[mCount] = mTexcoordsp[mCount-1];
+}
+
 void LLRender::debugTexUnits(void)
 {
 	LL_INFOS("TextureUnit") << "Active TexUnit: " << mCurrTextureUnitIndex << LL_ENDL;
@@ -275,6 +275,10 @@ public:
 	void color3fv(const GLfloat* c);
 	void color4ubv(const GLubyte* c);
 
+	// Appends vert_count ready-made vertices in one go, flushing first if
+	// they would not fit
+	void vertexBatchPreTransformed(const LLVector3* verts, const LLVector2* uvs, const LLColor4U* colors, S32 vert_count);
+
 	void setColorMask(bool writeColor, bool writeAlpha);
 	void setColorMask(bool writeColorR, bool writeColorG, bool writeColorB, bool writeAlpha);
 	void setSceneBlendType(eBlendType type);
@@ -39,6 +39,8 @@
 // other library includes
 #include "llcontrol.h"
 #include "lldir.h"
+#include "lltimer.h"
+#include "llxmlnodecache.h"
 #include "v4color.h"
 
 // this library includes
@@ -162,7 +164,7 @@ bool LLUICtrlFactory::getLayeredXMLNode(const std::string &xui_filename, LLXMLNo
 		return false;
 	}
 
-	if (!LLXMLNode::parseFile(full_filename, root, NULL))
+	if (!LLXMLNodeCache::parseFile(full_filename, root, NULL))
 	{
 		// try filename as passed in since sometimes we load an xml file from a user-supplied path
 		if (!LLXMLNode::parseFile(xui_filename, root, NULL))
@@ -188,7 +190,7 @@ bool LLUICtrlFactory::getLayeredXMLNode(const std::string &xui_filename, LLXMLNo
 			continue;
 		}
 
-		if (!LLXMLNode::parseFile(layer_filename, updateRoot, NULL))
+		if (!LLXMLNodeCache::parseFile(layer_filename, updateRoot, NULL))
 		{
 			llwarns << "Problem reading localized UI description file: " << (*itor) + gDirUtilp->getDirDelimiter() + xui_filename << llendl;
 			return false;
@@ -213,6 +215,7 @@ bool LLUICtrlFactory::getLayeredXMLNode(const std::string &xui_filename, LLXMLNo
 void LLUICtrlFactory::buildFloater(LLFloater* floaterp, const std::string& filename, 
 									const LLCallbackMap::map_t* factory_map, BOOL open) /* Flawfinder: ignore */
 {
+	LLTimer build_timer;
 	LLXMLNodePtr root;
 
 	if (!LLUICtrlFactory::getLayeredXMLNode(filename, root))
@@ -246,6 +249,9 @@ void LLUICtrlFactory::buildFloater(LLFloater* floaterp, const std::string& filen
 
 	LLHandle<LLFloater> handle = floaterp->getHandle();
 	mBuiltFloaters[handle] = filename;
+
+	LL_DEBUGS("XUI") << "Built floater " << filename << " in "
+					 << build_timer.getElapsedTimeF32() * 1000.f << " ms" << LL_ENDL;
 }
 
 //-----------------------------------------------------------------------------
@@ -46,10 +46,15 @@
     
 #include "llvfs.h"
 #include "llstl.h"
+#include "lltimer.h"
     
 const S32 FILE_BLOCK_MASK = 0x000003FF;	 // 1024-byte blocks
 const S32 VFS_CLEANUP_SIZE = 5242880;  // how much space we free up in a single stroke
 const S32 BLOCK_LENGTH_INVALID = -1;	// mLength for invalid LLVFSFileBlocks
+const S32 MOVE_CHUNK_SIZE = 65536;		// file data is moved this much at a time
+// compact() leaves bigger files where they are, so that one move holds the
+// data lock for no more than a few chunks
+const S32 COMPACT_MAX_MOVE = 4 * MOVE_CHUNK_SIZE;
 
 LLVFS *gVFS = NULL;
 
@@ -173,7 +178,8 @@ public:
 		buffer += 4;
 		swizzleCopy(buffer, &mLength, 4);
 		buffer +=4;
-		swizzleCopy(buffer, &mAccessTime, 4);
+		U32 access_time = mAccessTime;
+		swizzleCopy(buffer, &access_time, 4);
 		buffer +=4;
 		memcpy(buffer, &mFileID.mData, 16); /* Flawfinder: ignore */	
 		buffer += 16;
@@ -191,7 +197,9 @@ public:
 		buffer += 4;
 		swizzleCopy(&mLength, buffer, 4);
 		buffer += 4;
-		swizzleCopy(&mAccessTime, buffer, 4);
+		U32 access_time;
+		swizzleCopy(&access_time, buffer, 4);
+		mAccessTime = access_time;
 		buffer += 4;
 		memcpy(&mFileID.mData, buffer, 16);
 		buffer += 16;
@@ -213,7 +221,7 @@ public:
 public:
 	S32  mSize;
 	S32  mIndexLocation; // location of index entry
-	U32  mAccessTime;
+	LLAtomicU32 mAccessTime; // stamped by lookups holding the data lock only for reading
 	BOOL mLocks[VFSLOCK_COUNT]; // number of outstanding locks of each type
     
 	static const S32 SERIAL_SIZE;
@@ -233,9 +241,15 @@ const S32 LLVFSFileBlock::SERIAL_SIZE = 34;
      
     
 LLVFS::LLVFS(const std::string& index_filename, const std::string& data_filename, const BOOL read_only, const U32 presize, const BOOL remove_after_crash)
-:	mRemoveAfterCrash(remove_after_crash)
+:	mRemoveAfterCrash(remove_after_crash),
+	mCompacting(FALSE),
+	mCompactLocation(0),
+	mCompactMoves(0),
+	mCompactBytes(0),
+	mGrowthMoves(0),
+	mGrowthBytes(0)
 {
-	mDataMutex = new LLMutex(0);
+	mDataMutex = new LLRWMutex(0);
 
 	S32 i;
 	for (i = 0; i < VFSLOCK_COUNT; i++)
@@ -523,6 +537,13 @@ LLVFS::LLVFS(const std::string& index_filename, const std::string& data_filename
 			{
 				addFreeBlock(new LLVFSBlock(loc, data_size - loc));
 			}
+
+			// index the files that survived the checks by location
+			for (fileblock_map::iterator it = mFileBlocks.begin(); it != mFileBlocks.end(); ++it)
+			{
+				LLVFSFileBlock *block = (*it).second;
+				mFileBlocksByLocation.insert(fileblock_location_map_t::value_type(block->mLocation, block));
+			}
 		}
 		else // There where no blocks in the file.
 		{
@@ -569,6 +590,8 @@ LLVFS::LLVFS(const std::string& index_filename, const std::string& data_filename
 		}
 	}
 
+	mDataFile.attach(mDataFP);
+
 	LL_WARNS("VFS") << "Using index file " << mIndexFilename << LL_ENDL;
 	LL_WARNS("VFS") << "Using data file " << mDataFilename << LL_ENDL;
 
@@ -591,11 +614,13 @@ LLVFS::~LLVFS()
 		delete (*it).second;
 	}
 	mFileBlocks.clear();
+	mFileBlocksByLocation.clear();
 	
 	mFreeBlocksByLength.clear();
 
 	for_each(mFreeBlocksByLocation.begin(), mFreeBlocksByLocation.end(), DeletePairedPointer());
     
+	mDataFile.close();
 	unlockAndClose(mDataFP);
 	mDataFP = NULL;
     
@@ -645,7 +670,7 @@ BOOL LLVFS::getExists(const LLUUID &file_id, const LLAssetType::EType file_type)
 		llerrs << "Attempting to use invalid VFS!" << llendl;
 	}
 
-	lockData();
+	readLockData();
 	
 	LLVFSFileSpecifier spec(file_id, file_type);
 	fileblock_map::iterator it = mFileBlocks.find(spec);
@@ -672,7 +697,7 @@ S32	 LLVFS::getSize(const LLUUID &file_id, const LLAssetType::EType file_type)
 
 	}
 
-	lockData();
+	readLockData();
 	
 	LLVFSFileSpecifier spec(file_id, file_type);
 	fileblock_map::iterator it = mFileBlocks.find(spec);
@@ -698,7 +723,7 @@ S32  LLVFS::getMaxSize(const LLUUID &file_id, const LLAssetType::EType file_type
 		llerrs << "Attempting to use invalid VFS!" << llendl;
 	}
 
-	lockData();
+	readLockData();
 	
 	LLVFSFileSpecifier spec(file_id, file_type);
 	fileblock_map::iterator it = mFileBlocks.find(spec);
@@ -819,8 +844,22 @@ BOOL LLVFS::setMaxSize(const LLUUID &file_id, const LLAssetType::EType file_type
 				}
 			}
 			
-			// no adjecent free block, find one in the list
-			free_block = findFreeBlock(max_size, block);
+			// no adjecent free block, so the file has to move. Prefer the
+			// free space at the end of the data file, which compact()
+			// coalesces, so that the file can go on growing in place there.
+			free_block = NULL;
+			if (!mFreeBlocksByLocation.empty())
+			{
+				LLVFSBlock *last_free_block = mFreeBlocksByLocation.rbegin()->second;
+				if (last_free_block->mLength >= max_size)
+				{
+					free_block = last_free_block;
+				}
+			}
+			if (!free_block)
+			{
+				free_block = findFreeBlock(max_size, block);
+			}
     
 			if (free_block)
 			{
@@ -834,24 +873,15 @@ BOOL LLVFS::setMaxSize(const LLUUID &file_id, const LLAssetType::EType file_type
 					if (block->mSize > 0)
 					{
 						// move the file into the new block
-						U8 *buffer = new U8[block->mSize];
-						fseek(mDataFP, block->mLocation, SEEK_SET);
-						if (fread(buffer, block->mSize, 1, mDataFP) == 1)
-						{
-							fseek(mDataFP, free_block->mLocation, SEEK_SET);
-							if (fwrite(buffer, block->mSize, 1, mDataFP) != 1)
-							{
-								llwarns << "Short write" << llendl;
-							}
-						} else {
-							llwarns << "Short read" << llendl;
-						}
-    
-						delete[] buffer;
+						moveData(block->mLocation, free_block->mLocation, block->mSize);
+						mGrowthMoves++;
+						mGrowthBytes += block->mSize;
 					}
+					mFileBlocksByLocation.erase(block->mLocation);
 				}
     
 				block->mLocation = free_block->mLocation;
+				mFileBlocksByLocation[block->mLocation] = block;
     
 				block->mLength = max_size;
 
@@ -892,6 +922,7 @@ BOOL LLVFS::setMaxSize(const LLUUID &file_id, const LLAssetType::EType file_type
 				block = new LLVFSFileBlock(file_id, file_type, free_block->mLocation, max_size);
 				mFileBlocks.insert(fileblock_map::value_type(spec, block));
 			}
+			mFileBlocksByLocation[block->mLocation] = block;
 
 			// Must call useFreeSpace before sync(), as sync()
 			// unlocks data structures.
@@ -995,6 +1026,7 @@ void LLVFS::removeFileBlock(LLVFSFileBlock *fileblock)
 		LLVFSBlock *free_block = new LLVFSBlock(fileblock->mLocation, fileblock->mLength);
 		
 		addFreeBlock(free_block);
+		mFileBlocksByLocation.erase(fileblock->mLocation);
 	}
 	
 	fileblock->mLocation = 0;
@@ -1047,7 +1079,7 @@ S32 LLVFS::getData(const LLUUID &file_id, const LLAssetType::EType file_type, U8
 
 	BOOL do_read = FALSE;
 	
-    lockData();
+    readLockData();
 	
 	LLVFSFileSpecifier spec(file_id, file_type);
 	fileblock_map::iterator it = mFileBlocks.find(spec);
@@ -1076,8 +1108,7 @@ S32 LLVFS::getData(const LLUUID &file_id, const LLAssetType::EType file_type, U8
 
 	if (do_read)
 	{
-		fseek(mDataFP, location, SEEK_SET);
-		bytesread = (S32)fread(buffer, 1, length, mDataFP);
+		bytesread = llmax(0, mDataFile.read(buffer, location, length));
 	}
 	
 	return bytesread;
@@ -1146,8 +1177,7 @@ S32 LLVFS::storeData(const LLUUID &file_id, const LLAssetType::EType file_type,
 			
 			unlockData();
 			
-			fseek(mDataFP, file_location, SEEK_SET);
-			S32 write_len = (S32)fwrite(buffer, 1, length, mDataFP);
+			S32 write_len = llmax(0, mDataFile.write(buffer, file_location, length));
 			if (write_len != length)
 			{
 				llwarns << llformat("VFS Write Error: %d != %d",write_len,length) << llendl;
@@ -1224,7 +1254,7 @@ void LLVFS::decLock(const LLUUID &file_id, const LLAssetType::EType file_type, E
 
 BOOL LLVFS::isLocked(const LLUUID &file_id, const LLAssetType::EType file_type, EVFSLock lock)
 {
-	lockData();
+	readLockData();
 	
 	BOOL res = FALSE;
 	
@@ -1422,6 +1452,41 @@ void LLVFS::useFreeSpace(LLVFSBlock *free_block, S32 length)
 	}
 }
 
+// mDataMutex must be LOCKED before calling this
+// Returns the file whose data starts at location, if any.
+LLVFSFileBlock *LLVFS::findFileBlockAt(U32 location)
+{
+	fileblock_location_map_t::iterator it = mFileBlocksByLocation.find(location);
+	return (it == mFileBlocksByLocation.end()) ? NULL : (*it).second;
+}
+
+// Copies size bytes of the data file from one location to another, front
+// to back, so the ranges may overlap as long as to is below from.
+BOOL LLVFS::moveData(U32 from, U32 to, S32 size)
+{
+	llassert(to < from || to >= from + size);
+	U8 *buffer = new U8[llmin(size, MOVE_CHUNK_SIZE)];
+	BOOL success = TRUE;
+	for (S32 offset = 0; offset < size; offset += MOVE_CHUNK_SIZE)
+	{
+		S32 chunk = llmin(size - offset, MOVE_CHUNK_SIZE);
+		if (mDataFile.read(buffer, from + offset, chunk) != chunk)
+		{
+			llwarns << "Short read" << llendl;
+			success = FALSE;
+			break;
+		}
+		if (mDataFile.write(buffer, to + offset, chunk) != chunk)
+		{
+			llwarns << "Short write" << llendl;
+			success = FALSE;
+			break;
+		}
+	}
+	delete[] buffer;
+	return success;
+}
+
 // NOTE! mDataMutex must be LOCKED before calling this
 // sync this index entry out to the index file
 // we need to do this constantly to avoid corruption on viewer crash
@@ -1617,6 +1682,109 @@ LLVFSBlock *LLVFS::findFreeBlock(S32 size, LLVFSFileBlock *immune)
 // public
 //============================================================================
 
+void LLVFS::startCompacting()
+{
+	lockData();
+	if (!mReadOnly && !mCompacting)
+	{
+		mCompacting = TRUE;
+		mCompactLocation = 0;
+	}
+	unlockData();
+}
+
+BOOL LLVFS::compact(F32 max_seconds)
+{
+	if (!isValid())
+	{
+		llerrs << "Attempting to use invalid VFS!" << llendl;
+	}
+
+	LLTimer timer;
+	BOOL done = FALSE;
+
+	lockData();
+
+	if (!mCompacting)
+	{
+		unlockData();
+		return TRUE;
+	}
+
+	while (timer.getElapsedTimeF32() < max_seconds)
+	{
+		blocks_location_map_t::iterator iter = mFreeBlocksByLocation.lower_bound(mCompactLocation);
+		if (iter == mFreeBlocksByLocation.end())
+		{
+			// end of the pass
+			mCompacting = FALSE;
+			mCompactLocation = 0;
+			done = TRUE;
+			break;
+		}
+		LLVFSBlock *free_block = iter->second;
+		U32 free_end = free_block->mLocation + free_block->mLength;
+		LLVFSFileBlock *file_block = findFileBlockAt(free_end);
+
+		if (!file_block)
+		{
+			// nothing after this free block to move down
+			mCompactLocation = free_end;
+			continue;
+		}
+		if (file_block->mLength > COMPACT_MAX_MOVE ||
+			file_block->mLocks[VFSLOCK_OPEN] ||
+			file_block->mLocks[VFSLOCK_READ] ||
+			file_block->mLocks[VFSLOCK_APPEND])
+		{
+			// leave big and open files alone, an open file's reader may
+			// have looked up its location already
+			mCompactLocation = file_block->mLocation + file_block->mLength;
+			continue;
+		}
+
+		if (file_block->mSize > 0 &&
+			!moveData(file_block->mLocation, free_block->mLocation, file_block->mSize))
+		{
+			mCompactLocation = free_end;
+			continue;
+		}
+		mCompactMoves++;
+		mCompactBytes += file_block->mSize;
+
+		// swap the file and the free space, which may now join the next
+		mFileBlocksByLocation.erase(file_block->mLocation);
+		file_block->mLocation = free_block->mLocation;
+		mFileBlocksByLocation[file_block->mLocation] = file_block;
+		eraseBlock(free_block);
+		free_block->mLocation = file_block->mLocation + file_block->mLength;
+		mCompactLocation = free_block->mLocation;
+		addFreeBlock(free_block);
+
+		// unlocks data structures while it writes the index
+		sync(file_block);
+	}
+
+	unlockData();
+
+	return done;
+}
+
+F32 LLVFS::getFragmentation()
+{
+	readLockData();
+	S32 total_free_size = 0;
+	for (blocks_location_map_t::iterator iter = mFreeBlocksByLocation.begin();
+		 iter != mFreeBlocksByLocation.end(); ++iter)
+	{
+		total_free_size += iter->second->mLength;
+	}
+	S32 max_free_size = mFreeBlocksByLength.empty() ? 0 : mFreeBlocksByLength.rbegin()->first;
+	unlockData();
+
+	return total_free_size > 0 ? 1.f - (F32)max_free_size / (F32)total_free_size : 0.f;
+}
+
 void LLVFS::pokeFiles()
 {
 	if (!isValid())
@@ -1627,15 +1795,12 @@ void LLVFS::pokeFiles()
 	
 	// only write data if we actually read 4 bytes
 	// otherwise we're writing garbage and screwing up the file
-	fseek(mDataFP, 0, SEEK_SET);
-	if (fread(&word, sizeof(word), 1, mDataFP) == 1)
+	if (mDataFile.read(&word, 0, sizeof(word)) == sizeof(word))
 	{
-		fseek(mDataFP, 0, SEEK_SET);
-		if (fwrite(&word, sizeof(word), 1, mDataFP) != 1)
+		if (mDataFile.write(&word, 0, sizeof(word)) != sizeof(word))
 		{
 			llwarns << "Could not write to data file" << llendl;
 		}
-		fflush(mDataFP);
 	}
 
 	fseek(mIndexFP, 0, SEEK_SET);
@@ -1675,7 +1840,7 @@ void LLVFS::dumpMap()
 void LLVFS::audit()
 {
 	// Lock the mutex through this whole function.
-	LLMutexLock lock_data(mDataMutex);
+	lockData();
 	
 	fflush(mIndexFP);
 
@@ -1728,6 +1893,7 @@ void LLVFS::audit()
 				// try to keep data from being lost
 				unlockAndClose(mIndexFP);
 				mIndexFP = NULL;
+				mDataFile.close();
 				unlockAndClose(mDataFP);
 				mDataFP = NULL;
 				llwarns << "VFS: Original block index " << block->mIndexLocation
@@ -1806,9 +1972,10 @@ void LLVFS::audit()
 		}
     
 		llinfos << "VFS: audit OK" << llendl;
-		// mutex released by LLMutexLock() destructor.
 	}
 
+	unlockData();
+
 	for_each(audit_blocks.begin(), audit_blocks.end(), DeletePointer());
 }
     
@@ -1960,6 +2127,10 @@ void LLVFS::dumpStatistics()
 	llinfos << "Total free size: " << total_free_size/1024 << "K" << llendl;
 	llinfos << "Sum: " << (total_file_size + total_free_size) << " bytes" << llendl;
 	llinfos << llformat("%.0f%% full",((F32)(total_file_size)/(F32)(total_file_size+total_free_size))*100.f) << llendl;
+	llinfos << llformat("Fragmentation: %.0f%% of free space outside the largest free block",
+						total_free_size ? (1.f - (F32)max_free_size/(F32)total_free_size)*100.f : 0.f) << llendl;
+	llinfos << "Compaction moves: " << mCompactMoves << " (" << (S32)(mCompactBytes >> 10) << "K)" << llendl;
+	llinfos << "Growth moves:     " << mGrowthMoves << " (" << (S32)(mGrowthBytes >> 10) << "K)" << llendl;
 
 	llinfos << " " << llendl;
 	for (std::map<LLAssetType::EType, std::pair<S32,S32> >::iterator iter = filetype_counts.begin();
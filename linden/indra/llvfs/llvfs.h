@@ -37,6 +37,7 @@
 #include "linked_lists.h"
 #include "llassettype.h"
 #include "llthread.h"
+#include "llpositionalfile.h"
 
 enum EVFSValid 
 {
@@ -85,6 +86,9 @@ public:
 	EVFSValid getValidState() const	{ return mValid; }
 
 	// ---------- The following fucntions lock/unlock mDataMutex ----------
+	// Lookups only take it for reading and may run on several threads at
+	// once, still stamping the file's access time, which is atomic for
+	// that. getData() and storeData() do their file I/O outside the lock.
 	BOOL getExists(const LLUUID &file_id, const LLAssetType::EType file_type);
 	S32	 getSize(const LLUUID &file_id, const LLAssetType::EType file_type);
 
@@ -103,6 +107,18 @@ public:
 	void incLock(const LLUUID &file_id, const LLAssetType::EType file_type, EVFSLock lock);
 	void decLock(const LLUUID &file_id, const LLAssetType::EType file_type, EVFSLock lock);
 	BOOL isLocked(const LLUUID &file_id, const LLAssetType::EType file_type, EVFSLock lock);
+
+	// Compaction slides files that nobody has open down over the free space
+	// before them, so that free space coalesces at the end of the data file.
+	// startCompacting() begins a pass over the file, which compact() then
+	// works through for up to max_seconds per call (see LLVFSThread).
+	// Returns TRUE once the pass is finished.
+	void startCompacting();
+	BOOL isCompacting() const { return mCompacting; }
+	BOOL compact(F32 max_seconds);
+	// Share of the free space lying outside the largest free block,
+	// 0 when it is all in one piece.
+	F32 getFragmentation();
 	// ----------------------------------------------------------------
 
 	// Used to trigger evil WinXP behavior of "preloading" entire file into memory.
@@ -128,6 +144,8 @@ protected:
 	void addFreeBlock(LLVFSBlock *block);
 	//void mergeFreeBlocks();
 	void useFreeSpace(LLVFSBlock *free_block, S32 length);
+	LLVFSFileBlock *findFileBlockAt(U32 location);
+	BOOL moveData(U32 from, U32 to, S32 size);
 	void sync(LLVFSFileBlock *block, BOOL remove = FALSE);
 	void presizeDataFile(const U32 size);
 
@@ -139,14 +157,18 @@ protected:
 	LLVFSBlock *findFreeBlock(S32 size, LLVFSFileBlock *immune = NULL);
 
 	// lock/unlock data mutex (mDataMutex)
-	void lockData() { mDataMutex->lock(); }
+	void lockData() { mDataMutex->writeLock(); }
+	void readLockData() { mDataMutex->readLock(); } // for lookups that change no maps
 	void unlockData() { mDataMutex->unlock(); }	
 	
 protected:
-	LLMutex* mDataMutex;
+	LLRWMutex* mDataMutex;
 	
 	typedef std::map<LLVFSFileSpecifier, LLVFSFileBlock*> fileblock_map;
 	fileblock_map mFileBlocks;
+	// the files holding data, by where it starts, for findFileBlockAt()
+	typedef std::map<U32, LLVFSFileBlock*> fileblock_location_map_t;
+	fileblock_location_map_t mFileBlocksByLocation;
 
 	typedef std::multimap<S32, LLVFSBlock*>	blocks_length_map_t;
 	blocks_length_map_t 	mFreeBlocksByLength;
@@ -155,6 +177,9 @@ protected:
 
 	LLFILE *mDataFP;
 	LLFILE *mIndexFP;
+	// Reads and writes of mDataFP go through this, at explicit offsets, so
+	// threads neither share nor race on a file position.
+	LLPositionalFile mDataFile;
 
 	std::deque<S32> mIndexHoles;
 
@@ -166,6 +191,14 @@ protected:
 
 	S32 mLockCounts[VFSLOCK_COUNT];
 	BOOL mRemoveAfterCrash;
+
+	BOOL mCompacting;
+	U32 mCompactLocation;	// where the next compact() call resumes
+	// for dumpStatistics()
+	S32 mCompactMoves;
+	U64 mCompactBytes;
+	S32 mGrowthMoves;		// files moved by setMaxSize() to grow
+	U64 mGrowthBytes;
 };
 
 extern LLVFS *gVFS;
@@ -35,6 +35,8 @@
 
 //============================================================================
 
+const F32 COMPACT_SLICE_SECONDS = 0.002f;
+
 /*static*/ std::string LLVFSThread::sDataPath = "";
 
 /*static*/ LLVFSThread* LLVFSThread::sLocal = NULL;
@@ -101,6 +103,24 @@ LLVFSThread::handle_t LLVFSThread::read(LLVFS* vfs, const LLUUID &file_id, const
 	return handle;
 }
 
+LLVFSThread::handle_t LLVFSThread::compact(LLVFS* vfs)
+{
+	handle_t handle = generateHandle();
+
+	Request* req = new Request(handle, 0, FLAG_AUTO_COMPLETE, FILE_COMPACT, vfs, LLUUID::null, LLAssetType::AT_NONE,
+							   NULL, 0, 0);
+
+	bool res = addRequest(req);
+	if (!res)
+	{
+		llerrs << "LLVFSThread::compact called after LLVFSThread::cleanupClass()" << llendl;
+		req->deleteRequest();
+		handle = nullHandle();
+	}
+
+	return handle;
+}
+
 S32 LLVFSThread::readImmediate(LLVFS* vfs, const LLUUID &file_id, const LLAssetType::EType file_type,
 							   U8* buffer, S32 offset, S32 numbytes)
 {
@@ -204,6 +224,12 @@ LLVFSThread::Request::Request(handle_t handle, U32 priority, U32 flags,
 	mBytes(numbytes),
 	mBytesRead(0)
 {
+	if (mOperation == FILE_COMPACT)
+	{
+		// works on the whole VFS, no file to lock
+		return;
+	}
+
 	llassert(mBuffer);
 
 	if (numbytes <= 0 && mOperation != FILE_RENAME)
@@ -243,7 +269,7 @@ void LLVFSThread::Request::finishRequest(bool completed)
 	{
 		mVFS->decLock(mFileID, mFileType, VFSLOCK_APPEND);
 	}
-	else // if (mOperation == FILE_READ)
+	else if (mOperation == FILE_READ)
 	{
 		mVFS->decLock(mFileID, mFileType, VFSLOCK_READ);
 	}
@@ -295,6 +321,13 @@ bool LLVFSThread::Request::processRequest()
 		complete = true;
 		//llinfos << llformat("LLVFSThread::RENAME '%s': %d bytes arg:%d",getFilename(),mBytesRead) << llendl;
 	}
+	else if (mOperation == FILE_COMPACT)
+	{
+		// one slice per request, so that compaction never holds up the
+		// reads and writes queued after it
+		mVFS->compact(COMPACT_SLICE_SECONDS);
+		complete = true;
+	}
 	else
 	{
 		llerrs << llformat("LLVFSThread::unknown operation: %d", mOperation) << llendl;
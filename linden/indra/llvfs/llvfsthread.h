@@ -52,7 +52,8 @@ public:
 	enum operation_t {
 		FILE_READ,
 		FILE_WRITE,
-		FILE_RENAME
+		FILE_RENAME,
+		FILE_COMPACT
 	};
 
 	//------------------------------------------------------------------------
@@ -126,6 +127,9 @@ public:
 	// SJB: rename seems to have issues, especially when threaded
 // 	handle_t rename(LLVFS* vfs, const LLUUID &file_id, const LLAssetType::EType file_type,
 // 					const LLUUID &new_id, const LLAssetType::EType new_type, U32 flags);
+	// Queue one time slice of an LLVFS::startCompacting() pass, behind
+	// any other queued work
+	handle_t compact(LLVFS* vfs);
 	// Return number of bytes read
 	S32 readImmediate(LLVFS* vfs, const LLUUID &file_id, const LLAssetType::EType file_type,
 					  U8* buffer, S32 offset, S32 numbytes);
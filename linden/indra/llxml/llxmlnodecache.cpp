@@ -0,0 +1,237 @@
+/** 
+ * @file llxmlnodecache.cpp
+ * @brief Compiled, in-memory cache of parsed XML files
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "llxmlnodecache.h"
+
+#include "llfile.h"
+#include "llstl.h"
+#include "lltimer.h"
+
+//static
+LLXMLNodeCache::entry_map_t LLXMLNodeCache::sEntries;
+S32 LLXMLNodeCache::sHits = 0;
+S32 LLXMLNodeCache::sMisses = 0;
+F64 LLXMLNodeCache::sHitSeconds = 0.0;
+F64 LLXMLNodeCache::sMissSeconds = 0.0;
+
+namespace
+{
+	void write_u32(std::vector<U8>& data, U32 value)
+	{
+		U8* bytes = (U8*)&value;
+		data.insert(data.end(), bytes, bytes + sizeof(U32));
+	}
+
+	void write_string(std::vector<U8>& data, const std::string& value)
+	{
+		write_u32(data, (U32)value.size());
+		data.insert(data.end(), value.begin(), value.end());
+	}
+
+	U32 read_u32(const U8*& data)
+	{
+		U32 value;
+		memcpy(&value, data, sizeof(U32));
+		data += sizeof(U32);
+		return value;
+	}
+
+	void read_string(const U8*& data, std::string& value)
+	{
+		U32 size = read_u32(data);
+		value.assign((const char*)data, size);
+		data += size;
+	}
+}
+
+//static
+bool LLXMLNodeCache::parseFile(const std::string& filename, LLXMLNodePtr& node, LLXMLNode* defaults_tree)
+{
+	LLTimer timer;
+
+	llstat stat_data;
+	if (LLFile::stat(filename, &stat_data))
+	{
+		// let LLXMLNode report the missing file
+		return LLXMLNode::parseFile(filename, node, defaults_tree);
+	}
+
+	entry_map_t::iterator iter = sEntries.find(filename);
+	if (iter != sEntries.end())
+	{
+		Entry* entry = iter->second;
+		if (entry->mModifiedTime == stat_data.st_mtime &&
+			entry->mFileSize == (S32)stat_data.st_size &&
+			entry->mStripEscapedStrings == LLXMLNode::sStripEscapedStrings &&
+			entry->mStripWhitespaceValues == LLXMLNode::sStripWhitespaceValues)
+		{
+			const U8* data = &entry->mData[0];
+			node = build(entry, data, NULL);
+			llassert(data == &entry->mData[0] + entry->mData.size());
+			node->setDefault(defaults_tree);
+			node->updateDefault();
+
+			sHits++;
+			sHitSeconds += timer.getElapsedTimeF64();
+			return true;
+		}
+		delete entry;
+		sEntries.erase(iter);
+	}
+
+	if (!LLXMLNode::parseFile(filename, node, defaults_tree))
+	{
+		return false;
+	}
+
+	Entry* entry = new Entry;
+	entry->mModifiedTime = stat_data.st_mtime;
+	entry->mFileSize = (S32)stat_data.st_size;
+	entry->mStripEscapedStrings = LLXMLNode::sStripEscapedStrings;
+	entry->mStripWhitespaceValues = LLXMLNode::sStripWhitespaceValues;
+	name_index_map_t names;
+	compile(node, entry, names);
+	sEntries[filename] = entry;
+
+	sMisses++;
+	sMissSeconds += timer.getElapsedTimeF64();
+	return true;
+}
+
+//static
+void LLXMLNodeCache::clear()
+{
+	for_each(sEntries.begin(), sEntries.end(), DeletePairedPointer());
+	sEntries.clear();
+}
+
+//static
+void LLXMLNodeCache::dumpStats()
+{
+	S32 bytes = 0;
+	for (entry_map_t::iterator iter = sEntries.begin(); iter != sEntries.end(); ++iter)
+	{
+		bytes += iter->second->mData.size() + iter->second->mNames.size() * sizeof(LLStringTableEntry*);
+	}
+	llinfos << "XML node cache: " << sEntries.size() << " files, " << bytes / 1024 << "K, "
+			<< sHits << " hits averaging " << (sHits ? sHitSeconds * 1000.0 / sHits : 0.0) << " ms, "
+			<< sMisses << " parses averaging " << (sMisses ? sMissSeconds * 1000.0 / sMisses : 0.0) << " ms"
+			<< llendl;
+}
+
+// Node layout: name index, id, version major and minor, length, precision,
+// type, encoding, value, attribute count, then (name index, value) for each
+// attribute, then child count and each child in document order.
+//static
+void LLXMLNodeCache::compile(LLXMLNode* node, Entry* entry, name_index_map_t& names)
+{
+	std::vector<U8>& data = entry->mData;
+
+	LLStringTableEntry* name = const_cast<LLStringTableEntry*>(node->getName());
+	name_index_map_t::iterator name_iter = names.find(name);
+	if (name_iter == names.end())
+	{
+		name_iter = names.insert(std::make_pair(name, (U32)entry->mNames.size())).first;
+		entry->mNames.push_back(name);
+	}
+	write_u32(data, name_iter->second);
+
+	if (node->mIsAttribute)
+	{
+		write_string(data, node->getValue());
+		return;
+	}
+
+	write_string(data, node->mID);
+	write_u32(data, node->mVersionMajor);
+	write_u32(data, node->mVersionMinor);
+	write_u32(data, node->mLength);
+	write_u32(data, node->mPrecision);
+	write_u32(data, node->mType);
+	write_u32(data, node->mEncoding);
+	write_string(data, node->getValue());
+
+	write_u32(data, (U32)node->mAttributes.size());
+	for (LLXMLAttribList::iterator iter = node->mAttributes.begin(); iter != node->mAttributes.end(); ++iter)
+	{
+		compile(iter->second, entry, names);
+	}
+
+	write_u32(data, node->getChildCount());
+	for (LLXMLNodePtr child = node->getFirstChild(); child.notNull(); child = child->getNextSibling())
+	{
+		compile(child, entry, names);
+	}
+}
+
+//static
+LLXMLNodePtr LLXMLNodeCache::build(const Entry* entry, const U8*& data, LLXMLNode* parent)
+{
+	LLXMLNodePtr node = new LLXMLNode(entry->mNames[read_u32(data)], FALSE);
+	read_string(data, node->mID);
+	node->mVersionMajor = read_u32(data);
+	node->mVersionMinor = read_u32(data);
+	node->mLength = read_u32(data);
+	node->mPrecision = read_u32(data);
+	U32 type = read_u32(data);
+	node->mEncoding = (LLXMLNode::Encoding)read_u32(data);
+	std::string value;
+	read_string(data, value);
+	node->setValue(value);
+	// after setValue(), which turns containers into TYPE_UNKNOWN
+	node->mType = (LLXMLNode::ValueType)type;
+
+	U32 attribute_count = read_u32(data);
+	for (U32 i = 0; i < attribute_count; i++)
+	{
+		LLXMLNodePtr attribute = new LLXMLNode(entry->mNames[read_u32(data)], TRUE);
+		read_string(data, value);
+		attribute->setValue(value);
+		node->addChild(attribute);
+	}
+
+	// attach before building the children, as the parser does, so that
+	// addChild() has no subtree to walk
+	if (parent)
+	{
+		parent->addChild(node);
+	}
+
+	U32 child_count = read_u32(data);
+	for (U32 i = 0; i < child_count; i++)
+	{
+		build(entry, data, node);
+	}
+
+	return node;
+}
@@ -0,0 +1,79 @@
+/** 
+ * @file llxmlnodecache.h
+ * @brief Compiled, in-memory cache of parsed XML files
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLXMLNODECACHE_H
+#define LL_LLXMLNODECACHE_H
+
+#include <map>
+#include <vector>
+
+#include "llxmlnode.h"
+
+// Keeps each XML file it has parsed in a compact binary form, so that
+// asking for the same file again rebuilds the LLXMLNode tree straight from
+// that instead of reading the file and running expat over it. Entries are
+// checked against the file's modification time and size on every use.
+// The data is position independent (names are indices into a per-file
+// table of interned LLStringTable entries), so callers always get a fresh
+// tree they are free to modify. Main thread only.
+class LLXMLNodeCache
+{
+public:
+	// Same contract as LLXMLNode::parseFile()
+	static bool parseFile(const std::string& filename, LLXMLNodePtr& node, LLXMLNode* defaults_tree);
+
+	static void clear();
+	static void dumpStats();
+
+private:
+	struct Entry
+	{
+		time_t mModifiedTime;
+		S32 mFileSize;
+		BOOL mStripEscapedStrings;	// LLXMLNode parse options the data was compiled with
+		BOOL mStripWhitespaceValues;
+		std::vector<LLStringTableEntry*> mNames;
+		std::vector<U8> mData;
+	};
+	typedef std::map<std::string, Entry*> entry_map_t;
+	typedef std::map<const LLStringTableEntry*, U32> name_index_map_t;
+
+	static void compile(LLXMLNode* node, Entry* entry, name_index_map_t& names);
+	static LLXMLNodePtr build(const Entry* entry, const U8*& data, LLXMLNode* parent);
+
+	static entry_map_t sEntries;
+	static S32 sHits;
+	static S32 sMisses;
+	static F64 sHitSeconds;		// time spent rebuilding trees from the cache
+	static F64 sMissSeconds;	// time spent parsing files
+};
+
+#endif // LL_LLXMLNODECACHE_H
@@ -37,6 +37,7 @@
 #include "llversionviewer.h"
 #include "llfeaturemanager.h"
 #include "lluictrlfactory.h"
+#include "llxmlnodecache.h"
 #include "lltexteditor.h"
 #include "llalertdialog.h"
 #include "llerrorcontrol.h"
@@ -87,6 +88,7 @@
 #include "llviewerkeyboard.h"
 #include "lllfsthread.h"
 #include "llworkerthread.h"
+#include "lljobsystem.h"
 #include "lltexturecache.h"
 #include "lltexturefetch.h"
 #include "llimageworker.h"
@@ -141,6 +143,7 @@
 #include "llsrv.h"
 #include "llvovolume.h"
 #include "llflexibleobject.h" 
+#include "llface.h"
 #include "llvosurfacepatch.h"
 
 // includes for idle() idleShutdown()
@@ -379,6 +382,8 @@ static void settings_to_globals()
 	LLImageGL::sGlobalUseAnisotropic	= gSavedSettings.getBOOL("RenderAnisotropic");
 	LLVOVolume::sLODFactor				= gSavedSettings.getF32("RenderVolumeLODFactor");
 	LLVOVolume::sDistanceFactor			= 1.f-LLVOVolume::sLODFactor * 0.1f;
+	LLVOVolume::sAsyncVolumes			= gSavedSettings.getBOOL("RenderAsyncVolumes");
+	LLFace::sUsePackedVertices			= gSavedSettings.getBOOL("RenderPackedVertices");
 	LLVolumeImplFlexible::sUpdateFactor = gSavedSettings.getF32("RenderFlexTimeFactor");
 	LLVOTree::sTreeFactor				= gSavedSettings.getF32("RenderTreeLODFactor");
 	LLVOAvatar::sLODFactor				= gSavedSettings.getF32("RenderAvatarLODFactor");
@@ -671,6 +676,7 @@ bool LLAppViewer::init()
 	LLAgent::parseTeleportMessages("teleport_strings.xml");
 
 	LLViewerJointMesh::updateVectorize();
+	LLFace::updateVectorize();
 
 	// load MIME type -> media impl mappings
 	LLMIMETypes::parseMIMETypes( std::string("mime_types.xml") ); 
@@ -861,6 +867,10 @@ bool LLAppViewer::mainLoop()
 	// Handle messages
 	while (!LLApp::isExiting())
 	{
+		if (LLJobSystem::getInstance())
+		{
+			LLJobSystem::getInstance()->updateFastTimers();
+		}
 		LLFastTimer::reset(); // Should be outside of any timer instances
 		try
 		{
@@ -1270,6 +1280,8 @@ bool LLAppViewer::cleanup()
 	LLWorldMapView::cleanupClass();
 	LLFolderViewItem::cleanupClass();
 	LLUI::cleanupClass();
+	LLXMLNodeCache::dumpStats();
+	LLXMLNodeCache::clear();
 	
 	//
 	// Shut down the VFS's AFTER the decode manager cleans up (since it cleans up vfiles).
@@ -1348,6 +1360,7 @@ bool LLAppViewer::cleanup()
     sTextureFetch = NULL;
 	delete sImageDecodeThread;
     sImageDecodeThread = NULL;
+	LLJobSystem::cleanupClass();
 
 	//Note:
 	//LLViewerMedia::cleanupClass() has to be put before gImageList.shutdown()
@@ -1444,11 +1457,12 @@ bool LLAppViewer::initThreads()
 
 	LLVFSThread::initClass(enable_threads && true);
 	LLLFSThread::initClass(enable_threads && true);
+	LLJobSystem::initClass(enable_threads ? gSavedSettings.getS32("JobSystemThreads") : 0);
 
 	// Image decoding
-	LLAppViewer::sImageDecodeThread = new LLWorkerThread("ImageDecode", enable_threads && true);
+	LLAppViewer::sImageDecodeThread = new LLImageDecodeThread("ImageDecode", gSavedSettings.getS32("ImageDecodeThreads"), enable_threads && true);
 	LLAppViewer::sTextureCache = new LLTextureCache(enable_threads && true);
-	LLAppViewer::sTextureFetch = new LLTextureFetch(LLAppViewer::getTextureCache(), enable_threads && false);
+	LLAppViewer::sTextureFetch = new LLTextureFetch(LLAppViewer::getTextureCache(), enable_threads && gSavedSettings.getBOOL("ImageFetchThreaded"));
 	LLImage::initClass(LLAppViewer::getImageDecodeThread());
 
 	// *FIX: no error handling here!
@@ -3167,6 +3181,29 @@ void LLAppViewer::idle()
 		}
 		gFrameStats.addFrameData();
 	}
+
+	{
+		// Compact the cache VFS on the VFS thread once it fragments,
+		// a time slice at a time
+		static LLFrameTimer vfs_compact_timer;
+		static LLVFSThread::handle_t vfs_compact_handle = LLVFSThread::nullHandle();
+		if (gVFS->isCompacting())
+		{
+			if (LLVFSThread::sLocal->getRequestStatus(vfs_compact_handle) == LLVFSThread::STATUS_EXPIRED)
+			{
+				vfs_compact_handle = LLVFSThread::sLocal->compact(gVFS);
+			}
+		}
+		else if (vfs_compact_timer.getElapsedTimeF32() > 60.f)
+		{
+			vfs_compact_timer.reset();
+			F32 max_fragmentation = gSavedSettings.getF32("VFSCompactFragmentation");
+			if (max_fragmentation > 0.f && gVFS->getFragmentation() > max_fragmentation)
+			{
+				gVFS->startCompacting();
+			}
+		}
+	}
 	
 	if (!gDisconnected)
 	{
@@ -3370,6 +3407,8 @@ void LLAppViewer::idle()
 	// objects and camera should be in sync, do LOD calculations now
 	{
 		LLFastTimer t(LLFastTimer::FTM_LOD_UPDATE);
+		// rebuilds objects whose new detail level finished generating
+		LLPrimitive::getVolumeManager()->updateRequests();
 		gObjectList.updateApparentAngles(gAgent);
 	}
 
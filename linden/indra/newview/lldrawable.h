@@ -102,6 +102,8 @@ public:
 	F32			          getIntensity() const			{ return llmin(mXform.getScale().mV[0], 4.f); }
 	S32					  getLOD() const				{ return mVObjp ? mVObjp->getLOD() : 1; }
 	F64					  getBinRadius() const			{ return mBinRadius; }
+	S32					  getBinIndex() const			{ return mBinIndex; }
+	void				  setBinIndex(S32 index)		{ mBinIndex = index; }
 	void  getMinMax(LLVector3& min,LLVector3& max) const { mXform.getMinMax(min,max); }
 	LLXformMatrix*		getXform() { return &mXform; }
 
@@ -298,6 +300,7 @@ private:
 	LLVector3		mExtents[2];
 	LLVector3d		mPositionGroup;
 	F64				mBinRadius;
+	S32				mBinIndex;		// slot in the element array of the octree node holding us
 	S32				mGeneration;
 
 	LLVector3		mCurrentScale;
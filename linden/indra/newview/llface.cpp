@@ -55,6 +55,9 @@
 #define LL_MAX_INDICES_COUNT 1000000
 
 BOOL LLFace::sSafeRenderSelect = TRUE; // FALSE
+BOOL LLFace::sUsePackedVertices = TRUE;
+U32 LLFace::sPackedVertexCount = 0;
+U32 LLFace::sUnpackedVertexCount = 0;
 
 #define DOTVEC(a,b) (a.mV[0]*b.mV[0] + a.mV[1]*b.mV[1] + a.mV[2]*b.mV[2])
 
@@ -739,6 +742,35 @@ LLVector2 LLFace::surfaceToTexture(LLVector2 surface_coord, LLVector3 position,
 }
 
 
+//static
+void (*LLFace::sTransformPositionsFunc)(const LLVector4* src, S32 count, const LLMatrix4& mat,
+										LLStrider<LLVector3>& dst) = &LLVolumeFace::transformPositions;
+//static
+void (*LLFace::sTransformNormalsFunc)(const LLVector4* src, S32 count, const LLMatrix3& mat,
+									  LLStrider<LLVector3>& dst) = &LLVolumeFace::transformNormals;
+//static
+void (*LLFace::sTransformTexCoordsFunc)(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+										F32 off_s, F32 off_t, F32 mag_s, F32 mag_t,
+										LLStrider<LLVector2>& dst) = &LLVolumeFace::transformTexCoords;
+
+//static
+void LLFace::updateVectorize()
+{
+	// Same switches as avatar skinning, see LLViewerJointMesh::updateVectorize()
+	if (gSavedSettings.getBOOL("VectorizeEnable") && gSavedSettings.getU32("VectorizeProcessor") == 2)
+	{
+		sTransformPositionsFunc = &LLVolumeFace::transformPositionsSSE2;
+		sTransformNormalsFunc = &LLVolumeFace::transformNormalsSSE2;
+		sTransformTexCoordsFunc = &LLVolumeFace::transformTexCoordsSSE2;
+	}
+	else
+	{
+		sTransformPositionsFunc = &LLVolumeFace::transformPositions;
+		sTransformNormalsFunc = &LLVolumeFace::transformNormals;
+		sTransformTexCoordsFunc = &LLVolumeFace::transformTexCoords;
+	}
+}
+
 BOOL LLFace::getGeometryVolume(const LLVolume& volume,
 							   const S32 &f,
 								const LLMatrix4& mat_vert, const LLMatrix3& mat_normal,
@@ -1003,9 +1035,47 @@ BOOL LLFace::getGeometryVolume(const LLVolume& volume,
 		mVObjp->getVolume()->genBinormals(f);
 	}
 
+	// Shared volumes keep packed copies of their vertices; positions, normals
+	// and plain texture coordinates are done a whole face at a time from those.
+	BOOL packed = sUsePackedVertices && vf.hasPackedVertices();
+	BOOL packed_pos = packed && rebuild_pos;
+	BOOL packed_tcoord = packed && rebuild_tcoord && !bump_code && !(tex_mode && mTextureMatrix) &&
+						 (texgen == LLTextureEntry::TEX_GEN_DEFAULT || texgen == LLTextureEntry::TEX_GEN_PLANAR);
+	if (packed_pos)
+	{
+		sTransformPositionsFunc(&vf.mPackedPositions[0], num_vertices, mat_vert, vertices);
+		sTransformNormalsFunc(&vf.mPackedNormals[0], num_vertices, mat_normal, normals);
+	}
+	if (packed_tcoord && texgen == LLTextureEntry::TEX_GEN_DEFAULT)
+	{
+		sTransformTexCoordsFunc(&vf.mPackedTexCoords[0], num_vertices, cos_ang, sin_ang, os, ot, ms, mt, tex_coords);
+	}
+	else if (packed_tcoord)
+	{
+		const LLVector4* packed_positions = &vf.mPackedPositions[0];
+		const LLVector4* packed_normals = &vf.mPackedNormals[0];
+		for (S32 i = 0; i < num_vertices; i++)
+		{
+			const F32* p = packed_positions[i].mV;
+			LLVector3 vec(p[VX] * scale.mV[VX], p[VY] * scale.mV[VY], p[VZ] * scale.mV[VZ]);
+			LLVector2 tc;
+			planarProjection(tc, LLVector3(packed_normals[i].mV), vf.mCenter, vec);
+			xform(tc, cos_ang, sin_ang, os, ot, ms, mt);
+			*tex_coords++ = tc;
+		}
+	}
+	if (packed)
+	{
+		sPackedVertexCount += num_vertices;
+	}
+	else
+	{
+		sUnpackedVertexCount += num_vertices;
+	}
+
 	for (S32 i = 0; i < num_vertices; i++)
 	{
-		if (rebuild_tcoord)
+		if (rebuild_tcoord && !packed_tcoord)
 		{
 			LLVector2 tc = vf.mVertices[i].mTexCoord;
 		
@@ -1065,7 +1135,7 @@ BOOL LLFace::getGeometryVolume(const LLVolume& volume,
 				*tex_coords2++ = tc;
 			}	
 		}
-		else if (moved)
+		else if (moved && !rebuild_tcoord)
 		{
 			*tex_coords++ = *old_texcoords++;
 			if (bump_code)
@@ -1074,7 +1144,7 @@ BOOL LLFace::getGeometryVolume(const LLVolume& volume,
 			}
 		}
 			
-		if (rebuild_pos)
+		if (rebuild_pos && !packed_pos)
 		{
 			*vertices++ = vf.mVertices[i].mPosition * mat_vert;
 
@@ -1083,7 +1153,7 @@ BOOL LLFace::getGeometryVolume(const LLVolume& volume,
 			
 			*normals++ = normal;
 		}
-		else if (moved)
+		else if (moved && !rebuild_pos)
 		{
 			*normals++ = *old_normals++;
 			*vertices++ = *old_verts++;
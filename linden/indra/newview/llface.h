@@ -49,6 +49,7 @@
 #include "lldrawable.h"
 
 class LLFacePool;
+class LLMatrix3;
 class LLVolume;
 class LLViewerImage;
 class LLTextureEntry;
@@ -228,6 +229,23 @@ protected:
 	
 protected:
 	static BOOL	sSafeRenderSelect;
+
+public:
+	static BOOL sUsePackedVertices;		// transform shared volumes from LLVolumeFace's packed arrays
+	static U32	sPackedVertexCount;		// vertices built from packed arrays since the last dump
+	static U32	sUnpackedVertexCount;	// vertices built one at a time since the last dump
+
+	// Bulk transforms of LLVolumeFace's packed arrays into a vertex buffer,
+	// LLVolumeFace::transformPositions() and friends or their SSE2 versions.
+	static void updateVectorize();
+	static void (*sTransformPositionsFunc)(const LLVector4* src, S32 count, const LLMatrix4& mat,
+										   LLStrider<LLVector3>& dst);
+	static void (*sTransformNormalsFunc)(const LLVector4* src, S32 count, const LLMatrix3& mat,
+										 LLStrider<LLVector3>& dst);
+	static void (*sTransformTexCoordsFunc)(const LLVector2* src, S32 count, F32 cos_ang, F32 sin_ang,
+										   F32 off_s, F32 off_t, F32 mag_s, F32 mag_t,
+										   LLStrider<LLVector2>& dst);
+
 	
 public:
 	struct CompareDistanceGreater
@@ -189,6 +189,8 @@ static struct ft_display_info ft_display_table[] =
 	{ LLFastTimer::FTM_RENDER_FONTS,		"   Fonts",			&LLColor4::pink1, 0 },
 	{ LLFastTimer::FTM_SWAP,				"  Swap",			&LLColor4::pink2, 0 },
 	{ LLFastTimer::FTM_CLIENT_COPY,			"  Client Copy",	&LLColor4::red1, 1},
+	{ LLFastTimer::FTM_JOB_WAIT,			" Job Wait",		&LLColor4::grey3, 0 },
+	{ LLFastTimer::FTM_JOBS,				"  Jobs (all threads)",	&LLColor4::cyan6, 0 },
 
 #if 0 || !LL_RELEASE_FOR_DOWNLOAD
 	{ LLFastTimer::FTM_TEMP1,				" Temp1",			&LLColor4::red1, 0 },
@@ -78,6 +78,8 @@ std::set<LLPointer<LLHUDText> > LLHUDText::sTextObjects;
 std::vector<LLPointer<LLHUDText> > LLHUDText::sVisibleTextObjects;
 std::vector<LLPointer<LLHUDText> > LLHUDText::sVisibleHUDTextObjects;
 BOOL LLHUDText::sDisplayText = TRUE ;
+U32 LLHUDText::sLayoutCacheHits = 0;
+U32 LLHUDText::sLayoutCacheMisses = 0;
 
 bool lltextobject_further_away::operator()(const LLPointer<LLHUDText>& lhs, const LLPointer<LLHUDText>& rhs) const
 {
@@ -571,12 +573,14 @@ void LLHUDText::setStringUTF8(const std::string &wtext)
 void LLHUDText::setString(const LLWString &wtext)
 {
 	mTextSegments.clear();
+	ageLayoutCache();
 	addLine(wtext, mColor);
 }
 
 void LLHUDText::clearString()
 {
 	mTextSegments.clear();
+	ageLayoutCache();
 }
 
 
@@ -604,14 +608,7 @@ void LLHUDText::addLine(const LLWString &wstr, const LLColor4& color, const LLFo
 
 		while (iter != tokens.end())
 		{
-			U32 line_length = 0;
-			do	
-			{
-				S32 segment_length = mFontp->maxDrawableChars(iter->substr(line_length).c_str(), mUseBubble ? HUD_TEXT_MAX_WIDTH : HUD_TEXT_MAX_WIDTH_NO_BUBBLE, wline.length(), TRUE);
-				mTextSegments.push_back(LLHUDTextSegment(iter->substr(line_length, segment_length), style, color));
-				line_length += segment_length;
-			}
-			while (line_length != iter->size());
+			layoutLine(*iter, style, color, mTextSegments);
 			++iter;
 		}
 	}
@@ -640,17 +637,68 @@ void LLHUDText::setLabel(const LLWString &wlabel)
 
 		while (iter != tokens.end())
 		{
-			U32 line_length = 0;
-			do	
+			layoutLine(*iter, LLFontGL::NORMAL, mColor, mLabelSegments);
+			++iter;
+		}
+	}
+}
+
+void LLHUDText::layoutLine(const LLWString& line, const LLFontGL::StyleFlags style, const LLColor4& color, std::vector<LLHUDTextSegment>& segments)
+{
+	F32 max_width = mUseBubble ? HUD_TEXT_MAX_WIDTH : HUD_TEXT_MAX_WIDTH_NO_BUBBLE;
+	LLHUDTextLayoutKey key(line, mFontp, mBoldFontp, max_width, style);
+
+	layout_cache_t::iterator cache_iter = mLayoutCache.find(key);
+	if (cache_iter == mLayoutCache.end())
+	{
+		layout_cache_t::iterator old_iter = mOldLayoutCache.find(key);
+		if (old_iter != mOldLayoutCache.end())
+		{
+			// carry it over into this generation
+			cache_iter = mLayoutCache.insert(std::make_pair(key, std::vector<LLHUDTextSegment>())).first;
+			cache_iter->second.swap(old_iter->second);
+			mOldLayoutCache.erase(old_iter);
+		}
+	}
+
+	if (cache_iter != mLayoutCache.end())
+	{
+		sLayoutCacheHits++;
+	}
+	else
+	{
+		sLayoutCacheMisses++;
+		cache_iter = mLayoutCache.insert(std::make_pair(key, std::vector<LLHUDTextSegment>())).first;
+		std::vector<LLHUDTextSegment>& wrapped = cache_iter->second;
+
+		U32 line_length = 0;
+		do	
+		{
+			S32 segment_length = mFontp->maxDrawableChars(line.substr(line_length).c_str(), max_width, line.length(), TRUE);
+			wrapped.push_back(LLHUDTextSegment(line.substr(line_length, segment_length), style, color));
+			// measure now so copies handed out on later hits don't have to
+			wrapped.back().getWidth(mFontp);
+			if (style == LLFontGL::BOLD)
 			{
-				S32 segment_length = mFontp->maxDrawableChars(iter->substr(line_length).c_str(), mUseBubble ? HUD_TEXT_MAX_WIDTH : HUD_TEXT_MAX_WIDTH_NO_BUBBLE, wstr.length(), TRUE);
-				mLabelSegments.push_back(LLHUDTextSegment(iter->substr(line_length, segment_length), LLFontGL::NORMAL, mColor));
-				line_length += segment_length;
+				wrapped.back().getWidth(mBoldFontp);
 			}
-			while (line_length != iter->size());
-			++iter;
+			line_length += segment_length;
 		}
+		while (line_length != line.size());
 	}
+
+	for (std::vector<LLHUDTextSegment>::const_iterator segment_iter = cache_iter->second.begin();
+		 segment_iter != cache_iter->second.end(); ++segment_iter)
+	{
+		segments.push_back(*segment_iter);
+		segments.back().mColor = color;
+	}
+}
+
+void LLHUDText::ageLayoutCache()
+{
+	mOldLayoutCache.clear();
+	mOldLayoutCache.swap(mLayoutCache);
 }
 
 void LLHUDText::setDropShadow(const BOOL do_shadow)
@@ -1128,6 +1176,9 @@ void LLHUDText::reshape()
 		{
 			segment_iter->clearFontWidthMap();
 		}		
+		// wrapping depends on the font scale too
+		textp->mLayoutCache.clear();
+		textp->mOldLayoutCache.clear();
 	}
 }
 
@@ -1147,3 +1198,26 @@ F32 LLHUDText::LLHUDTextSegment::getWidth(const LLFontGL* font)
 		return width;
 	}
 }
+
+//============================================================================
+
+bool LLHUDText::LLHUDTextLayoutKey::operator<(const LLHUDTextLayoutKey& rhs) const
+{
+	if (mFontp != rhs.mFontp)
+	{
+		return mFontp < rhs.mFontp;
+	}
+	if (mBoldFontp != rhs.mBoldFontp)
+	{
+		return mBoldFontp < rhs.mBoldFontp;
+	}
+	if (mMaxWidth != rhs.mMaxWidth)
+	{
+		return mMaxWidth < rhs.mMaxWidth;
+	}
+	if (mStyle != rhs.mStyle)
+	{
+		return mStyle < rhs.mStyle;
+	}
+	return mText < rhs.mText;
+}
@@ -42,6 +42,7 @@
 #include "llrect.h"
 #include "llframetimer.h"
 #include "llfontgl.h"
+#include <map>
 #include <set>
 #include <vector>
 #include "lldarray.h"
@@ -130,6 +131,9 @@ public:
 	static void addPickable(std::set<LLViewerObject*> &pick_list);
 	static void reshape();
 	static void setDisplayText(BOOL flag) { sDisplayText = flag ; }
+	// Layout cache lookups since the last reset, for the render info display
+	static void getLayoutCacheStats(U32& hits, U32& misses) { hits = sLayoutCacheHits; misses = sLayoutCacheMisses; }
+	static void resetLayoutCacheStats() { sLayoutCacheHits = sLayoutCacheMisses = 0; }
 protected:
 	LLHUDText(const U8 type);
 
@@ -142,6 +146,29 @@ protected:
 
 private:
 	~LLHUDText();
+
+	// Wraps one line of text to the bubble width and appends the segments,
+	// reusing the wrapped and measured result from the layout cache if the
+	// same line has been laid out recently.
+	void layoutLine(const LLWString& line, const LLFontGL::StyleFlags style, const LLColor4& color, std::vector<LLHUDTextSegment>& segments);
+	// Start a new cache generation.  Lines not laid out again before the
+	// next call are dropped.
+	void ageLayoutCache();
+
+	struct LLHUDTextLayoutKey
+	{
+		LLHUDTextLayoutKey(const LLWString& text, const LLFontGL* fontp, const LLFontGL* bold_fontp, F32 max_width, LLFontGL::StyleFlags style)
+			: mText(text), mFontp(fontp), mBoldFontp(bold_fontp), mMaxWidth(max_width), mStyle(style) {}
+		bool operator<(const LLHUDTextLayoutKey& rhs) const;
+
+		LLWString				mText;
+		const LLFontGL*			mFontp;
+		const LLFontGL*			mBoldFontp;		// bold lines are measured with it too
+		F32						mMaxWidth;
+		LLFontGL::StyleFlags	mStyle;
+	};
+	typedef std::map<LLHUDTextLayoutKey, std::vector<LLHUDTextSegment> > layout_cache_t;
+
 	BOOL			mOnHUD;
 	BOOL			mUseBubble;
 	BOOL			mDropShadow;
@@ -175,8 +202,12 @@ private:
 	EVertAlignment	mVertAlignment;
 	S32				mLOD;
 	BOOL			mHidden;
+	layout_cache_t	mLayoutCache;		// lines laid out in this generation
+	layout_cache_t	mOldLayoutCache;	// lines laid out in the previous one
 
 	static BOOL    sDisplayText ;
+	static U32		sLayoutCacheHits;
+	static U32		sLayoutCacheMisses;
 	static std::set<LLPointer<LLHUDText> > sTextObjects;
 	static std::vector<LLPointer<LLHUDText> > sVisibleTextObjects;
 	static std::vector<LLPointer<LLHUDText> > sVisibleHUDTextObjects;
@@ -40,6 +40,7 @@
 #include "llviewercamera.h"
 #include "llface.h"
 #include "llviewercontrol.h"
+#include "lljobsystem.h"
 #include "llagent.h"
 #include "llviewerregion.h"
 #include "llcamera.h"
@@ -929,7 +930,10 @@ LLSpatialGroup::LLSpatialGroup(OctreeNode* node, LLSpatialPartition* part) :
 	mLastUpdateDistance(-1.f), 
 	mLastUpdateTime(gFrameTimeSeconds),
 	mViewAngle(0.f),
-	mLastUpdateViewAngle(-1.f)
+	mLastUpdateViewAngle(-1.f),
+	mCullPass(0),
+	mCullFrustum(0),
+	mCullObjects(-1)
 {
 	sNodeCount++;
 	LLMemType mt(LLMemType::MTYPE_SPACE_PARTITION);
@@ -1462,7 +1466,49 @@ class LLOctreeCull : public LLSpatialGroup::OctreeTraveler
 {
 public:
 	LLOctreeCull(LLCamera* camera)
-		: mCamera(camera), mRes(0) { }
+		: mCamera(camera), mRes(0), mCullPass(0) { }
+
+	// Same as traverse(), but with LLPipeline::sParallelCull set the frustum
+	// tests are first run for each child of the root on the job threads.
+	// The serial traversal that follows reads those results instead of
+	// recomputing them, so what gets culled does not change.
+	void cull(const LLSpatialGroup::TreeNode* n)
+	{
+		if (LLPipeline::sParallelCull && n->getChildCount() > 1 && LLJobSystem::getInstance())
+		{
+			if (++sCullPass == 0)
+			{ //0 means "nothing cached"
+				++sCullPass;
+			}
+			mCullPass = sCullPass;
+
+			//the root goes first on this thread, which also gets any static
+			//initialization in the frustum tests out of the way
+			if (classifyGroup(n, frustumCheck((LLSpatialGroup*) n->getListener(0))))
+			{
+				std::vector<LLJob*> jobs;
+				for (U32 i = 0; i < n->getChildCount(); i++)
+				{
+					jobs.push_back(new LLOctreeClassifyJob(this, n->getChild(i)));
+				}
+				LLJobSystem::getInstance()->run(jobs);
+				std::for_each(jobs.begin(), jobs.end(), DeletePointer());
+			}
+		}
+
+		traverse(n);
+		mCullPass = 0;
+	}
+
+	// Run on the job threads.  Only touches the cull members of groups
+	// below n, and only reads the camera and group bounds.
+	void classify(const LLSpatialGroup::TreeNode* n)
+	{
+		if (classifyGroup(n, frustumCheck((LLSpatialGroup*) n->getListener(0))))
+		{
+			classifyChildren(n);
+		}
+	}
 
 	virtual bool earlyFail(LLSpatialGroup* group)
 	{
@@ -1495,7 +1541,7 @@ public:
 		}
 		else
 		{
-			mRes = frustumCheck(group);
+			mRes = cachedFrustumCheck(group);
 				
 			if (mRes)
 			{ //at least partially in, run on down
@@ -1526,6 +1572,29 @@ public:
 		return res;
 	}
 
+	// Frustum test several groups at once.  Must give exactly what
+	// frustumCheck() gives for each group.
+	virtual void frustumCheckBatch(LLSpatialGroup** groups, S32* res, U32 count)
+	{
+		LLVector3 centers[8];
+		LLVector3 radii[8];
+		for (U32 i = 0; i < count; i++)
+		{
+			centers[i] = groups[i]->mBounds[0];
+			radii[i] = groups[i]->mBounds[1];
+		}
+
+		mCamera->AABBInFrustumNoFarClipBatch(centers, radii, res, count);
+
+		for (U32 i = 0; i < count; i++)
+		{
+			if (res[i] != 0)
+			{
+				res[i] = llmin(res[i], AABBSphereIntersect(groups[i]->mExtents[0], groups[i]->mExtents[1], mCamera->getOrigin(), mCamera->mFrustumCornerDist));
+			}
+		}
+	}
+
 	virtual bool checkObjects(const LLSpatialGroup::OctreeNode* branch, const LLSpatialGroup* group)
 	{
 		if (branch->getElementCount() == 0) //no elements
@@ -1536,7 +1605,7 @@ public:
 		{
 			return true;
 		}
-		else if (mRes == 1 && !frustumCheckObjects(group)) //no objects in frustum
+		else if (mRes == 1 && !cachedFrustumCheckObjects(group)) //no objects in frustum
 		{
 			return false;
 		}
@@ -1573,8 +1642,98 @@ public:
 
 	LLCamera *mCamera;
 	S32 mRes;
+
+protected:
+	class LLOctreeClassifyJob : public LLJob
+	{
+	public:
+		LLOctreeClassifyJob(LLOctreeCull* culler, const LLSpatialGroup::TreeNode* node)
+			: mCuller(culler), mNode(node) { }
+
+		/*virtual*/ void run()
+		{
+			mCuller->classify(mNode);
+		}
+
+	private:
+		LLOctreeCull* mCuller;
+		const LLSpatialGroup::TreeNode* mNode;
+	};
+
+	void classifyChildren(const LLSpatialGroup::TreeNode* n)
+	{
+		LLSpatialGroup* groups[8];
+		S32 res[8];
+
+		for (U32 i = 0; i < n->getChildCount(); i += 8)
+		{
+			U32 count = llmin(n->getChildCount() - i, (U32) 8);
+			for (U32 j = 0; j < count; j++)
+			{
+				groups[j] = (LLSpatialGroup*) n->getChild(i + j)->getListener(0);
+			}
+
+			frustumCheckBatch(groups, res, count);
+
+			for (U32 j = 0; j < count; j++)
+			{
+				const LLSpatialGroup::TreeNode* child = n->getChild(i + j);
+				if (classifyGroup(child, res[j]))
+				{
+					classifyChildren(child);
+				}
+			}
+		}
+	}
+
+	// Caches the tests traverse() and checkObjects() may ask for on this
+	// node, given its frustumCheck() result.  Returns true if the serial
+	// pass could test its children.
+	bool classifyGroup(const LLSpatialGroup::TreeNode* n, S32 frustum)
+	{
+		LLSpatialGroup* group = (LLSpatialGroup*) n->getListener(0);
+		bool descend = false;
+
+		group->mCullFrustum = frustum;
+		group->mCullObjects = -1;
+		if (group->mCullFrustum == 1 || 
+			(group->mCullFrustum && group->isState(LLSpatialGroup::SKIP_FRUSTUM_CHECK)))
+		{
+			if (n->getElementCount() > 0 && n->getChildCount() > 0)
+			{
+				group->mCullObjects = frustumCheckObjects(group);
+			}
+			descend = true;
+		}
+		group->mCullPass = mCullPass;
+
+		return descend;
+	}
+
+	S32 cachedFrustumCheck(const LLSpatialGroup* group)
+	{
+		if (mCullPass && group->mCullPass == mCullPass)
+		{
+			return group->mCullFrustum;
+		}
+		return frustumCheck(group);
+	}
+
+	S32 cachedFrustumCheckObjects(const LLSpatialGroup* group)
+	{
+		if (mCullPass && group->mCullPass == mCullPass && group->mCullObjects != -1)
+		{
+			return group->mCullObjects;
+		}
+		return frustumCheckObjects(group);
+	}
+
+	U32 mCullPass;
+	static U32 sCullPass;
 };
 
+U32 LLOctreeCull::sCullPass = 0;
+
 class LLOctreeCullNoFarClip : public LLOctreeCull
 {
 public: 
@@ -1586,6 +1745,19 @@ public:
 		return mCamera->AABBInFrustumNoFarClip(group->mBounds[0], group->mBounds[1]);
 	}
 
+	virtual void frustumCheckBatch(LLSpatialGroup** groups, S32* res, U32 count)
+	{
+		LLVector3 centers[8];
+		LLVector3 radii[8];
+		for (U32 i = 0; i < count; i++)
+		{
+			centers[i] = groups[i]->mBounds[0];
+			radii[i] = groups[i]->mBounds[1];
+		}
+
+		mCamera->AABBInFrustumNoFarClipBatch(centers, radii, res, count);
+	}
+
 	virtual S32 frustumCheckObjects(const LLSpatialGroup* group)
 	{
 		S32 res = mCamera->AABBInFrustumNoFarClip(group->mObjectBounds[0], group->mObjectBounds[1]);
@@ -1775,13 +1947,13 @@ S32 LLSpatialPartition::cull(LLCamera &camera, std::vector<LLDrawable *>* result
 	{
 		LLFastTimer ftm(LLFastTimer::FTM_FRUSTUM_CULL);		
 		LLOctreeCullNoFarClip culler(&camera);
-		culler.traverse(mOctree);
+		culler.cull(mOctree);
 	}
 	else
 	{
 		LLFastTimer ftm(LLFastTimer::FTM_FRUSTUM_CULL);		
 		LLOctreeCull culler(&camera);
-		culler.traverse(mOctree);
+		culler.cull(mOctree);
 	}
 	
 	return 0;
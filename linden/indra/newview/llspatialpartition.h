@@ -277,6 +277,12 @@ public:
 	
 	F32 mPixelArea;
 	F32 mRadius;
+
+	// frustum results precomputed by a parallel cull, valid while
+	// mCullPass matches the pass of the culler reading them
+	U32 mCullPass;
+	S32 mCullFrustum;
+	S32 mCullObjects;
 };
 
 class LLGeometryManager
@@ -0,0 +1,558 @@
+/** 
+ * @file lltexturebodystore.cpp
+ * @brief Packed, extent allocated storage for texture cache bodies
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include "llviewerprecompiledheaders.h"
+
+#include "lltexturebodystore.h"
+
+#include "llapr.h"
+#include "llmappedfile.h"
+
+const U32 BODY_STORE_MAGIC = 0x53424354; // 'TCBS'
+const U32 BODY_STORE_VERSION = 2;
+const S32 BODY_STORE_BLOCK_SIZE = 1024;
+const S64 BODY_STORE_GROW_SIZE = 32*1024*1024; // preallocate the data file in 32 MB steps
+
+static inline S32 round_to_block(S32 size)
+{
+	return (size + BODY_STORE_BLOCK_SIZE - 1) & ~(BODY_STORE_BLOCK_SIZE - 1);
+}
+
+LLTextureBodyStore::LLTextureBodyStore()
+	: mMutex(NULL),
+	  mReadOnly(FALSE),
+	  mMaxSize(0),
+	  mDataSize(0),
+	  mUsedBytes(0),
+	  mNumSlots(0)
+{
+}
+
+LLTextureBodyStore::~LLTextureBodyStore()
+{
+	close();
+}
+
+bool LLTextureBodyStore::open(const std::string& data_filename, const std::string& table_filename,
+							  S64 max_size, BOOL read_only, bool* created)
+{
+	LLMutexLock lock(&mMutex);
+	mReadOnly = read_only;
+	mMaxSize = max_size;
+	if (created)
+	{
+		*created = !ll_apr_file_exists(table_filename, NULL);
+	}
+	if (!mDataFile.open(data_filename, !read_only) || !mTableFile.open(table_filename, !read_only))
+	{
+		LL_WARNS("TextureCache") << "Unable to open texture body store " << data_filename << LL_ENDL;
+		mDataFile.close();
+		mTableFile.close();
+		return false;
+	}
+	if (!loadTable())
+	{
+		if (read_only)
+		{
+			mDataFile.close();
+			mTableFile.close();
+			return false;
+		}
+		LL_INFOS("TextureCache") << "Resetting texture body store " << data_filename << LL_ENDL;
+		mExtents.clear();
+		mFreeByOffset.clear();
+		mFreeByLength.clear();
+		mFreeSlots.clear();
+		mNumSlots = 0;
+		mUsedBytes = 0;
+		mDataSize = 0;
+		mTableFile.setSize(0);
+		mDataFile.setSize(0);
+		writeTableInfo();
+		if (created)
+		{
+			*created = true;
+		}
+	}
+	return true;
+}
+
+void LLTextureBodyStore::close()
+{
+	LLMutexLock lock(&mMutex);
+	mDataFile.close();
+	mTableFile.close();
+	mExtents.clear();
+	mFreeByOffset.clear();
+	mFreeByLength.clear();
+	mPinned.clear();
+	mDeferredFree.clear();
+	mFreeSlots.clear();
+	mNumSlots = 0;
+	mUsedBytes = 0;
+	mDataSize = 0;
+}
+
+void LLTextureBodyStore::clear()
+{
+	LLMutexLock lock(&mMutex);
+	if (!isOpen() || mReadOnly)
+	{
+		return;
+	}
+	// Extents that are still being read or mapped stay allocated until
+	// unpin() releases them; everything else is free space now.
+	deferred_map_t pinned_extents;
+	for (deferred_map_t::iterator iter = mDeferredFree.begin(); iter != mDeferredFree.end(); ++iter)
+	{
+		pinned_extents[iter->first] = iter->second;
+	}
+	for (extent_map_t::iterator iter = mExtents.begin(); iter != mExtents.end(); ++iter)
+	{
+		if (mPinned.find(iter->second.mOffset) != mPinned.end())
+		{
+			pinned_extents[iter->second.mOffset] = iter->second.mCapacity;
+		}
+	}
+	mExtents.clear();
+	mFreeByOffset.clear();
+	mFreeByLength.clear();
+	mDeferredFree.swap(pinned_extents);
+	mFreeSlots.clear();
+	mNumSlots = 0;
+	mUsedBytes = 0;
+	mTableFile.setSize(0);
+	writeTableInfo();
+	// Keep the preallocated data file, free around the pinned extents
+	S64 span_start = 0;
+	for (deferred_map_t::iterator iter = mDeferredFree.begin(); iter != mDeferredFree.end(); ++iter)
+	{
+		addFreeSpan(span_start, iter->first - span_start);
+		span_start = iter->first + iter->second;
+	}
+	addFreeSpan(span_start, mDataSize - span_start);
+}
+
+// Called with mMutex locked. Rebuilds the extent and free maps from the table.
+bool LLTextureBodyStore::loadTable()
+{
+	S64 table_size = mTableFile.getSize();
+	if (table_size < (S64)sizeof(TableInfo))
+	{
+		return false;
+	}
+	TableInfo info;
+	if (mTableFile.read(&info, 0, sizeof(TableInfo)) != sizeof(TableInfo) ||
+		info.mMagic != BODY_STORE_MAGIC ||
+		info.mVersion != BODY_STORE_VERSION ||
+		info.mBlockSize != (U32)BODY_STORE_BLOCK_SIZE)
+	{
+		return false;
+	}
+	mDataSize = llmin(info.mDataSize, mDataFile.getSize());
+
+	S32 num_entries = (S32)((table_size - sizeof(TableInfo)) / sizeof(TableEntry));
+	std::vector<TableEntry> entries(num_entries);
+	if (num_entries > 0 &&
+		mTableFile.read(&entries[0], sizeof(TableInfo), num_entries * sizeof(TableEntry)) != num_entries * (S32)sizeof(TableEntry))
+	{
+		return false;
+	}
+
+	std::map<S64, S32> by_offset; // offset, capacity of every live extent
+	mNumSlots = num_entries;
+	for (S32 slot = 0; slot < num_entries; slot++)
+	{
+		const TableEntry& entry = entries[slot];
+		bool valid = entry.mLength > 0 &&
+			entry.mCapacity >= entry.mLength &&
+			entry.mOffset >= 0 &&
+			entry.mOffset + entry.mCapacity <= mDataSize &&
+			mExtents.find(entry.mID) == mExtents.end();
+		if (valid)
+		{
+			// Reject extents that overlap a neighbour (table written mid-crash)
+			std::map<S64, S32>::iterator next = by_offset.lower_bound(entry.mOffset);
+			if (next != by_offset.end() && next->first < entry.mOffset + entry.mCapacity)
+			{
+				valid = false;
+			}
+			else if (next != by_offset.begin())
+			{
+				std::map<S64, S32>::iterator prev = next;
+				--prev;
+				valid = prev->first + prev->second <= entry.mOffset;
+			}
+		}
+		if (!valid)
+		{
+			mFreeSlots.push_back(slot);
+			continue;
+		}
+		Extent& extent = mExtents[entry.mID];
+		extent.mOffset = entry.mOffset;
+		extent.mLength = entry.mLength;
+		extent.mCapacity = entry.mCapacity;
+		extent.mSlot = slot;
+		mUsedBytes += entry.mCapacity;
+		by_offset[entry.mOffset] = entry.mCapacity;
+	}
+
+	// Everything between live extents is free
+	S64 pos = 0;
+	for (std::map<S64, S32>::iterator iter = by_offset.begin(); iter != by_offset.end(); ++iter)
+	{
+		if (iter->first > pos)
+		{
+			addFreeSpan(pos, iter->first - pos);
+		}
+		pos = iter->first + iter->second;
+	}
+	if (mDataSize > pos)
+	{
+		addFreeSpan(pos, mDataSize - pos);
+	}
+
+	LL_INFOS("TextureCache") << "Texture body store: " << mExtents.size() << " bodies, "
+							 << mUsedBytes/(1024*1024) << " MB used of "
+							 << mDataSize/(1024*1024) << " MB" << LL_ENDL;
+	return true;
+}
+
+// Called with mMutex locked
+void LLTextureBodyStore::writeTableInfo()
+{
+	TableInfo info;
+	memset(&info, 0, sizeof(info));
+	info.mMagic = BODY_STORE_MAGIC;
+	info.mVersion = BODY_STORE_VERSION;
+	info.mBlockSize = BODY_STORE_BLOCK_SIZE;
+	info.mDataSize = mDataSize;
+	mTableFile.write(&info, 0, sizeof(info));
+}
+
+// Called with mMutex locked
+void LLTextureBodyStore::writeTableEntry(S32 slot, const LLUUID& id, const Extent& extent)
+{
+	TableEntry entry;
+	memset(&entry, 0, sizeof(entry));
+	entry.mID = id;
+	entry.mOffset = extent.mOffset;
+	entry.mLength = extent.mLength;
+	entry.mCapacity = extent.mCapacity;
+	mTableFile.write(&entry, sizeof(TableInfo) + (S64)slot * sizeof(TableEntry), sizeof(entry));
+}
+
+// Called with mMutex locked
+S32 LLTextureBodyStore::allocateSlot()
+{
+	if (!mFreeSlots.empty())
+	{
+		S32 slot = mFreeSlots.back();
+		mFreeSlots.pop_back();
+		return slot;
+	}
+	return mNumSlots++;
+}
+
+// Called with mMutex locked. Best fit from the free list, growing the data
+// file (up to mMaxSize) when nothing fits.
+bool LLTextureBodyStore::allocateExtent(S32 capacity, S64* offset)
+{
+	free_length_map_t::iterator fit = mFreeByLength.lower_bound(capacity);
+	if (fit == mFreeByLength.end())
+	{
+		if (mDataSize + capacity > mMaxSize)
+		{
+			return false;
+		}
+		S64 new_size = llmin(mMaxSize, mDataSize + llmax((S64)capacity, BODY_STORE_GROW_SIZE));
+		if (!mDataFile.setSize(new_size))
+		{
+			LL_WARNS("TextureCache") << "Unable to grow texture body store to " << new_size << " bytes" << LL_ENDL;
+			return false;
+		}
+		S64 old_size = mDataSize;
+		mDataSize = new_size;
+		writeTableInfo();
+		addFreeSpan(old_size, new_size - old_size);
+		fit = mFreeByLength.lower_bound(capacity);
+		llassert_always(fit != mFreeByLength.end());
+	}
+	S64 span_offset = fit->second;
+	S64 span_length = fit->first;
+	removeFreeSpan(mFreeByOffset.find(span_offset));
+	if (span_length > capacity)
+	{
+		addFreeSpan(span_offset + capacity, span_length - capacity);
+	}
+	*offset = span_offset;
+	mUsedBytes += capacity;
+	return true;
+}
+
+// Called with mMutex locked
+void LLTextureBodyStore::releaseExtent(S64 offset, S32 capacity)
+{
+	mUsedBytes -= capacity;
+	if (mPinned.find(offset) != mPinned.end())
+	{
+		// Being read; unpin() frees it
+		mDeferredFree[offset] = capacity;
+		return;
+	}
+	addFreeSpan(offset, capacity);
+}
+
+// Called with mMutex locked. Coalesces with adjacent free spans.
+void LLTextureBodyStore::addFreeSpan(S64 offset, S64 length)
+{
+	if (length <= 0)
+	{
+		return;
+	}
+	free_offset_map_t::iterator next = mFreeByOffset.lower_bound(offset);
+	if (next != mFreeByOffset.begin())
+	{
+		free_offset_map_t::iterator prev = next;
+		--prev;
+		if (prev->first + prev->second == offset)
+		{
+			offset = prev->first;
+			length += prev->second;
+			removeFreeSpan(prev);
+		}
+	}
+	if (next != mFreeByOffset.end() && offset + length == next->first)
+	{
+		length += next->second;
+		removeFreeSpan(next);
+	}
+	mFreeByOffset[offset] = length;
+	mFreeByLength.insert(std::make_pair(length, offset));
+}
+
+// Called with mMutex locked
+void LLTextureBodyStore::removeFreeSpan(free_offset_map_t::iterator iter)
+{
+	llassert_always(iter != mFreeByOffset.end());
+	std::pair<free_length_map_t::iterator, free_length_map_t::iterator> range = mFreeByLength.equal_range(iter->second);
+	for (free_length_map_t::iterator liter = range.first; liter != range.second; ++liter)
+	{
+		if (liter->second == iter->first)
+		{
+			mFreeByLength.erase(liter);
+			break;
+		}
+	}
+	mFreeByOffset.erase(iter);
+}
+
+// Called with mMutex locked
+void LLTextureBodyStore::unpin(S64 offset)
+{
+	pin_map_t::iterator iter = mPinned.find(offset);
+	if (iter == mPinned.end())
+	{
+		return; // store was closed while pinned
+	}
+	if (--iter->second > 0)
+	{
+		return;
+	}
+	mPinned.erase(iter);
+	deferred_map_t::iterator deferred = mDeferredFree.find(offset);
+	if (deferred != mDeferredFree.end())
+	{
+		addFreeSpan(offset, deferred->second);
+		mDeferredFree.erase(deferred);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+S32 LLTextureBodyStore::getSize(const LLUUID& id)
+{
+	LLMutexLock lock(&mMutex);
+	extent_map_t::iterator iter = mExtents.find(id);
+	return iter != mExtents.end() ? iter->second.mLength : 0;
+}
+
+S32 LLTextureBodyStore::read(const LLUUID& id, U8* data, S32 offset, S32 size)
+{
+	S64 extent_offset;
+	{
+		LLMutexLock lock(&mMutex);
+		extent_map_t::iterator iter = mExtents.find(id);
+		if (iter == mExtents.end() || offset < 0 || offset + size > iter->second.mLength)
+		{
+			return -1;
+		}
+		extent_offset = iter->second.mOffset;
+		mPinned[extent_offset]++;
+	}
+
+	S32 bytes_read = mDataFile.read(data, extent_offset + offset, size);
+
+	LLMutexLock lock(&mMutex);
+	unpin(extent_offset);
+	return bytes_read;
+}
+
+S32 LLTextureBodyStore::write(const LLUUID& id, const U8* data, S32 size)
+{
+	if (mReadOnly || size <= 0)
+	{
+		return -1;
+	}
+	Extent extent;
+	extent.mLength = size;
+	extent.mCapacity = round_to_block(size);
+	{
+		LLMutexLock lock(&mMutex);
+		if (!allocateExtent(extent.mCapacity, &extent.mOffset))
+		{
+			return -1;
+		}
+	}
+
+	// Nobody else can see the new extent yet
+	S32 bytes_written = mDataFile.write(data, extent.mOffset, size);
+
+	LLMutexLock lock(&mMutex);
+	if (bytes_written != size)
+	{
+		releaseExtent(extent.mOffset, extent.mCapacity);
+		return -1;
+	}
+	extent_map_t::iterator iter = mExtents.find(id);
+	if (iter != mExtents.end())
+	{
+		// Replace the old body, reusing its table record
+		extent.mSlot = iter->second.mSlot;
+		releaseExtent(iter->second.mOffset, iter->second.mCapacity);
+		iter->second = extent;
+	}
+	else
+	{
+		extent.mSlot = allocateSlot();
+		mExtents[id] = extent;
+	}
+	writeTableEntry(extent.mSlot, id, extent);
+	return bytes_written;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+class LLTextureBodyStoreView : public LLImageDataView
+{
+protected:
+	/*virtual*/ ~LLTextureBodyStoreView()
+	{
+		mFile.close();
+		LLMutexLock lock(&mStore->mMutex);
+		mStore->unpin(mExtentOffset);
+	}
+
+public:
+	LLTextureBodyStoreView(LLTextureBodyStore* store, S64 extent_offset)
+		: LLImageDataView(NULL, 0),
+		  mStore(store),
+		  mExtentOffset(extent_offset)
+	{
+	}
+
+	bool map(const std::string& filename, S64 offset, S32 size)
+	{
+		if (!mFile.openRange(filename, offset, size))
+		{
+			return false;
+		}
+		mData = mFile.getData();
+		mSize = mFile.getSize();
+		return true;
+	}
+
+private:
+	LLPointer<LLTextureBodyStore> mStore;
+	S64 mExtentOffset;
+	LLMappedFile mFile;
+};
+
+LLPointer<LLImageDataView> LLTextureBodyStore::mapView(const LLUUID& id, S32 offset, S32 size)
+{
+	S64 extent_offset;
+	{
+		LLMutexLock lock(&mMutex);
+		extent_map_t::iterator iter = mExtents.find(id);
+		if (iter == mExtents.end() || size <= 0 || offset < 0 || offset + size > iter->second.mLength)
+		{
+			return NULL;
+		}
+		extent_offset = iter->second.mOffset;
+		mPinned[extent_offset]++;
+	}
+
+	// The view unpins the extent when it goes away, even if mapping fails
+	LLPointer<LLTextureBodyStoreView> view = new LLTextureBodyStoreView(this, extent_offset);
+	if (!view->map(mDataFile.getFileName(), extent_offset + offset, size))
+	{
+		return NULL;
+	}
+	return view.get();
+}
+
+bool LLTextureBodyStore::remove(const LLUUID& id)
+{
+	LLMutexLock lock(&mMutex);
+	extent_map_t::iterator iter = mExtents.find(id);
+	if (mReadOnly || iter == mExtents.end())
+	{
+		return false;
+	}
+	Extent extent = iter->second;
+	mExtents.erase(iter);
+	writeTableEntry(extent.mSlot, LLUUID::null, Extent());
+	mFreeSlots.push_back(extent.mSlot);
+	releaseExtent(extent.mOffset, extent.mCapacity);
+	return true;
+}
+
+void LLTextureBodyStore::dumpStatistics()
+{
+	LLMutexLock lock(&mMutex);
+	S64 largest_free = mFreeByLength.empty() ? 0 : mFreeByLength.rbegin()->first;
+	LL_INFOS("TextureCache") << "Texture body store: " << mExtents.size() << " bodies"
+							 << " used: " << mUsedBytes/1024 << " KB"
+							 << " file: " << mDataSize/1024 << " KB"
+							 << " free spans: " << mFreeByOffset.size()
+							 << " largest free: " << largest_free/1024 << " KB" << LL_ENDL;
+}
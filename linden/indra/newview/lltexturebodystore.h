@@ -0,0 +1,146 @@
+/** 
+ * @file lltexturebodystore.h
+ * @brief Packed, extent allocated storage for texture cache bodies
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLTEXTUREBODYSTORE_H
+#define LL_LLTEXTUREBODYSTORE_H
+
+#include "llimage.h"
+#include "llpositionalfile.h"
+#include "llthread.h"
+#include "lluuid.h"
+
+// Keeps the bodies of cached textures (everything past the header entry) in
+// one large, preallocated data file instead of one file per texture.
+// Space is handed out in extents from a best-fit free list and returned to
+// it on eviction, so purging a texture never touches the file system.
+// A small table file records the extent owned by each texture.
+//
+// All methods are thread safe. Data is transferred with positional I/O
+// outside the lock; an extent that is being read (or has a mapped view)
+// when it is freed is only returned to the free list once the read
+// completes (or the view is released).
+class LLTextureBodyStore : public LLThreadSafeRefCount
+{
+	friend class LLTextureBodyStoreView;
+
+protected:
+	/*virtual*/ ~LLTextureBodyStore();
+
+public:
+	LLTextureBodyStore();
+
+	// Returns false if the store could not be opened. created is set when
+	// the store did not previously exist.
+	bool open(const std::string& data_filename, const std::string& table_filename,
+			  S64 max_size, BOOL read_only, bool* created = NULL);
+	void close();
+	bool isOpen() const { return mDataFile.isOpen(); }
+	// Drops every body. Extents still pinned by a read or view are only
+	// returned to the free list when they are released.
+	void clear();
+
+	// Size of the stored body, 0 if none
+	S32 getSize(const LLUUID& id);
+	// Return bytes transferred, or -1 on error
+	S32 read(const LLUUID& id, U8* data, S32 offset, S32 size);
+	S32 write(const LLUUID& id, const U8* data, S32 size); // replaces any existing body
+	bool remove(const LLUUID& id);
+	// Read only, memory mapped view of part of a body; NULL on failure.
+	// The view keeps the extent (and the store) alive.
+	LLPointer<LLImageDataView> mapView(const LLUUID& id, S32 offset, S32 size);
+
+	void dumpStatistics();
+
+private:
+	struct Extent
+	{
+		Extent() : mOffset(0), mLength(0), mCapacity(0), mSlot(-1) {}
+		S64 mOffset;
+		S32 mLength; // bytes of body data
+		S32 mCapacity; // bytes allocated, a multiple of BLOCK_SIZE
+		S32 mSlot; // record in the table file
+	};
+
+	// On disk records in the table file (the first record is a TableInfo)
+	struct TableInfo
+	{
+		U32 mMagic;
+		U32 mVersion;
+		U32 mBlockSize;
+		U32 mPad;
+		S64 mDataSize;
+		S64 mPad2;
+	};
+	struct TableEntry
+	{
+		LLUUID mID;
+		S64 mOffset;
+		S32 mLength; // 0 marks an unused record
+		S32 mCapacity;
+	};
+
+	bool loadTable();
+	void writeTableInfo();
+	void writeTableEntry(S32 slot, const LLUUID& id, const Extent& extent);
+	S32 allocateSlot();
+	bool allocateExtent(S32 capacity, S64* offset);
+	void releaseExtent(S64 offset, S32 capacity);
+	void addFreeSpan(S64 offset, S64 length);
+	void removeFreeSpan(std::map<S64,S64>::iterator iter);
+	void unpin(S64 offset);
+
+private:
+	LLMutex mMutex;
+	LLPositionalFile mDataFile;
+	LLPositionalFile mTableFile;
+	BOOL mReadOnly;
+	S64 mMaxSize;
+	S64 mDataSize; // current (preallocated) size of the data file
+
+	typedef std::map<LLUUID, Extent> extent_map_t;
+	extent_map_t mExtents;
+	S64 mUsedBytes;
+
+	typedef std::map<S64, S64> free_offset_map_t; // offset, length
+	typedef std::multimap<S64, S64> free_length_map_t; // length, offset
+	free_offset_map_t mFreeByOffset;
+	free_length_map_t mFreeByLength;
+
+	typedef std::map<S64, S32> pin_map_t; // extent offset, active reads
+	pin_map_t mPinned;
+	typedef std::map<S64, S32> deferred_map_t; // extent offset, capacity
+	deferred_map_t mDeferredFree;
+
+	std::vector<S32> mFreeSlots;
+	S32 mNumSlots;
+};
+
+#endif // LL_LLTEXTUREBODYSTORE_H
@@ -147,11 +147,44 @@ protected:
 	EImageCodec mImageFormat;
 	BOOL mImageLocal;
 	LLPointer<LLTextureCache::Responder> mResponder;
+	LLPointer<LLImageDataView> mReadView; // replaces mReadData when the read could be mapped
 	LLLFSThread::handle_t mFileHandle;
 	S32 mBytesToRead;
 	LLAtomicS32 mBytesRead;
 };
 
+// Read only mapped view of a whole local texture file (or a prefix of it)
+class LLTextureCacheFileView : public LLImageDataView
+{
+public:
+	LLTextureCacheFileView() : LLImageDataView(NULL, 0) {}
+
+	bool map(const std::string& filename, S32 size)
+	{
+		if (!mFile.openRange(filename, 0, size))
+		{
+			return false;
+		}
+		mData = mFile.getData();
+		mSize = mFile.getSize();
+		return true;
+	}
+
+private:
+	LLMappedFile mFile;
+};
+
+// Maps the first size bytes of filename, or returns NULL
+static LLPointer<LLImageDataView> map_file_view(const std::string& filename, S32 size)
+{
+	LLPointer<LLTextureCacheFileView> view = new LLTextureCacheFileView;
+	if (!view->map(filename, size))
+	{
+		return NULL;
+	}
+	return view.get();
+}
+
 class LLTextureCacheLocalFileWorker : public LLTextureCacheWorker
 {
 public:
@@ -246,6 +279,17 @@ bool LLTextureCacheLocalFileWorker::doRead()
 	{
 		mDataSize = local_size;
 	}
+	if (mOffset == 0)
+	{
+		// Hand the file's pages straight to the image, no copy
+		mReadView = map_file_view(mFileName, mDataSize);
+		if (mReadView.notNull())
+		{
+			mImageSize = local_size;
+			mImageLocal = TRUE;
+			return true;
+		}
+	}
 	mReadData = new U8[mDataSize];
 	S32 bytes_read = ll_apr_file_read_ex(mFileName, mCache->getFileAPRPool(),
 										 mReadData, mOffset, mDataSize);
@@ -289,6 +333,9 @@ public:
 	virtual bool doWrite();
 
 private:
+	bool readBodyFromStore();
+	bool writeBodyToStore();
+
 	enum e_state
 	{
 		INIT = 0,
@@ -387,6 +434,16 @@ bool LLTextureCacheRemoteWorker::doRead()
 		{
 			mDataSize = local_size;
 		}
+		if (mOffset == 0)
+		{
+			mReadView = map_file_view(local_filename, mDataSize);
+			if (mReadView.notNull())
+			{
+				mImageSize = local_size;
+				mImageLocal = TRUE;
+				return true;
+			}
+		}
 		mReadData = new U8[mDataSize];
 		S32 bytes_read = ll_apr_file_read_ex(local_filename, mCache->getFileAPRPool(),
 											 mReadData, mOffset, mDataSize);
@@ -428,6 +485,22 @@ bool LLTextureCacheRemoteWorker::doRead()
 			mDataSize = 0; // no data
 			return true;
 		}
+
+		if (mOffset == 0 && mDataSize > TEXTURE_CACHE_ENTRY_SIZE && mCache->usingBodyStore())
+		{
+			// The body store holds the whole texture, map it in one piece
+			LLTextureBodyStore& store = mCache->getBodyStore();
+			S32 stored_size = llmin(store.getSize(mID), mDataSize);
+			if (stored_size > TEXTURE_CACHE_ENTRY_SIZE)
+			{
+				mReadView = store.mapView(mID, 0, stored_size);
+				if (mReadView.notNull())
+				{
+					mDataSize = stored_size;
+					return true;
+				}
+			}
+		}
 	}
 
 	if (mState == HEADER)
@@ -503,6 +576,11 @@ bool LLTextureCacheRemoteWorker::doRead()
 #endif
 	}
 
+	if (mState == BODY && mCache->usingBodyStore())
+	{
+		return readBodyFromStore();
+	}
+
 	if (mState == BODY)
 	{
 #if USE_LFS_READ
@@ -714,6 +792,11 @@ bool LLTextureCacheRemoteWorker::doWrite()
 #endif
 	}
 	
+	if (mState == BODY && mCache->usingBodyStore())
+	{
+		return writeBodyToStore();
+	}
+
 	if (mState == BODY)
 	{
 #if USE_LFS_WRITE
@@ -789,6 +872,65 @@ bool LLTextureCacheRemoteWorker::doWrite()
 	return false;
 }
 
+// Same as the BODY state of doRead(), but from the packed body store
+bool LLTextureCacheRemoteWorker::readBodyFromStore()
+{
+	LLTextureBodyStore& store = mCache->getBodyStore();
+	// Stored bodies are preceded by a copy of the header entry
+	S32 filesize = llmax(store.getSize(mID) - TEXTURE_CACHE_ENTRY_SIZE, 0);
+	if (filesize <= mOffset)
+	{
+		mDataSize = TEXTURE_CACHE_ENTRY_SIZE;
+		return true;
+	}
+	S32 datasize = TEXTURE_CACHE_ENTRY_SIZE + filesize;
+	mDataSize = llmin(datasize, mDataSize);
+	S32 data_offset = TEXTURE_CACHE_ENTRY_SIZE - mOffset;
+	data_offset = llmax(data_offset, 0);
+	S32 file_size = mDataSize - data_offset;
+	S32 file_offset = mOffset - TEXTURE_CACHE_ENTRY_SIZE;
+	file_offset = llmax(file_offset, 0);
+
+	U8* data = new U8[mDataSize];
+	if (data_offset > 0)
+	{
+		llassert_always(mReadData);
+		memcpy(data, mReadData, data_offset);
+		delete[] mReadData;
+	}
+	mReadData = data;
+	S32 bytes_read = store.read(mID, mReadData + data_offset, TEXTURE_CACHE_ENTRY_SIZE + file_offset, file_size);
+	if (bytes_read != file_size)
+	{
+		mDataSize = -1; // failed
+	}
+	return true;
+}
+
+// Same as the BODY state of doWrite(), but into the packed body store
+bool LLTextureCacheRemoteWorker::writeBodyToStore()
+{
+	S32 data_offset = TEXTURE_CACHE_ENTRY_SIZE - mOffset;
+	data_offset = llmax(data_offset, 0);
+	S32 file_size = mDataSize - data_offset;
+	// Textures are always written whole (writeToCache() passes offset 0), and
+	// the store keeps the header bytes too so reads can be mapped in one piece
+	llassert_always(mOffset == 0);
+	if (file_size > 0 && mCache->appendToTextureEntryList(mID, file_size))
+	{
+		S32 bytes_written = mCache->getBodyStore().write(mID, mWriteData, mDataSize);
+		if (bytes_written <= 0)
+		{
+			mDataSize = -1; // failed
+		}
+	}
+	else
+	{
+		mDataSize = 0; // no data written
+	}
+	return true;
+}
+
 //virtual
 bool LLTextureCacheWorker::doWork(S32 param)
 {
@@ -829,7 +971,12 @@ void LLTextureCacheWorker::finishWork(S32 param, bool completed)
 		if (param == 0)
 		{
 			// read
-			if (success)
+			if (success && mReadView.notNull())
+			{
+				mResponder->setDataView(mReadView, mImageSize, mImageFormat, mImageLocal);
+				mDataSize = 0;
+			}
+			else if (success)
 			{
 				mResponder->setData(mReadData, mDataSize, mImageSize, mImageFormat, mImageLocal);
 				mReadData = NULL; // responder owns data
@@ -840,6 +987,7 @@ void LLTextureCacheWorker::finishWork(S32 param, bool completed)
 				delete[] mReadData;
 				mReadData = NULL;
 			}
+			mReadView = NULL;
 		}
 		else
 		{
@@ -884,7 +1032,11 @@ LLTextureCache::LLTextureCache(bool threaded)
 	  mListMutex(getAPRPool()),
 	  mFileAPRPool(NULL),
 	  mReadOnly(FALSE),
+	  mIndexInfo(NULL),
+	  mIndexSlots(NULL),
+	  mIndexFreeList(NULL),
 	  mTexturesSizeTotal(0),
+	  mBodyStore(new LLTextureBodyStore),
 	  mDoPurge(FALSE)
 {
 	apr_pool_create(&mFileAPRPool, NULL);
@@ -893,6 +1045,8 @@ LLTextureCache::LLTextureCache(bool threaded)
 LLTextureCache::~LLTextureCache()
 {
 	purgeTextureFilesTimeSliced(TRUE); // VWR-3878 - NB - force-flush all pending file deletes
+	closeHeaderIndex();
+	mBodyStore->close();
 	apr_pool_destroy(mFileAPRPool);
 }
 
@@ -925,6 +1079,10 @@ S32 LLTextureCache::update(U32 max_time_ms)
 		}
 	}
 
+	unlockWorkers();
+	
+	// Responders take their fetcher's locks, and fetch workers call in here
+	// holding those, so they must run without mWorkersMutex.
 	for (responder_list_t::iterator iter1 = completed_list.begin();
 		 iter1 != completed_list.end(); ++iter1)
 	{
@@ -933,8 +1091,6 @@ S32 LLTextureCache::update(U32 max_time_ms)
 		responder->completed(success);
 	}
 	
-	unlockWorkers();
-	
 	return res;
 }
 
@@ -997,19 +1153,26 @@ bool LLTextureCache::appendToTextureEntryList(const LLUUID& id, S32 bodysize)
 //static
 const S32 MAX_REASONABLE_FILE_SIZE = 512*1024*1024; // 512 MB
 F32 LLTextureCache::sHeaderCacheVersion = 1.0f;
+U32 LLTextureCache::sHeaderIndexVersion = 1;
 U32 LLTextureCache::sCacheMaxEntries = MAX_REASONABLE_FILE_SIZE / TEXTURE_CACHE_ENTRY_SIZE;
 S64 LLTextureCache::sCacheMaxTexturesSize = 0; // no limit
 const char* entries_filename = "texture.entries";
 const char* cache_filename = "texture.cache";
+const char* index_filename = "texture.index";
 const char* textures_dirname = "textures";
+const char* body_store_filename = "texture.bodies";
+const char* body_store_table_filename = "texture.bodies.table";
 
 void LLTextureCache::setDirNames(ELLPath location)
 {
 	std::string delem = gDirUtilp->getDirDelimiter();
 	mHeaderEntriesFileName = gDirUtilp->getExpandedFilename(location, entries_filename);
 	mHeaderDataFileName = gDirUtilp->getExpandedFilename(location, cache_filename);
+	mHeaderIndexFileName = gDirUtilp->getExpandedFilename(location, index_filename);
 	mTexturesDirName = gDirUtilp->getExpandedFilename(location, textures_dirname);
 	mTexturesDirEntriesFileName = mTexturesDirName + delem + entries_filename;
+	mBodyStoreFileName = gDirUtilp->getExpandedFilename(location, body_store_filename);
+	mBodyStoreTableFileName = gDirUtilp->getExpandedFilename(location, body_store_table_filename);
 }
 
 void LLTextureCache::purgeCache(ELLPath location)
@@ -1018,8 +1181,16 @@ void LLTextureCache::purgeCache(ELLPath location)
 	{
 		setDirNames(location);
 	
+		{
+			LLMutexLock lock(&mHeaderMutex);
+			closeHeaderIndex();
+		}
+		ll_apr_file_remove(mHeaderIndexFileName, NULL);
 		ll_apr_file_remove(mHeaderEntriesFileName, NULL);
 		ll_apr_file_remove(mHeaderDataFileName, NULL);
+		mBodyStore->close();
+		ll_apr_file_remove(mBodyStoreTableFileName, NULL);
+		ll_apr_file_remove(mBodyStoreFileName, NULL);
 	}
 	purgeAllTextures(true);
 }
@@ -1054,84 +1225,424 @@ S64 LLTextureCache::initCache(ELLPath location, S64 max_size, BOOL read_only)
 			LLFile::mkdir(dirname);
 		}
 	}
-	readHeaderCache();
+	openHeaderIndex();
+	openBodyStore();
 	purgeTextures(true); // calc mTexturesSize and make some room in the texture cache if we need it
 
 	return max_size; // unused cache space
 }
 
-struct lru_data
+//////////////////////////////////////////////////////////////////////////////
+// Header index
+//
+// texture.index is mapped into memory for the lifetime of the cache and holds
+// everything needed to find a texture's header entry: an IndexInfo block,
+// followed by mCapacity IndexSlots (an open-addressed UUID hash table, linear
+// probing, with erased slots left as tombstones until the next rebuild),
+// followed by mMaxEntries S32s used as a stack of erased header entries.
+//
+// Lookups from the worker thread do not take mHeaderMutex; they retry if
+// mSequence changed (or was odd) while they probed. All modifications are
+// made under mHeaderMutex between beginIndexWrite() and endIndexWrite().
+// Eviction is a clock sweep over the slots: a slot is referenced whenever it
+// is looked up, and the hand clears reference bits until it finds an
+// unreferenced slot to reuse.
+
+const U32 INDEX_MAGIC = 0x58494354; // 'TCIX'
+const S32 INDEX_EMPTY = -1;
+const S32 INDEX_ERASED = -2;
+const U32 INDEX_MIN_CAPACITY = 1024;
+
+static inline U32 index_hash(const LLUUID& id)
 {
-	lru_data(U32 t, S32 i, const LLUUID& id) { time=t; index=i; uuid=id; }
-	U32 time;
-	S32 index;
-	LLUUID uuid;
-	struct Compare
-	{
-		// lhs < rhs
-		typedef const lru_data* lru_data_ptr;
-		bool operator()(const lru_data_ptr& a, const lru_data_ptr& b) const
-		{
-			if(a->time == b->time)
-				return (a->index < b->index);
-			else
-				return (a->time >= b->time);
-		}
-	};				
-};
+	// UUIDs are mostly random already, but some (e.g. baked textures) share bits
+	return id.getCRC32() * 2654435761U;
+}
 
-// Called from either the main thread or the worker thread
-void LLTextureCache::readHeaderCache(apr_pool_t* poolp)
+// Keeps the load factor at or below 1/2
+static U32 index_capacity(U32 max_entries)
 {
-	LLMutexLock lock(&mHeaderMutex);
-	mHeaderEntriesInfo.mVersion = 0.f;
-	mHeaderEntriesInfo.mEntries = 0;
-	if (ll_apr_file_exists(mHeaderEntriesFileName, poolp))
+	U32 capacity = INDEX_MIN_CAPACITY;
+	while (capacity < max_entries * 2)
 	{
-		ll_apr_file_read_ex(mHeaderEntriesFileName, poolp,
-							(U8*)&mHeaderEntriesInfo, 0, sizeof(EntriesInfo));
+		capacity <<= 1;
 	}
-	if (mHeaderEntriesInfo.mVersion != sHeaderCacheVersion)
+	return capacity;
+}
+
+void LLTextureCache::openHeaderIndex()
+{
+	LLMutexLock lock(&mHeaderMutex);
+	closeHeaderIndex();
+
+	U32 capacity = index_capacity(sCacheMaxEntries);
+	S32 index_size = sizeof(IndexInfo) + capacity * sizeof(IndexSlot) + sCacheMaxEntries * sizeof(S32);
+
+	bool exists = ll_apr_file_exists(mHeaderIndexFileName, NULL);
+	LLMappedFile::EMapMode mode = mReadOnly ? LLMappedFile::READ_ONLY : LLMappedFile::READ_WRITE;
+	if (exists && !mHeaderIndex.open(mHeaderIndexFileName, mode, mReadOnly ? 0 : index_size))
 	{
+		LL_WARNS("TextureCache") << "Unable to map " << mHeaderIndexFileName << LL_ENDL;
+		exists = false;
+	}
+	if (exists)
+	{
+		mIndexInfo = (IndexInfo*)mHeaderIndex.getData();
+		if (mHeaderIndex.getSize() != index_size ||
+			mIndexInfo->mMagic != INDEX_MAGIC ||
+			mIndexInfo->mVersion != sHeaderIndexVersion ||
+			mIndexInfo->mCapacity != capacity ||
+			mIndexInfo->mMaxEntries != sCacheMaxEntries)
+		{
+			LL_INFOS("TextureCache") << "Texture cache index is out of date, resetting" << LL_ENDL;
+			mHeaderIndex.close();
+			mIndexInfo = NULL;
+			if (!mReadOnly)
+			{
+				createHeaderIndex(false);
+			}
+			return;
+		}
+		U8* data = mHeaderIndex.getData();
+		mIndexSlots = (IndexSlot*)(data + sizeof(IndexInfo));
+		mIndexFreeList = (S32*)(data + sizeof(IndexInfo) + capacity * sizeof(IndexSlot));
 		if (!mReadOnly)
 		{
-			// Info with 0 entries
-			mHeaderEntriesInfo.mVersion = sHeaderCacheVersion;
-			ll_apr_file_write_ex(mHeaderEntriesFileName, poolp,
-								 (U8*)&mHeaderEntriesInfo, 0, sizeof(EntriesInfo));
+			if (!mIndexInfo->mClean)
+			{
+				// We were not shut down cleanly, the index may be mid-update
+				LL_INFOS("TextureCache") << "Texture cache index was not closed, validating" << LL_ENDL;
+				rebuildHeaderIndex();
+			}
+			mIndexInfo->mSequence = 0;
+			mIndexInfo->mClean = FALSE;
 		}
 	}
-	else
+	else if (!mReadOnly)
+	{
+		// First run with an index; keep whatever the old entries file knew about
+		createHeaderIndex(true);
+	}
+
+	if (mIndexInfo)
 	{
-		S32 num_entries = mHeaderEntriesInfo.mEntries;
-		if (num_entries)
+		LL_INFOS("TextureCache") << "Texture cache index: " << mIndexInfo->mUsed << " entries" << LL_ENDL;
+	}
+}
+
+// Called with mHeaderMutex locked
+bool LLTextureCache::createHeaderIndex(bool migrate)
+{
+	U32 capacity = index_capacity(sCacheMaxEntries);
+	S32 index_size = sizeof(IndexInfo) + capacity * sizeof(IndexSlot) + sCacheMaxEntries * sizeof(S32);
+
+	ll_apr_file_remove(mHeaderIndexFileName, NULL);
+	if (!mHeaderIndex.open(mHeaderIndexFileName, LLMappedFile::READ_WRITE, index_size))
+	{
+		LL_WARNS("TextureCache") << "Unable to create " << mHeaderIndexFileName << LL_ENDL;
+		mIndexInfo = NULL;
+		return false;
+	}
+	U8* data = mHeaderIndex.getData();
+	mIndexInfo = (IndexInfo*)data;
+	mIndexSlots = (IndexSlot*)(data + sizeof(IndexInfo));
+	mIndexFreeList = (S32*)(data + sizeof(IndexInfo) + capacity * sizeof(IndexSlot));
+
+	memset(mIndexInfo, 0, sizeof(IndexInfo));
+	mIndexInfo->mMagic = INDEX_MAGIC;
+	mIndexInfo->mVersion = sHeaderIndexVersion;
+	mIndexInfo->mCapacity = capacity;
+	mIndexInfo->mMaxEntries = sCacheMaxEntries;
+	for (U32 i = 0; i < capacity; i++)
+	{
+		mIndexSlots[i].mIndex = INDEX_EMPTY;
+	}
+
+	if (migrate)
+	{
+		migrateHeaderEntries();
+	}
+	// The old entries file is never consulted again
+	ll_apr_file_remove(mHeaderEntriesFileName, NULL);
+	return true;
+}
+
+// Called with mHeaderMutex locked, from createHeaderIndex()
+void LLTextureCache::migrateHeaderEntries()
+{
+	EntriesInfo info;
+	info.mVersion = 0.f;
+	info.mEntries = 0;
+	if (ll_apr_file_exists(mHeaderEntriesFileName, NULL))
+	{
+		ll_apr_file_read_ex(mHeaderEntriesFileName, NULL,
+							(U8*)&info, 0, sizeof(EntriesInfo));
+	}
+	if (info.mVersion != sHeaderCacheVersion || info.mEntries == 0)
+	{
+		return;
+	}
+	S32 num_entries = llmin(info.mEntries, sCacheMaxEntries);
+	Entry* entries = new Entry[num_entries];
+	S32 bytes_read = ll_apr_file_read_ex(mHeaderEntriesFileName, NULL,
+										 (U8*)entries, sizeof(EntriesInfo), num_entries*sizeof(Entry));
+	num_entries = llmax(bytes_read, 0) / (S32)sizeof(Entry);
+	mIndexInfo->mEntries = num_entries;
+	for (S32 i=0; i<num_entries; i++)
+	{
+		IndexSlot* slot = NULL;
+		if (entries[i].mSize >= 0) // -1 indicates erased entry
 		{
-			Entry* entries = new Entry[num_entries];
-			ll_apr_file_read_ex(mHeaderEntriesFileName, poolp,
-								(U8*)entries, sizeof(EntriesInfo), num_entries*sizeof(Entry));
-			typedef std::set<lru_data*, lru_data::Compare> lru_set_t;
-			lru_set_t lru;
-			for (S32 i=0; i<num_entries; i++)
+			slot = insertIndexSlot(entries[i].mID);
+		}
+		if (slot && slot->mIndex == INDEX_EMPTY)
+		{
+			slot->mIndex = i;
+			slot->mSize = entries[i].mSize;
+			slot->mTime = entries[i].mTime;
+			slot->mReferenced = 0;
+			mIndexInfo->mUsed++;
+		}
+		else
+		{
+			mIndexFreeList[mIndexInfo->mNumFree++] = i;
+		}
+	}
+	delete[] entries;
+	LL_INFOS("TextureCache") << "Migrated " << mIndexInfo->mUsed << " texture cache entries to "
+							 << mHeaderIndexFileName << LL_ENDL;
+}
+
+void LLTextureCache::closeHeaderIndex()
+{
+	if (mIndexInfo && !mReadOnly)
+	{
+		mIndexInfo->mClean = TRUE;
+	}
+	mHeaderIndex.close();
+	mIndexInfo = NULL;
+	mIndexSlots = NULL;
+	mIndexFreeList = NULL;
+}
+
+// Called with mHeaderMutex locked. Re-inserts every live slot, dropping
+// tombstones and any entries that are duplicated or out of range, and
+// rebuilds the free list from the header entries left unclaimed.
+void LLTextureCache::rebuildHeaderIndex()
+{
+	std::vector<IndexSlot> live;
+	live.reserve(mIndexInfo->mUsed);
+	std::vector<bool> claimed(mIndexInfo->mMaxEntries, false);
+	S32 entries = 0;
+	for (U32 i = 0; i < mIndexInfo->mCapacity; i++)
+	{
+		IndexSlot& slot = mIndexSlots[i];
+		if (slot.mIndex >= 0 && slot.mIndex < (S32)mIndexInfo->mMaxEntries && !claimed[slot.mIndex])
+		{
+			claimed[slot.mIndex] = true;
+			entries = llmax(entries, slot.mIndex + 1);
+			live.push_back(slot);
+		}
+		slot.mIndex = INDEX_EMPTY;
+	}
+	mIndexInfo->mUsed = 0;
+	mIndexInfo->mTombstones = 0;
+	mIndexInfo->mClockHand = 0;
+	for (std::vector<IndexSlot>::iterator iter = live.begin(); iter != live.end(); ++iter)
+	{
+		IndexSlot* slot = insertIndexSlot(iter->mID);
+		*slot = *iter;
+		mIndexInfo->mUsed++;
+	}
+	mIndexInfo->mEntries = entries;
+	mIndexInfo->mNumFree = 0;
+	for (S32 i = 0; i < entries; i++)
+	{
+		if (!claimed[i])
+		{
+			mIndexFreeList[mIndexInfo->mNumFree++] = i;
+		}
+	}
+}
+
+LLTextureCache::IndexSlot* LLTextureCache::findIndexSlot(const LLUUID& id) const
+{
+	U32 mask = mIndexInfo->mCapacity - 1;
+	U32 pos = index_hash(id) & mask;
+	for (U32 probes = 0; probes < mIndexInfo->mCapacity; probes++)
+	{
+		IndexSlot* slot = &mIndexSlots[pos];
+		if (slot->mIndex == INDEX_EMPTY)
+		{
+			break;
+		}
+		if (slot->mIndex >= 0 && slot->mID == id)
+		{
+			return slot;
+		}
+		pos = (pos + 1) & mask;
+	}
+	return NULL;
+}
+
+// Called with mHeaderMutex locked. Returns the slot for id, or the first free
+// slot on its probe sequence (mIndex < 0) for the caller to fill in.
+LLTextureCache::IndexSlot* LLTextureCache::insertIndexSlot(const LLUUID& id)
+{
+	U32 mask = mIndexInfo->mCapacity - 1;
+	U32 pos = index_hash(id) & mask;
+	IndexSlot* erased = NULL;
+	for (U32 probes = 0; probes < mIndexInfo->mCapacity; probes++)
+	{
+		IndexSlot* slot = &mIndexSlots[pos];
+		if (slot->mIndex == INDEX_EMPTY)
+		{
+			if (erased)
 			{
-				if (entries[i].mSize >= 0) // -1 indicates erased entry, skip
-				{
-					const LLUUID& id = entries[i].mID;
-					lru.insert(new lru_data(entries[i].mTime, i, id));
-					mHeaderIDMap[id] = i;
-				}
+				break;
 			}
-			mLRU.clear();
-			S32 lru_entries = sCacheMaxEntries / 10;
-			for (lru_set_t::iterator iter = lru.begin(); iter != lru.end(); ++iter)
+			slot->mID = id;
+			return slot;
+		}
+		if (slot->mIndex == INDEX_ERASED)
+		{
+			if (!erased)
 			{
-				lru_data* data = *iter;
-				mLRU[data->index] = data->uuid;
-				if (--lru_entries <= 0)
-					break;
+				erased = slot;
 			}
-			for_each(lru.begin(), lru.end(), DeletePointer());
-			delete[] entries;
 		}
+		else if (slot->mID == id)
+		{
+			return slot;
+		}
+		pos = (pos + 1) & mask;
+	}
+	if (erased)
+	{
+		mIndexInfo->mTombstones--;
+		erased->mIndex = INDEX_EMPTY;
+		erased->mID = id;
+	}
+	return erased;
+}
+
+// Called with mHeaderMutex locked. Returns a header entry for a new slot,
+// evicting the least recently referenced entry when the header file is full.
+S32 LLTextureCache::allocateHeaderEntry()
+{
+	if (mIndexInfo->mNumFree > 0)
+	{
+		return mIndexFreeList[--mIndexInfo->mNumFree];
+	}
+	if (mIndexInfo->mEntries < mIndexInfo->mMaxEntries)
+	{
+		return mIndexInfo->mEntries++;
+	}
+	U32 mask = mIndexInfo->mCapacity - 1;
+	for (U32 sweep = 0; sweep < mIndexInfo->mCapacity * 2; sweep++)
+	{
+		IndexSlot* slot = &mIndexSlots[mIndexInfo->mClockHand];
+		mIndexInfo->mClockHand = (mIndexInfo->mClockHand + 1) & mask;
+		if (slot->mIndex < 0)
+		{
+			continue;
+		}
+		if (slot->mReferenced)
+		{
+			slot->mReferenced = 0;
+			continue;
+		}
+		S32 idx = slot->mIndex;
+		mTexturesSizeMap.erase(slot->mID);
+		slot->mIndex = INDEX_ERASED;
+		mIndexInfo->mUsed--;
+		mIndexInfo->mTombstones++;
+		return idx;
+	}
+	return -1;
+}
+
+// Called with mHeaderMutex locked
+void LLTextureCache::freeIndexSlot(IndexSlot* slot)
+{
+	mIndexFreeList[mIndexInfo->mNumFree++] = slot->mIndex;
+	slot->mIndex = INDEX_ERASED;
+	mIndexInfo->mUsed--;
+	mIndexInfo->mTombstones++;
+}
+
+void LLTextureCache::beginIndexWrite()
+{
+	apr_atomic_inc32(&mIndexInfo->mSequence); // odd: readers will retry
+}
+
+void LLTextureCache::endIndexWrite()
+{
+	apr_atomic_inc32(&mIndexInfo->mSequence);
+}
+
+// Lock free lookup; may be called from any thread
+S32 LLTextureCache::lookupHeaderIndex(const LLUUID& id, S32* imagesize)
+{
+	if (!mIndexInfo)
+	{
+		return -1;
+	}
+	while (true)
+	{
+		// A read-only index never changes underneath us (and can't be written to)
+		U32 sequence = mReadOnly ? 0 : apr_atomic_add32(&mIndexInfo->mSequence, 0);
+		if (sequence & 1)
+		{
+			LLThread::yield();
+			continue;
+		}
+		S32 idx = -1;
+		S32 size = 0;
+		IndexSlot* slot = findIndexSlot(id);
+		if (slot)
+		{
+			idx = slot->mIndex;
+			size = slot->mSize;
+		}
+		if (mReadOnly || apr_atomic_add32(&mIndexInfo->mSequence, 0) == sequence)
+		{
+			if (slot && !mReadOnly)
+			{
+				apr_atomic_set32(&slot->mReferenced, 1);
+			}
+			if (imagesize)
+			{
+				*imagesize = size;
+			}
+			return idx;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// The body entries list refers to either per-texture files or the body
+// store, so switching between the two discards the cached bodies.
+void LLTextureCache::openBodyStore()
+{
+	bool use_store = gSavedSettings.getBOOL("TextureCacheBodyStore");
+	if (use_store)
+	{
+		// Leave room for fragmentation; purgeTextures() keeps us at 95%
+		S64 max_size = sCacheMaxTexturesSize + sCacheMaxTexturesSize / 10;
+		bool created = false;
+		if (mBodyStore->open(mBodyStoreFileName, mBodyStoreTableFileName, max_size, mReadOnly, &created) && created)
+		{
+			purgeAllTextures(false);
+		}
+	}
+	else if (!mReadOnly && ll_apr_file_exists(mBodyStoreTableFileName, NULL))
+	{
+		LL_INFOS("TextureCache") << "Texture body store disabled, discarding it" << LL_ENDL;
+		ll_apr_file_remove(mBodyStoreTableFileName, NULL);
+		ll_apr_file_remove(mBodyStoreFileName, NULL);
+		purgeAllTextures(false);
 	}
 }
 
@@ -1139,6 +1650,7 @@ void LLTextureCache::readHeaderCache(apr_pool_t* poolp)
 
 void LLTextureCache::purgeAllTextures(bool purge_directories)
 {
+	mBodyStore->clear();
 	if (!mReadOnly)
 	{
 		const char* subdirs = "0123456789abcdef";
@@ -1248,7 +1760,8 @@ void LLTextureCache::purgeTextures(bool validate)
 			if (uuididx == validate_idx)
 			{
  				LL_DEBUGS("TextureCache") << "Validating: " << filename << "Size: " << entries[idx].mSize << LL_ENDL;
-				S32 bodysize = ll_apr_file_size(filename, NULL);
+				S32 bodysize = usingBodyStore() ? llmax(mBodyStore->getSize(entries[idx].mID) - TEXTURE_CACHE_ENTRY_SIZE, 0)
+												: ll_apr_file_size(filename, NULL);
 				if (bodysize != entries[idx].mSize)
 				{
 					LL_WARNS("TextureCache") << "TEXTURE CACHE BODY HAS BAD SIZE: " << bodysize << " != " << entries[idx].mSize
@@ -1260,7 +1773,15 @@ void LLTextureCache::purgeTextures(bool validate)
 		if (purge_entry)
 		{
 			purge_count++;
-			mFilesToDelete.push_back(filename); 
+			if (usingBodyStore())
+			{
+				// Just returns the extent to the free list
+				mBodyStore->remove(entries[idx].mID);
+			}
+			else
+			{
+				mFilesToDelete.push_back(filename); 
+			}
 			total_size -= entries[idx].mSize;
 			entries[idx].mSize = 0;
 		}
@@ -1299,6 +1820,11 @@ void LLTextureCache::purgeTextures(bool validate)
 	// *FIX:Mani - watchdog back on.
 	LLAppViewer::instance()->resumeMainloopTimeout();
 	
+	if (usingBodyStore())
+	{
+		mBodyStore->dumpStatistics();
+	}
+
 	LL_INFOS("TextureCache") << "TEXTURE CACHE:"
 			<< " PURGED: " << purge_count
 			<< " ENTRIES: " << num_entries
@@ -1376,71 +1902,46 @@ LLTextureCacheWorker* LLTextureCache::getWriter(handle_t handle)
 // Called from work thread
 S32 LLTextureCache::getHeaderCacheEntry(const LLUUID& id, bool touch, S32* imagesize)
 {
-	bool retry = false;
-	S32 idx = -1;
+	if (!touch || mReadOnly || !mIndexInfo)
+	{
+		return lookupHeaderIndex(id, imagesize);
+	}
 
+	LLMutexLock lock(&mHeaderMutex);
+	llassert_always(imagesize && *imagesize > 0);
+	if (mIndexInfo->mTombstones > mIndexInfo->mCapacity / 4)
 	{
-		LLMutexLock lock(&mHeaderMutex);
-		id_map_t::iterator iter = mHeaderIDMap.find(id);
-		if (iter != mHeaderIDMap.end())
+		beginIndexWrite();
+		rebuildHeaderIndex();
+		endIndexWrite();
+	}
+
+	beginIndexWrite();
+	IndexSlot* slot = findIndexSlot(id);
+	if (!slot)
+	{
+		S32 idx = allocateHeaderEntry();
+		slot = idx >= 0 ? insertIndexSlot(id) : NULL;
+		if (slot)
 		{
-			idx = iter->second;
+			slot->mIndex = idx;
+			mIndexInfo->mUsed++;
 		}
-		else if (touch && !mReadOnly)
+		else if (idx >= 0)
 		{
-			if (mHeaderEntriesInfo.mEntries < sCacheMaxEntries)
-			{
-				// Add an entry
-				idx = mHeaderEntriesInfo.mEntries++;
-				mHeaderIDMap[id] = idx;
-				// Update Info
-				ll_apr_file_write_ex(mHeaderEntriesFileName, getFileAPRPool(),
-									(U8*)&mHeaderEntriesInfo, 0, sizeof(EntriesInfo));
-			}
-			else if (!mLRU.empty())
-			{
-				idx = mLRU.begin()->first; // will be erased below
-				const LLUUID& oldid = mLRU.begin()->second;
-				mHeaderIDMap.erase(oldid);
-				mTexturesSizeMap.erase(oldid);
-				mHeaderIDMap[id] = idx;
-			}
-			else
-			{
-				idx = -1;
-				retry = true;
-			}
-		}
-		if (idx >= 0)
-		{
-			if (touch && !mReadOnly)
-			{
-				// Update the lru entry
-				mLRU.erase(idx);
-				llassert_always(imagesize && *imagesize > 0);
-				Entry* entry = new Entry(id, *imagesize, time(NULL));
-				S32 offset = sizeof(EntriesInfo) + idx * sizeof(Entry);
-				ll_apr_file_write_ex(mHeaderEntriesFileName, getFileAPRPool(),
-									 (U8*)entry, offset, sizeof(Entry));
-				delete entry;
-			}
-			else if (imagesize)
-			{
-				// Get the image size
-				Entry entry;
-				S32 offset = sizeof(EntriesInfo) + idx * sizeof(Entry);
-				ll_apr_file_read_ex(mHeaderEntriesFileName, getFileAPRPool(),
-									(U8*)&entry, offset, sizeof(Entry));
-				*imagesize = entry.mSize;
-			}
+			mIndexFreeList[mIndexInfo->mNumFree++] = idx;
 		}
 	}
-	if (retry)
+	S32 idx = -1;
+	if (slot)
 	{
-		readHeaderCache(getFileAPRPool()); // updates the lru
-		llassert_always(!mLRU.empty() || mHeaderEntriesInfo.mEntries < sCacheMaxEntries);
-		idx = getHeaderCacheEntry(id, touch, imagesize); // assert above ensures no inf. recursion
+		// Update the lru entry
+		slot->mSize = *imagesize;
+		slot->mTime = time(NULL);
+		slot->mReferenced = 1;
+		idx = slot->mIndex;
 	}
+	endIndexWrite();
 	return idx;
 }
 
@@ -1573,24 +2074,21 @@ bool LLTextureCache::removeHeaderCacheEntry(const LLUUID& id)
 		return false;
 	}
 	LLMutexLock lock(&mHeaderMutex);
-	id_map_t::iterator iter = mHeaderIDMap.find(id);
-	if (iter != mHeaderIDMap.end())
+	if (!mIndexInfo)
 	{
-		S32 idx = iter->second;
-		if (idx >= 0)
-		{
-			Entry* entry = new Entry(id, -1, time(NULL));
-			S32 offset = sizeof(EntriesInfo) + idx * sizeof(Entry);
-			ll_apr_file_write_ex(mHeaderEntriesFileName, NULL,
-								 (U8*)entry, offset, sizeof(Entry));
-			delete entry;
-			mLRU[idx] = id;
-			mHeaderIDMap.erase(id);
-			mTexturesSizeMap.erase(id);
-			return true;
-		}
+		return false;
 	}
-	return false;
+	bool res = false;
+	beginIndexWrite();
+	IndexSlot* slot = findIndexSlot(id);
+	if (slot)
+	{
+		freeIndexSlot(slot);
+		mTexturesSizeMap.erase(id);
+		res = true;
+	}
+	endIndexWrite();
+	return res;
 }
 
 void LLTextureCache::removeFromCache(const LLUUID& id)
@@ -1599,7 +2097,14 @@ void LLTextureCache::removeFromCache(const LLUUID& id)
 	if (!mReadOnly)
 	{
 		removeHeaderCacheEntry(id);
-		ll_apr_file_remove(getTextureFileName(id), NULL);
+		if (usingBodyStore())
+		{
+			mBodyStore->remove(id);
+		}
+		else
+		{
+			ll_apr_file_remove(getTextureFileName(id), NULL);
+		}
 	}
 }
 
@@ -1611,6 +2116,32 @@ LLTextureCache::ReadResponder::ReadResponder()
 {
 }
 
+//virtual
+void LLTextureCache::Responder::setDataView(LLImageDataView* view, S32 imagesize, S32 imageformat, BOOL imagelocal)
+{
+	U8* data = new U8[view->getSize()];
+	memcpy(data, view->getData(), view->getSize());
+	setData(data, view->getSize(), imagesize, imageformat, imagelocal);
+}
+
+void LLTextureCache::ReadResponder::setDataView(LLImageDataView* view, S32 imagesize, S32 imageformat, BOOL imagelocal)
+{
+	if (mFormattedImage.notNull() && mFormattedImage->getDataSize() > 0)
+	{
+		// Appending to data we already have; no way around the copy
+		Responder::setDataView(view, imagesize, imageformat, imagelocal);
+		return;
+	}
+	if (mFormattedImage.isNull())
+	{
+		mFormattedImage = LLImageFormatted::createFromType(imageformat);
+	}
+	llassert_always(mFormattedImage->getCodec() == imageformat);
+	mFormattedImage->setDataView(view);
+	mImageSize = imagesize;
+	mImageLocal = imagelocal;
+}
+
 void LLTextureCache::ReadResponder::setData(U8* data, S32 datasize, S32 imagesize, S32 imageformat, BOOL imagelocal)
 {
 	if (mFormattedImage.notNull())
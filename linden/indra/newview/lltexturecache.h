@@ -33,11 +33,13 @@
 #define LL_LLTEXTURECACHE_H
 
 #include "lldir.h"
+#include "llmappedfile.h"
 #include "llstl.h"
 #include "llstring.h"
 #include "lluuid.h"
 
 #include "llworkerthread.h"
+#include "lltexturebodystore.h"
 
 class LLTextureCacheWorker;
 
@@ -53,6 +55,9 @@ public:
 	{
 	public:
 		virtual void setData(U8* data, S32 datasize, S32 imagesize, S32 imageformat, BOOL imagelocal) = 0;
+		// Called instead of setData() when the cache can hand out a mapped view
+		// of the data. By default the view is copied into a setData() buffer.
+		virtual void setDataView(LLImageDataView* view, S32 imagesize, S32 imageformat, BOOL imagelocal);
 	};
 	
 	class ReadResponder : public Responder
@@ -60,6 +65,7 @@ public:
 	public:
 		ReadResponder();
 		void setData(U8* data, S32 datasize, S32 imagesize, S32 imageformat, BOOL imagelocal);
+		void setDataView(LLImageDataView* view, S32 imagesize, S32 imageformat, BOOL imagelocal);
 		void setImage(LLImageFormatted* image) { mFormattedImage = image; }
 	protected:
 		LLPointer<LLImageFormatted> mFormattedImage;
@@ -112,6 +118,8 @@ protected:
 	bool appendToTextureEntryList(const LLUUID& id, S32 size);
 	std::string getLocalFileName(const LLUUID& id);
 	std::string getTextureFileName(const LLUUID& id);
+	bool usingBodyStore() const { return mBodyStore->isOpen(); }
+	LLTextureBodyStore& getBodyStore() { return *mBodyStore; }
 	void addCompleted(Responder* responder, bool success);
 	
 protected:
@@ -119,14 +127,29 @@ protected:
 
 private:
 	void setDirNames(ELLPath location);
-	void readHeaderCache(apr_pool_t* poolp = NULL);
+	void openHeaderIndex();
+	void closeHeaderIndex();
 	void purgeAllTextures(bool purge_directories);
 	void purgeTextures(bool validate);
 	void purgeTextureFilesTimeSliced(BOOL force_all = FALSE);	// VWR-3878 - NB
+	void openBodyStore();
 	S32 getHeaderCacheEntry(const LLUUID& id, bool touch, S32* imagesize = NULL);
 	bool removeHeaderCacheEntry(const LLUUID& id);
 	void lockHeaders() { mHeaderMutex.lock(); }
 	void unlockHeaders() { mHeaderMutex.unlock(); }
+
+	// Header index (see comments in lltexturecache.cpp)
+	struct IndexSlot;
+	bool createHeaderIndex(bool migrate);
+	void migrateHeaderEntries();
+	void rebuildHeaderIndex();
+	IndexSlot* findIndexSlot(const LLUUID& id) const;
+	IndexSlot* insertIndexSlot(const LLUUID& id);
+	S32 lookupHeaderIndex(const LLUUID& id, S32* imagesize);
+	S32 allocateHeaderEntry();
+	void freeIndexSlot(IndexSlot* slot);
+	void beginIndexWrite();
+	void endIndexWrite();
 	
 private:
 	// Internal
@@ -165,18 +188,49 @@ private:
 		U32 mTime; // seconds since 1/1/1970
 	};
 
+	// Memory mapped header index. An open-addressed (linear probing) hash
+	// of UUID -> header entry, with a clock bit per slot for eviction.
+	struct IndexInfo
+	{
+		U32 mMagic;
+		U32 mVersion;
+		U32 mCapacity; // number of IndexSlots, power of 2
+		U32 mMaxEntries; // number of header entries in the data file
+		U32 mEntries; // header entries handed out so far (high water mark)
+		U32 mUsed; // slots holding a live entry
+		U32 mTombstones; // slots holding an erased entry
+		U32 mNumFree; // erased header entries available for reuse
+		U32 mClockHand;
+		U32 mClean; // false while the index is open for writing
+		apr_uint32_t mSequence; // odd while a writer is modifying the index
+		U32 mPad[5];
+	};
+	struct IndexSlot
+	{
+		LLUUID mID;
+		S32 mIndex; // header entry, or INDEX_EMPTY / INDEX_ERASED
+		S32 mSize; // total size of image if known (NOT size cached)
+		U32 mTime; // seconds since 1/1/1970
+		apr_uint32_t mReferenced; // clock bit
+	};
+
 	// HEADERS (Include first mip)
-	std::string mHeaderEntriesFileName;
+	std::string mHeaderEntriesFileName; // pre-index entries, read once for migration
 	std::string mHeaderDataFileName;
-	EntriesInfo mHeaderEntriesInfo;
-	typedef std::map<S32,LLUUID> index_map_t;
-	index_map_t mLRU; // index, id; stored as a map for fast removal
-	typedef std::map<LLUUID,S32> id_map_t;
-	id_map_t mHeaderIDMap;
+	std::string mHeaderIndexFileName;
+	LLMappedFile mHeaderIndex;
+	IndexInfo* mIndexInfo;
+	IndexSlot* mIndexSlots;
+	S32* mIndexFreeList;
 
 	// BODIES (TEXTURES minus headers)
 	std::string mTexturesDirName;
 	std::string mTexturesDirEntriesFileName;
+	std::string mBodyStoreFileName;
+	std::string mBodyStoreTableFileName;
+	// Used instead of mTexturesDirName files when open. Holds whole textures
+	// (header entry included) so that reads can map them in one piece.
+	LLPointer<LLTextureBodyStore> mBodyStore;
 	typedef std::map<LLUUID,S32> size_map_t;
 	size_map_t mTexturesSizeMap;
 	S64 mTexturesSizeTotal;
@@ -184,6 +238,7 @@ private:
 	
 	// Statics
 	static F32 sHeaderCacheVersion;
+	static U32 sHeaderIndexVersion;
 	static U32 sCacheMaxEntries;
 	static S64 sCacheMaxTexturesSize;
 };
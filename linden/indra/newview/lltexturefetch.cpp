@@ -239,7 +239,20 @@ private:
 	
 	void setImagePriority(F32 priority);
 	void setDesiredDiscard(S32 discard, S32 size);
-	bool insertPacket(S32 index, U8* data, S32 size);
+
+	// Called from the MAIN THREAD, only take mInboxMutex
+	void postImagePriority(F32 priority);
+	bool postHeader(const LLHost& host, U8 codec, U16 packets, U32 totalbytes, const U8* data, S32 size);
+	bool postPacket(const LLHost& host, S32 index, const U8* data, S32 size);
+	S32 getNextPacket(F32& gap_time);
+	// mInboxMutex is locked
+	bool allocatePacketBuffer(S32 num_packets, S32 file_size);
+	bool insertPacket(S32 index, const U8* data, S32 size);
+	U8* takePacketBuffer();
+	// mWorkMutex is locked
+	void processInbox();
+	void resumePackets(const U8* data, S32 data_size);
+
 	void clearPackets();
 	U32 calcWorkPriority();
 	void removeFromCache();
@@ -248,6 +261,7 @@ private:
 	bool writeToCacheComplete();
 	
 	void lockWorkData() { mWorkMutex.lock(); }
+	bool tryLockWorkData() { return mWorkMutex.trylock(); } // for the main thread
 	void unlockWorkData() { mWorkMutex.unlock(); }
 
 	void callbackURLReceived(const LLSD& data, bool success);
@@ -324,19 +338,42 @@ private:
 
 	// Work Data
 	LLMutex mWorkMutex;
-	struct PacketData
-	{
-		PacketData(U8* data, S32 size) { mData = data; mSize = size; }
-		~PacketData() { clearData(); }
-		void clearData() { delete[] mData; mData = NULL; }
-		U8* mData;
-		U32 mSize;
-	};
-	std::vector<PacketData*> mPackets;
 	S32 mFirstPacket;
 	S32 mLastPacket;
 	U16 mTotalPackets;
 	U8 mImageCodec;
+
+	// Priority changes and simulator packets posted by the main thread.
+	// mInboxMutex is only ever held for a push, a swap or a packet copy,
+	// so the main thread never waits on doWork().
+	struct InboxPacket
+	{
+		LLHost mHost;
+		S32 mIndex;
+		bool mHeader;
+		bool mStored; // false for a header that arrived after the buffer was allocated
+		U8 mCodec;
+		U16 mPackets;
+		U32 mTotalBytes;
+	};
+	LLMutex mInboxMutex;
+	std::vector<InboxPacket> mInbox;
+	std::vector<InboxPacket> mInboxWork; // swapped with mInbox by doWork(), keeps its capacity
+	F32 mInboxPriority; // < 0 if nothing posted
+	F32 mPostedPriority; // MAIN THREAD only
+
+	// Simulator packets are copied straight into mPacketBuffer at their
+	// offset in the file as they arrive, and flagged in mPacketBits.  The
+	// buffer is sized from the image header, or from the cached file size
+	// when resuming, and is handed to mFormattedImage once enough packets
+	// are in.  Guarded by mInboxMutex.
+	U8* mPacketBuffer;
+	S32 mPacketBufferSize;
+	S32 mPacketBufferPackets;
+	std::vector<U32> mPacketBits;
+	S32 mContiguousPackets; // packets received with none missing before them
+	S32 mHighestPacket; // highest packet received, -1 if none
+	LLFrameTimer mPacketGapTimer; // how long the first missing packet has been missing
 };
 
 class LLTextureFetchLocalFileWorker : public LLTextureFetchWorker
@@ -419,7 +456,15 @@ LLTextureFetchWorker::LLTextureFetchWorker(LLTextureFetch* fetcher,
 	  mFirstPacket(0),
 	  mLastPacket(-1),
 	  mTotalPackets(0),
-	  mImageCodec(IMG_CODEC_INVALID)
+	  mImageCodec(IMG_CODEC_INVALID),
+	  mInboxMutex(fetcher->getWorkerAPRPool()),
+	  mInboxPriority(-1.f),
+	  mPostedPriority(priority),
+	  mPacketBuffer(NULL),
+	  mPacketBufferSize(0),
+	  mPacketBufferPackets(0),
+	  mContiguousPackets(0),
+	  mHighestPacket(-1)
 {
 	calcWorkPriority();
 	mType = host.isOk() ? LLImageBase::TYPE_AVATAR_BAKE : LLImageBase::TYPE_NORMAL;
@@ -460,8 +505,10 @@ LLTextureFetchWorker::~LLTextureFetchWorker()
 
 void LLTextureFetchWorker::clearPackets()
 {
-	for_each(mPackets.begin(), mPackets.end(), DeletePointer());
-	mPackets.clear();
+	{
+		LLMutexLock lock(&mInboxMutex);
+		delete[] takePacketBuffer();
+	}
 	mTotalPackets = 0;
 	mLastPacket = -1;
 	mFirstPacket = 0;
@@ -558,6 +605,8 @@ bool LLTextureFetchWorker::doWork(S32 param)
 		mFetcher->mDebugCount++; // for setting breakpoints
 	}
 
+	processInbox();
+
 	if (mState != DONE)
 	{
 		mFetchTimer.reset();
@@ -696,14 +745,13 @@ bool LLTextureFetchWorker::doWork(S32 param)
 				{
 					mLastPacket = mFirstPacket-1;
 					mTotalPackets = (mFileSize - FIRST_PACKET_SIZE + MAX_IMG_PACKET_SIZE-1) / MAX_IMG_PACKET_SIZE + 1;
+					resumePackets(mFormattedImage->getData(), data_size);
 				}
 			}
 			mRequestedSize = mDesiredSize;
 			mRequestedDiscard = mDesiredDiscard;
 			mSentRequest = QUEUED;
-			mFetcher->lockQueue();
 			mFetcher->addToNetworkQueue(this);
-			mFetcher->unlockQueue();
 			setPriority(LLWorkerThread::PRIORITY_LOW | mWorkPriority);
 		}
 		return false;
@@ -713,9 +761,7 @@ bool LLTextureFetchWorker::doWork(S32 param)
 	{
 		if (processSimulatorPackets())
 		{
-			mFetcher->lockQueue();
 			mFetcher->removeFromNetworkQueue(this);
-			mFetcher->unlockQueue();
 			if (mFormattedImage.isNull() || !mFormattedImage->getDataSize())
 			{
 				// processSimulatorPackets() failed
@@ -1067,12 +1113,8 @@ bool LLTextureFetchWorker::processSimulatorPackets()
 	
 	if (mLastPacket >= mFirstPacket)
 	{
-		S32 buffer_size = mFormattedImage->getDataSize();
-		for (S32 i = mFirstPacket; i<=mLastPacket; i++)
-		{
-			llassert_always(mPackets[i]);
-			buffer_size += mPackets[i]->mSize;
-		}
+		// packets 0 to mLastPacket are in mPacketBuffer, cached ones included
+		S32 buffer_size = llmin(FIRST_PACKET_SIZE + mLastPacket * MAX_IMG_PACKET_SIZE, mFileSize);
 		bool have_all_data = mLastPacket >= mTotalPackets-1;
 		if (buffer_size >= mRequestedSize || have_all_data)
 		{
@@ -1084,21 +1126,18 @@ bool LLTextureFetchWorker::processSimulatorPackets()
 			S32 cur_size = mFormattedImage->getDataSize();
 			if (buffer_size > cur_size)
 			{
-				/// We have new data
-				U8* buffer = new U8[buffer_size];
-				S32 offset = 0;
-				if (cur_size > 0 && mFirstPacket > 0)
+				/// We have new data, hand the packet buffer over as it is.
+				/// Packets still in flight are turned away from here on.
+				U8* buffer;
 				{
-					memcpy(buffer, mFormattedImage->getData(), cur_size);
-					offset = cur_size;
+					LLMutexLock lock(&mInboxMutex);
+					buffer = takePacketBuffer();
 				}
-				for (S32 i=mFirstPacket; i<=mLastPacket; i++)
+				if (buffer)
 				{
-					memcpy(buffer + offset, mPackets[i]->mData, mPackets[i]->mSize);
-					offset += mPackets[i]->mSize;
+					// NOTE: setData releases current data
+					mFormattedImage->setData(buffer, buffer_size);
 				}
-				// NOTE: setData releases current data
-				mFormattedImage->setData(buffer, buffer_size);
 			}
 			mLoadedDiscard = mRequestedDiscard;
 			return true;
@@ -1321,6 +1360,7 @@ LLTextureFetch::LLTextureFetch(LLTextureCache* cache, bool threaded)
 	  mPacketCount(0),
 	  mBadPacketCount(0),
 	  mQueueMutex(getAPRPool()),
+	  mNetworkQueueMutex(getAPRPool()),
 	  mTextureCache(cache)
 {
 }
@@ -1393,6 +1433,7 @@ bool LLTextureFetch::createRequest(const std::string& filename, const LLUUID& id
 		worker->setImagePriority(priority);
 		worker->setDesiredDiscard(desired_discard, desired_size);
 		worker->unlockWorkData();
+		worker->postImagePriority(priority); // supersede any stale posted priority
 		if (!worker->haveWork())
 		{
 			worker->mState = LLTextureFetchWorker::INIT;
@@ -1431,13 +1472,15 @@ void LLTextureFetch::deleteRequest(const LLUUID& id, bool cancel)
 
 // protected
 
-// call lockQueue() first!
+// Called from the worker thread with the worker's mWorkMutex locked,
+// so only mNetworkQueueMutex may be taken here (never mQueueMutex)
 void LLTextureFetch::addToNetworkQueue(LLTextureFetchWorker* worker)
 {
-	if (mRequestMap.find(worker->mID) != mRequestMap.end())
+	LLMutexLock lock(&mNetworkQueueMutex);
+	if (!worker->getFlags(LLWorkerClass::WCF_DELETE_REQUESTED))
 	{
-		// only add to the queue if in the request map
-		// i.e. a delete has not been requested
+		// only add to the queue if a delete has not been requested
+		// (removeRequest() sets the flag while holding mNetworkQueueMutex)
 		mNetworkQueue.insert(worker->mID);
 	}
 	for (cancel_queue_t::iterator iter1 = mCancelQueue.begin();
@@ -1447,17 +1490,25 @@ void LLTextureFetch::addToNetworkQueue(LLTextureFetchWorker* worker)
 	}
 }
 
-// call lockQueue() first!
 void LLTextureFetch::removeFromNetworkQueue(LLTextureFetchWorker* worker)
 {
+	LLMutexLock lock(&mNetworkQueueMutex);
 	mNetworkQueue.erase(worker->mID);
 }
 
+void LLTextureFetch::addBadPacket(const LLHost& host, const LLUUID& id)
+{
+	LLMutexLock lock(&mNetworkQueueMutex);
+	++mBadPacketCount;
+	mCancelQueue[host].insert(id);
+}
+
 // call lockQueue() first!
 void LLTextureFetch::removeRequest(LLTextureFetchWorker* worker, bool cancel)
 {
 	size_t erased_1 = mRequestMap.erase(worker->mID);
 	llassert_always(erased_1 > 0) ;
+	LLMutexLock lock(&mNetworkQueueMutex);
 	size_t erased = mNetworkQueue.erase(worker->mID);
 	if (cancel && erased > 0)
 	{
@@ -1509,9 +1560,10 @@ bool LLTextureFetch::getRequestFinished(const LLUUID& id, S32& discard_level,
 			aux = worker->mAuxImage; worker->mAuxImage = NULL;
 			res = true;
 		}
-		else
+		else if (worker->tryLockWorkData())
 		{
-			worker->lockWorkData();
+			// A worker the fetch thread is busy with is checked for early
+			// data on a later frame rather than waited for.
 			if ((worker->mDecodedDiscard >= 0) &&
 				(worker->mDecodedDiscard < discard_level || discard_level < 0) &&
 				(worker->mState >= LLTextureFetchWorker::WAIT_ON_WRITE))
@@ -1538,9 +1590,9 @@ bool LLTextureFetch::updateRequestPriority(const LLUUID& id, F32 priority)
 	LLTextureFetchWorker* worker = getWorker(id);
 	if (worker)
 	{
-		worker->lockWorkData();
-		worker->setImagePriority(priority);
-		worker->unlockWorkData();
+		// Don't wait on mWorkMutex here; the worker picks the new
+		// priority up from its inbox the next time it runs.
+		worker->postImagePriority(priority);
 		res = true;
 	}
 	return res;
@@ -1569,46 +1621,102 @@ S32 LLTextureFetch::update(U32 max_time_ms)
 
 //////////////////////////////////////////////////////////////////////////////
 
+// An image request copied out of its worker, so that the RequestImage
+// messages are built without holding any worker's mWorkMutex
+struct LLSimImageRequest
+{
+	LLUUID mID;
+	S32 mDiscard;
+	F32 mPriority;
+	S32 mPacket;
+	U8 mType;
+
+	// greater priority is "less", as in LLTextureFetchWorker::Compare
+	bool operator<(const LLSimImageRequest& rhs) const
+	{
+		if (mPriority != rhs.mPriority)
+		{
+			return mPriority > rhs.mPriority;
+		}
+		return mID < rhs.mID;
+	}
+};
+
 void LLTextureFetch::sendRequestListToSimulators()
 {
 	const S32 IMAGES_PER_REQUEST = 50;
 	const F32 LAZY_FLUSH_TIMEOUT = 15.f; // 10.0f // temp
 	const F32 MIN_REQUEST_TIME = 1.0f;
 	const F32 MIN_DELTA_PRIORITY = 1000.f;
+	const F32 MISSING_PACKET_TIME = 1.f;
 
 	LLMutexLock lock(&mQueueMutex);
+
+	// Workers add themselves to the network queue while holding their
+	// mWorkMutex, so take a copy rather than holding mNetworkQueueMutex
+	// while we look at individual workers below.
+	queue_t network_queue;
+	cancel_queue_t cancel_queue;
+	mNetworkQueueMutex.lock();
+	network_queue = mNetworkQueue;
+	cancel_queue.swap(mCancelQueue);
+	mNetworkQueueMutex.unlock();
 	
 	// Send requests
-	typedef std::set<LLTextureFetchWorker*,LLTextureFetchWorker::Compare> request_list_t;
+	typedef std::set<LLSimImageRequest> request_list_t;
 	typedef std::map< LLHost, request_list_t > work_request_map_t;
 	work_request_map_t requests;
-	for (queue_t::iterator iter = mNetworkQueue.begin(); iter != mNetworkQueue.end(); )
+	for (queue_t::iterator iter = network_queue.begin(); iter != network_queue.end(); ++iter)
 	{
-		queue_t::iterator curiter = iter++;
-		LLTextureFetchWorker* req = getWorker(*curiter);
+		LLTextureFetchWorker* req = getWorker(*iter);
 		if (!req)
 		{
-			mNetworkQueue.erase(curiter);
+			LLMutexLock network_lock(&mNetworkQueueMutex);
+			mNetworkQueue.erase(*iter);
 			continue; // paranoia
 		}
 		if (req->mID == mDebugID)
 		{
 			mDebugCount++; // for setting breakpoints
 		}
+		if (!req->tryLockWorkData())
+		{
+			// the fetch thread is working on it, look again next time
+			// rather than stall the main thread
+			continue;
+		}
 		if (req->mTotalPackets > 0 && req->mLastPacket >= req->mTotalPackets-1)
 		{
 			// We have all the packets... make sure this is high priority
 // 			req->setPriority(LLWorkerThread::PRIORITY_HIGH | req->mWorkPriority);
+			req->unlockWorkData();
 			continue;
 		}
 		F32 elapsed = req->mRequestedTimer.getElapsedTimeF32();
 		F32 delta_priority = llabs(req->mRequestedPriority - req->mImagePriority);
+		// a packet lost while later ones arrived is asked for again once the
+		// stream goes quiet, rather than after the lazy flush timeout
+		F32 gap_time;
+		S32 packet = req->getNextPacket(gap_time);
 		if ((req->mSimRequestedDiscard != req->mDesiredDiscard) ||
 			(delta_priority > MIN_DELTA_PRIORITY && elapsed >= MIN_REQUEST_TIME) ||
+			(gap_time >= MISSING_PACKET_TIME && elapsed >= MIN_REQUEST_TIME) ||
 			(elapsed >= LAZY_FLUSH_TIMEOUT))
 		{
-			requests[req->mHost].insert(req);
+			LLSimImageRequest sim_request;
+			sim_request.mID = req->mID;
+			sim_request.mDiscard = req->mDesiredDiscard;
+			sim_request.mPriority = req->mImagePriority;
+			sim_request.mPacket = packet;
+			sim_request.mType = req->mType;
+			requests[req->mHost].insert(sim_request);
+
+			req->mSentRequest = LLTextureFetchWorker::SENT_SIM;
+			req->mSimRequestedDiscard = req->mDesiredDiscard;
+			req->mRequestedPriority = req->mImagePriority;
+			req->mRequestedTimer.reset();
 		}
+		req->unlockWorkData();
 	}
 
 	std::string http_url;
@@ -1647,8 +1755,7 @@ void LLTextureFetch::sendRequestListToSimulators()
 			for (request_list_t::iterator iter2 = iter1->second.begin();
 				 iter2 != iter1->second.end(); ++iter2)
 			{
-				LLTextureFetchWorker* req = *iter2;
-				req->mSentRequest = LLTextureFetchWorker::SENT_SIM;
+				const LLSimImageRequest& req = *iter2;
 				if (0 == request_count)
 				{
 					gMessageSystem->newMessageFast(_PREHASH_RequestImage);
@@ -1656,21 +1763,15 @@ void LLTextureFetch::sendRequestListToSimulators()
 					gMessageSystem->addUUIDFast(_PREHASH_AgentID, gAgent.getID());
 					gMessageSystem->addUUIDFast(_PREHASH_SessionID, gAgent.getSessionID());
 				}
-				S32 packet = req->mLastPacket + 1;
 				gMessageSystem->nextBlockFast(_PREHASH_RequestImage);
-				gMessageSystem->addUUIDFast(_PREHASH_Image, req->mID);
-				gMessageSystem->addS8Fast(_PREHASH_DiscardLevel, (S8)req->mDesiredDiscard);
-				gMessageSystem->addF32Fast(_PREHASH_DownloadPriority, req->mImagePriority);
-				gMessageSystem->addU32Fast(_PREHASH_Packet, packet);
-				gMessageSystem->addU8Fast(_PREHASH_Type, req->mType);
-// 				llinfos << "IMAGE REQUEST: " << req->mID << " Discard: " << req->mDesiredDiscard
-// 						<< " Packet: " << packet << " Priority: " << req->mImagePriority << llendl;
-
-				req->lockWorkData();
-				req->mSimRequestedDiscard = req->mDesiredDiscard;
-				req->mRequestedPriority = req->mImagePriority;
-				req->mRequestedTimer.reset();
-				req->unlockWorkData();
+				gMessageSystem->addUUIDFast(_PREHASH_Image, req.mID);
+				gMessageSystem->addS8Fast(_PREHASH_DiscardLevel, (S8)req.mDiscard);
+				gMessageSystem->addF32Fast(_PREHASH_DownloadPriority, req.mPriority);
+				gMessageSystem->addU32Fast(_PREHASH_Packet, req.mPacket);
+				gMessageSystem->addU8Fast(_PREHASH_Type, req.mType);
+// 				llinfos << "IMAGE REQUEST: " << req.mID << " Discard: " << req.mDiscard
+// 						<< " Packet: " << req.mPacket << " Priority: " << req.mPriority << llendl;
+
 				request_count++;
 				if (request_count >= IMAGES_PER_REQUEST)
 				{
@@ -1689,10 +1790,10 @@ void LLTextureFetch::sendRequestListToSimulators()
 	}
 	
 	// Send cancelations
-	if (!mCancelQueue.empty())
+	if (!cancel_queue.empty())
 	{
-		for (cancel_queue_t::iterator iter1 = mCancelQueue.begin();
-			 iter1 != mCancelQueue.end(); ++iter1)
+		for (cancel_queue_t::iterator iter1 = cancel_queue.begin();
+			 iter1 != cancel_queue.end(); ++iter1)
 		{
 			LLHost host = iter1->first;
 			if (host == LLHost::invalid)
@@ -1730,150 +1831,331 @@ void LLTextureFetch::sendRequestListToSimulators()
 				gMessageSystem->sendSemiReliable(host, NULL, NULL);
 			}
 		}
-		mCancelQueue.clear();
 	}
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
-bool LLTextureFetchWorker::insertPacket(S32 index, U8* data, S32 size)
+// mInboxMutex is locked
+bool LLTextureFetchWorker::allocatePacketBuffer(S32 num_packets, S32 file_size)
 {
-	mRequestedTimer.reset();
-	if (index >= mTotalPackets)
+	// the first packet holds FIRST_PACKET_SIZE bytes and the rest MAX_IMG_PACKET_SIZE
+	S32 expected_packets = 1;
+	if (file_size > FIRST_PACKET_SIZE)
 	{
-// 		llwarns << "Received Image Packet " << index << " > max: " << mTotalPackets << " for image: " << mID << llendl;
+		expected_packets = (file_size - FIRST_PACKET_SIZE + MAX_IMG_PACKET_SIZE-1) / MAX_IMG_PACKET_SIZE + 1;
+	}
+	if (file_size <= 0 || num_packets != expected_packets)
+	{
+// 		llwarns << "Bad image header: " << num_packets << " packets, " << file_size << " bytes for image: " << mID << llendl;
 		return false;
 	}
-	if (index > 0 && index < mTotalPackets-1 && size != MAX_IMG_PACKET_SIZE)
+	delete[] mPacketBuffer;
+	mPacketBuffer = new U8[file_size];
+	mPacketBufferSize = file_size;
+	mPacketBufferPackets = num_packets;
+	mPacketBits.assign((num_packets + 31) / 32, 0);
+	mContiguousPackets = 0;
+	mHighestPacket = -1;
+	return true;
+}
+
+// mInboxMutex is locked
+bool LLTextureFetchWorker::insertPacket(S32 index, const U8* data, S32 size)
+{
+	if (index >= mPacketBufferPackets)
 	{
-// 		llwarns << "Received bad sized packet: " << index << ", " << size << " != " << MAX_IMG_PACKET_SIZE << " for image: " << mID << llendl;
+// 		llwarns << "Received Image Packet " << index << " > max: " << mPacketBufferPackets << " for image: " << mID << llendl;
 		return false;
 	}
-	
-	if (index >= (S32)mPackets.size())
+	S32 offset = 0;
+	S32 expected_size = llmin(FIRST_PACKET_SIZE, mPacketBufferSize);
+	if (index > 0)
 	{
-		mPackets.resize(index+1, (PacketData*)NULL); // initializes v to NULL pointers
+		offset = FIRST_PACKET_SIZE + (index-1) * MAX_IMG_PACKET_SIZE;
+		expected_size = llmin(MAX_IMG_PACKET_SIZE, mPacketBufferSize - offset);
+	}
+	if (size != expected_size)
+	{
+// 		llwarns << "Received bad sized packet: " << index << ", " << size << " != " << expected_size << " for image: " << mID << llendl;
+		return false;
 	}
-	else if (mPackets[index] != NULL)
+	U32 bit = 1 << (index & 31);
+	if (mPacketBits[index >> 5] & bit)
 	{
 // 		llwarns << "Received duplicate packet: " << index << " for image: " << mID << llendl;
 		return false;
 	}
 
-	mPackets[index] = new PacketData(data, size);
-	while (mLastPacket+1 < (S32)mPackets.size() && mPackets[mLastPacket+1] != NULL)
+	memcpy(mPacketBuffer + offset, data, size);
+	mPacketBits[index >> 5] |= bit;
+
+	bool had_gap = mHighestPacket > mContiguousPackets;
+	S32 contiguous = mContiguousPackets;
+	mHighestPacket = llmax(mHighestPacket, index);
+	while (mContiguousPackets < mPacketBufferPackets &&
+		   (mPacketBits[mContiguousPackets >> 5] & (1 << (mContiguousPackets & 31))))
+	{
+		++mContiguousPackets;
+	}
+	if (mHighestPacket > mContiguousPackets && (!had_gap || mContiguousPackets != contiguous))
 	{
-		++mLastPacket;
+		// a new first missing packet, time it from now
+		mPacketGapTimer.reset();
 	}
 	return true;
 }
 
-bool LLTextureFetch::receiveImageHeader(const LLHost& host, const LLUUID& id, U8 codec, U16 packets, U32 totalbytes,
-										U16 data_size, U8* data)
+// mInboxMutex is locked.  Returns the packet buffer, which the caller now
+// owns, and forgets which packets were in it.
+U8* LLTextureFetchWorker::takePacketBuffer()
 {
-	LLMutexLock lock(&mQueueMutex);
-	LLTextureFetchWorker* worker = getWorker(id);
-	bool res = true;
+	U8* buffer = mPacketBuffer;
+	mPacketBuffer = NULL;
+	mPacketBufferSize = 0;
+	mPacketBufferPackets = 0;
+	mPacketBits.clear();
+	mContiguousPackets = 0;
+	mHighestPacket = -1;
+	return buffer;
+}
 
-	++mPacketCount;
-	
-	if (!worker)
+// mWorkMutex is locked
+void LLTextureFetchWorker::resumePackets(const U8* data, S32 data_size)
+{
+	LLMutexLock lock(&mInboxMutex);
+	if (!allocatePacketBuffer(mTotalPackets, mFileSize) || data_size > mFileSize)
 	{
-// 		llwarns << "Received header for non active worker: " << id << llendl;
-		res = false;
+		delete[] takePacketBuffer();
+		return;
 	}
-	else if (worker->mState != LLTextureFetchWorker::LOAD_FROM_NETWORK ||
-			 worker->mSentRequest != LLTextureFetchWorker::SENT_SIM)
+	// the cached bytes stand in for the first mFirstPacket packets
+	memcpy(mPacketBuffer, data, data_size);
+	for (S32 i = 0; i < mFirstPacket; i++)
 	{
-// 		llwarns << "receiveImageHeader for worker: " << id
-// 				<< " in state: " << LLTextureFetchWorker::sStateDescs[worker->mState]
-// 				<< " sent: " << worker->mSentRequest << llendl;
-		res = false;
+		mPacketBits[i >> 5] |= 1 << (i & 31);
 	}
-	else if (worker->mLastPacket != -1)
+	mContiguousPackets = mFirstPacket;
+	mHighestPacket = mFirstPacket-1;
+}
+
+// Called from the MAIN THREAD
+void LLTextureFetchWorker::postImagePriority(F32 priority)
+{
+	F32 delta = fabs(priority - mPostedPriority);
+	if (delta > (mPostedPriority * .05f) || mState == DONE)
 	{
-		// check to see if we've gotten this packet before
-// 		llwarns << "Received duplicate header for: " << id << llendl;
-		res = false;
+		mPostedPriority = priority;
+		{
+			LLMutexLock lock(&mInboxMutex);
+			mInboxPriority = priority;
+		}
+		// Re-sort the request now so that a queued worker is serviced in the right order
+		F32 priority_scale = (F32)LLWorkerThread::PRIORITY_LOWBITS / LLViewerImage::maxDecodePriority();
+		U32 work_priority = (U32)(priority * priority_scale);
+		setPriority(work_priority | (getPriority() & LLWorkerThread::PRIORITY_HIGHBITS));
+	}
+}
+
+// Called from the MAIN THREAD, copies the first packet into a new packet
+// buffer.  Returns false for a header that does not describe a valid image.
+bool LLTextureFetchWorker::postHeader(const LLHost& host, U8 codec, U16 packets, U32 totalbytes,
+									  const U8* data, S32 size)
+{
+	InboxPacket packet;
+	packet.mHost = host;
+	packet.mIndex = 0;
+	packet.mHeader = true;
+	packet.mStored = false;
+	packet.mCodec = codec;
+	packet.mPackets = packets;
+	packet.mTotalBytes = totalbytes;
+	{
+		LLMutexLock lock(&mInboxMutex);
+		if (!mPacketBuffer)
+		{
+			// doWork() checks the header against the request and drops the buffer if it is unwanted
+			if (!allocatePacketBuffer(packets, (S32)totalbytes) ||
+				!insertPacket(0, data, size))
+			{
+				delete[] takePacketBuffer();
+				return false;
+			}
+			packet.mStored = true;
+		}
+		mInbox.push_back(packet);
+	}
+	setPriority(LLWorkerThread::PRIORITY_HIGH | (getPriority() & LLWorkerThread::PRIORITY_LOWBITS));
+	return true;
+}
+
+// Called from the MAIN THREAD, copies the packet into the packet buffer.
+// Returns false if there is no buffer to put it in yet.
+bool LLTextureFetchWorker::postPacket(const LLHost& host, S32 index, const U8* data, S32 size)
+{
+	InboxPacket packet;
+	packet.mHost = host;
+	packet.mIndex = index;
+	packet.mHeader = false;
+	packet.mStored = true;
+	packet.mCodec = 0;
+	packet.mPackets = 0;
+	packet.mTotalBytes = 0;
+	{
+		LLMutexLock lock(&mInboxMutex);
+		if (!mPacketBuffer)
+		{
+// 			llwarns << "Received packet " << index << " before header for: " << mID << llendl;
+			return false;
+		}
+		if (!insertPacket(index, data, size))
+		{
+			return true; // dropped, but not worth cancelling the request for
+		}
+		mInbox.push_back(packet);
 	}
-	else if (!data_size)
+	setPriority(LLWorkerThread::PRIORITY_HIGH | (getPriority() & LLWorkerThread::PRIORITY_LOWBITS));
+	return true;
+}
+
+// Called from the MAIN THREAD.  Returns the first packet still missing and
+// how long it has been missing while later packets arrived, 0 if none has.
+S32 LLTextureFetchWorker::getNextPacket(F32& gap_time)
+{
+	LLMutexLock lock(&mInboxMutex);
+	gap_time = 0.f;
+	if (!mPacketBuffer)
 	{
-// 		llwarns << "Img: " << id << ":" << " Empty Image Header" << llendl;
-		res = false;
+		return mLastPacket + 1;
 	}
-	if (!res)
+	if (mHighestPacket > mContiguousPackets)
 	{
-		++mBadPacketCount;
-		mCancelQueue[host].insert(id);
-		return false;
+		gap_time = mPacketGapTimer.getElapsedTimeF32();
 	}
+	return mContiguousPackets;
+}
 
-	worker->lockWorkData();
-
-	//	Copy header data into image object
-	worker->mImageCodec = codec;
-	worker->mTotalPackets = packets;
-	worker->mFileSize = (S32)totalbytes;	
-	llassert_always(totalbytes > 0);
-	llassert_always(data_size == FIRST_PACKET_SIZE || data_size == worker->mFileSize);
-	res = worker->insertPacket(0, data, data_size);
-	worker->setPriority(LLWorkerThread::PRIORITY_HIGH | worker->mWorkPriority);
-	worker->mState = LLTextureFetchWorker::LOAD_FROM_SIMULATOR;
-	worker->unlockWorkData();
-	return res;
+// mWorkMutex is locked
+void LLTextureFetchWorker::processInbox()
+{
+	F32 priority;
+	S32 contiguous_packets;
+	{
+		LLMutexLock lock(&mInboxMutex);
+		mInboxWork.swap(mInbox);
+		priority = mInboxPriority;
+		mInboxPriority = -1.f;
+		contiguous_packets = mPacketBuffer ? mContiguousPackets : -1;
+	}
+	if (priority >= 0.f)
+	{
+		mImagePriority = priority;
+		calcWorkPriority();
+	}
+	for (std::vector<InboxPacket>::iterator iter = mInboxWork.begin(); iter != mInboxWork.end(); ++iter)
+	{
+		InboxPacket& packet = *iter;
+		mRequestedTimer.reset();
+		if (packet.mHeader)
+		{
+			if (!packet.mStored ||
+				mState != LOAD_FROM_NETWORK || mSentRequest != SENT_SIM)
+			{
+// 				llwarns << "Received duplicate or unrequested header for worker: " << mID
+// 						<< " in state: " << sStateDescs[mState]
+// 						<< " sent: " << mSentRequest << llendl;
+				mFetcher->addBadPacket(packet.mHost, mID);
+				if (packet.mStored)
+				{
+					clearPackets();
+					contiguous_packets = -1;
+				}
+			}
+			else
+			{
+				//	The first packet is already in the packet buffer
+				mImageCodec = packet.mCodec;
+				mTotalPackets = packet.mPackets;
+				mFileSize = (S32)packet.mTotalBytes;
+				mState = LOAD_FROM_SIMULATOR;
+			}
+		}
+		else if ((mState == LOAD_FROM_SIMULATOR) ||
+				 (mState == LOAD_FROM_NETWORK))
+		{
+			mState = LOAD_FROM_SIMULATOR;
+		}
+		else
+		{
+// 			llwarns << "receiveImagePacket " << packet.mIndex << "/" << mLastPacket << " for worker: " << mID
+// 					<< " in state: " << sStateDescs[mState] << llendl;
+			mFetcher->removeFromNetworkQueue(this); // failsafe
+			mFetcher->addBadPacket(packet.mHost, mID);
+		}
+	}
+	mInboxWork.clear();
+	if (contiguous_packets >= 0 && mTotalPackets > 0)
+	{
+		mLastPacket = contiguous_packets - 1;
+	}
 }
 
-bool LLTextureFetch::receiveImagePacket(const LLHost& host, const LLUUID& id, U16 packet_num, U16 data_size, U8* data)
+bool LLTextureFetch::receiveImageHeader(const LLHost& host, const LLUUID& id, U8 codec, U16 packets, U32 totalbytes,
+										U16 data_size, const U8* data)
 {
 	LLMutexLock lock(&mQueueMutex);
 	LLTextureFetchWorker* worker = getWorker(id);
-	bool res = true;
 
 	++mPacketCount;
 	
-	if (!worker)
+	if (!worker || !worker->haveWork())
 	{
-// 		llwarns << "Received packet " << packet_num << " for non active worker: " << id << llendl;
-		res = false;
-	}
-	else if (worker->mLastPacket == -1)
-	{
-// 		llwarns << "Received packet " << packet_num << " before header for: " << id << llendl;
-		res = false;
+// 		llwarns << "Received header for non active worker: " << id << llendl;
+		addBadPacket(host, id);
+		return false;
 	}
-	else if (!data_size)
+	if (!data_size)
 	{
 // 		llwarns << "Img: " << id << ":" << " Empty Image Header" << llendl;
-		res = false;
+		addBadPacket(host, id);
+		return false;
 	}
-	if (!res)
+
+	// The worker validates the header against its state when it next runs
+	if (!worker->postHeader(host, codec, packets, totalbytes, data, data_size))
 	{
-		++mBadPacketCount;
-		mCancelQueue[host].insert(id);
+		addBadPacket(host, id);
 		return false;
 	}
+	return true;
+}
 
-	worker->lockWorkData();
-	
-	res = worker->insertPacket(packet_num, data, data_size);
+bool LLTextureFetch::receiveImagePacket(const LLHost& host, const LLUUID& id, U16 packet_num, U16 data_size, const U8* data)
+{
+	LLMutexLock lock(&mQueueMutex);
+	LLTextureFetchWorker* worker = getWorker(id);
+
+	++mPacketCount;
 	
-	if ((worker->mState == LLTextureFetchWorker::LOAD_FROM_SIMULATOR) ||
-		(worker->mState == LLTextureFetchWorker::LOAD_FROM_NETWORK))
+	if (!worker || !worker->haveWork())
 	{
-		worker->setPriority(LLWorkerThread::PRIORITY_HIGH | worker->mWorkPriority);
-		worker->mState = LLTextureFetchWorker::LOAD_FROM_SIMULATOR;
+// 		llwarns << "Received packet " << packet_num << " for non active worker: " << id << llendl;
+		addBadPacket(host, id);
+		return false;
 	}
-	else
+	if (!data_size)
 	{
-// 		llwarns << "receiveImagePacket " << packet_num << "/" << worker->mLastPacket << " for worker: " << id
-// 			<< " in state: " << LLTextureFetchWorker::sStateDescs[worker->mState] << llendl;
-		removeFromNetworkQueue(worker); // failsafe
-		mCancelQueue[host].insert(id);
+// 		llwarns << "Img: " << id << ":" << " Empty Image Header" << llendl;
+		addBadPacket(host, id);
+		return false;
 	}
-	
-	worker->unlockWorkData();
 
-	return res;
+	if (!worker->postPacket(host, packet_num, data, data_size))
+	{
+		addBadPacket(host, id);
+		return false;
+	}
+	return true;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1931,7 +2213,7 @@ S32 LLTextureFetch::getFetchState(const LLUUID& id, F32& data_progress_p, F32& r
 void LLTextureFetch::dump()
 {
 	llinfos << "LLTextureFetch REQUESTS:" << llendl;
-	for (request_queue_t::iterator iter = mRequestQueue.begin();
+	for (request_queue_t::const_iterator iter = mRequestQueue.begin();
 		 iter != mRequestQueue.end(); ++iter)
 	{
 		LLQueuedThread::QueuedRequest* qreq = *iter;
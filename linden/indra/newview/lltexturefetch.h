@@ -62,8 +62,8 @@ public:
 							LLPointer<LLImageRaw>& raw, LLPointer<LLImageRaw>& aux);
 	bool updateRequestPriority(const LLUUID& id, F32 priority);
 
-	bool receiveImageHeader(const LLHost& host, const LLUUID& id, U8 codec, U16 packets, U32 totalbytes, U16 data_size, U8* data);
-	bool receiveImagePacket(const LLHost& host, const LLUUID& id, U16 packet_num, U16 data_size, U8* data);
+	bool receiveImageHeader(const LLHost& host, const LLUUID& id, U8 codec, U16 packets, U32 totalbytes, U16 data_size, const U8* data);
+	bool receiveImagePacket(const LLHost& host, const LLUUID& id, U16 packet_num, U16 data_size, const U8* data);
 
 	// Debug
 	S32 getFetchState(const LLUUID& id, F32& decode_progress_p, F32& requested_priority_p,
@@ -79,6 +79,7 @@ public:
 protected:
 	void addToNetworkQueue(LLTextureFetchWorker* worker);
 	void removeFromNetworkQueue(LLTextureFetchWorker* worker);
+	void addBadPacket(const LLHost& host, const LLUUID& id);
 	void removeRequest(LLTextureFetchWorker* worker, bool cancel);
 
 private:
@@ -92,7 +93,15 @@ public:
 	S32 mBadPacketCount;
 	
 private:
+	// Lock order: mQueueMutex, then a worker's mWorkMutex, then mNetworkQueueMutex
+	// or the texture cache's mWorkersMutex (readFromCache(), readComplete() and
+	// the write calls), which is why LLTextureCache::update() runs its
+	// responders after releasing mWorkersMutex.
+	// The fetch thread never takes mQueueMutex. getRequestFinished() and
+	// sendRequestListToSimulators() only try a worker's mWorkMutex and skip
+	// workers the fetch thread holds until a later frame.
 	LLMutex mQueueMutex;
+	LLMutex mNetworkQueueMutex; // protects mNetworkQueue, mCancelQueue and mBadPacketCount
 
 	LLTextureCache* mTextureCache;
 	
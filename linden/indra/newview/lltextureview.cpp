@@ -367,7 +367,9 @@ class LLGLTexMemBar : public LLView
 public:
 	LLGLTexMemBar(const std::string& name, LLTextureView* texview)
 		: LLView(name, FALSE),
-		  mTextureView(texview)
+		  mTextureView(texview),
+		  mLastDecodeCount(LLImageWorker::getDecodeCount()),
+		  mDecodeRate(0.f)
 	{
 		S32 line_height = (S32)(LLFontGL::sMonospace->getLineHeight() + .5f);
 		setRect(LLRect(0,0,100,line_height * 4));
@@ -379,6 +381,11 @@ public:
 
 private:
 	LLTextureView* mTextureView;
+
+	// decode rate, resampled about once a second
+	LLFrameTimer mDecodeTimer;
+	U32 mLastDecodeCount;
+	F32 mDecodeRate;
 };
 
 void LLGLTexMemBar::draw()
@@ -485,13 +492,22 @@ void LLGLTexMemBar::draw()
 
 	//----------------------------------------------------------------------------
 
-	text = llformat("Textures: Count: %d Fetch: %d(%d) Pkts:%d(%d) Cache R/W: %d/%d LFS:%d IW:%d(%d) RAW:%d mRaw:%d mAux:%d CB:%d",
+	F32 decode_time = mDecodeTimer.getElapsedTimeF32();
+	if (decode_time >= 1.f)
+	{
+		U32 decode_count = LLImageWorker::getDecodeCount();
+		mDecodeRate = (F32)(decode_count - mLastDecodeCount) / decode_time;
+		mLastDecodeCount = decode_count;
+		mDecodeTimer.reset();
+	}
+
+	text = llformat("Textures: Count: %d Fetch: %d(%d) Pkts:%d(%d) Cache R/W: %d/%d LFS:%d IW:%d(%d) Dec:%.1f/s RAW:%d mRaw:%d mAux:%d CB:%d",
 					gImageList.getNumImages(),
 					LLAppViewer::getTextureFetch()->getNumRequests(), LLAppViewer::getTextureFetch()->getNumDeletes(),
 					LLAppViewer::getTextureFetch()->mPacketCount, LLAppViewer::getTextureFetch()->mBadPacketCount, 
 					LLAppViewer::getTextureCache()->getNumReads(), LLAppViewer::getTextureCache()->getNumWrites(),
 					LLLFSThread::sLocal->getPending(),
-					LLImageWorker::sCount, LLImageWorker::getWorkerThread()->getNumDeletes(),
+					LLImageWorker::sCount, LLImageWorker::getWorkerThread()->getNumDeletes(), mDecodeRate,
 					LLImageRaw::sRawImageCount, LLViewerImage::sRawCount, LLViewerImage::sAuxCount,
 					gImageList.mCallbackList.size());
 
@@ -41,6 +41,7 @@
 #include "llagent.h"
 #include "llconsole.h"
 #include "lldrawpoolterrain.h"
+#include "llface.h"
 #include "llflexibleobject.h"
 #include "llfeaturemanager.h"
 #include "llviewershadermgr.h"
@@ -135,6 +136,12 @@ static bool handleVolumeLODChanged(const LLSD& newvalue)
 	return true;
 }
 
+static bool handlePackedVerticesChanged(const LLSD& newvalue)
+{
+	LLFace::sUsePackedVertices = newvalue.asBoolean();
+	return true;
+}
+
 static bool handleAvatarLODChanged(const LLSD& newvalue)
 {
 	LLVOAvatar::sLODFactor = (F32) newvalue.asReal();
@@ -347,6 +354,12 @@ static bool handleRenderDynamicLODChanged(const LLSD& newvalue)
 	return true;
 }
 
+static bool handleRenderParallelCullChanged(const LLSD& newvalue)
+{
+	LLPipeline::sParallelCull = newvalue.asBoolean();
+	return true;
+}
+
 static bool handleRenderUseFBOChanged(const LLSD& newvalue)
 {
 	LLRenderTarget::sUseFBO = newvalue.asBoolean();
@@ -417,6 +430,7 @@ bool handleRotateNetMapChanged(const LLSD& newvalue)
 bool handleVectorizeChanged(const LLSD& newvalue)
 {
 	LLViewerJointMesh::updateVectorize();
+	LLFace::updateVectorize();
 	return true;
 }
 
@@ -447,6 +461,7 @@ void settings_setup_listeners()
 	gSavedSettings.getControl("RenderGammaFull")->getSignal()->connect(boost::bind(&handleSetShaderChanged, _1));
 	gSavedSettings.getControl("RenderAvatarMaxVisible")->getSignal()->connect(boost::bind(&handleAvatarMaxVisibleChanged, _1));
 	gSavedSettings.getControl("RenderVolumeLODFactor")->getSignal()->connect(boost::bind(&handleVolumeLODChanged, _1));
+	gSavedSettings.getControl("RenderPackedVertices")->getSignal()->connect(boost::bind(&handlePackedVerticesChanged, _1));
 	gSavedSettings.getControl("RenderAvatarLODFactor")->getSignal()->connect(boost::bind(&handleAvatarLODChanged, _1));
 	gSavedSettings.getControl("RenderTerrainLODFactor")->getSignal()->connect(boost::bind(&handleTerrainLODChanged, _1));
 	gSavedSettings.getControl("RenderTreeLODFactor")->getSignal()->connect(boost::bind(&handleTreeLODChanged, _1));
@@ -456,6 +471,7 @@ void settings_setup_listeners()
 	gSavedSettings.getControl("RenderFogRatio")->getSignal()->connect(boost::bind(&handleFogRatioChanged, _1));
 	gSavedSettings.getControl("RenderMaxPartCount")->getSignal()->connect(boost::bind(&handleMaxPartCountChanged, _1));
 	gSavedSettings.getControl("RenderDynamicLOD")->getSignal()->connect(boost::bind(&handleRenderDynamicLODChanged, _1));
+	gSavedSettings.getControl("RenderParallelCull")->getSignal()->connect(boost::bind(&handleRenderParallelCullChanged, _1));
 	gSavedSettings.getControl("RenderDebugTextureBind")->getSignal()->connect(boost::bind(&handleResetVertexBuffersChanged, _1));
 	gSavedSettings.getControl("RenderFastAlpha")->getSignal()->connect(boost::bind(&handleResetVertexBuffersChanged, _1));
 	gSavedSettings.getControl("RenderObjectBump")->getSignal()->connect(boost::bind(&handleResetVertexBuffersChanged, _1));
@@ -1064,23 +1064,23 @@ void LLViewerImageList::receiveImageHeader(LLMessageSystem *msg, void **user_dat
 		<< data_size << llendl;
 		return;
 	}
-	
-	// this buffer gets saved off in the packet list
-	U8 *data = new U8[data_size];
-	msg->getBinaryDataFast(_PREHASH_ImageData, _PREHASH_Data, data, data_size);
+	if (data_size > MTUBYTES)
+	{
+		llerrs << "image header chunk too large: " << data_size << " bytes" << llendl;
+		return;
+	}
 	
 	LLViewerImage *image = gImageList.getImage(id);
 	if (!image)
 	{
-		delete [] data;
 		return;
 	}
 	image->mLastPacketTimer.reset();
-	bool res = LLAppViewer::getTextureFetch()->receiveImageHeader(msg->getSender(), id, codec, packets, totalbytes, data_size, data);
-	if (!res)
-	{
-		delete[] data;
-	}
+
+	// the fetcher copies this into the image's packet buffer
+	U8 data[MTUBYTES];
+	msg->getBinaryDataFast(_PREHASH_ImageData, _PREHASH_Data, data, data_size);
+	LLAppViewer::getTextureFetch()->receiveImageHeader(msg->getSender(), id, codec, packets, totalbytes, data_size, data);
 }
 
 // static
@@ -1130,21 +1130,17 @@ void LLViewerImageList::receiveImagePacket(LLMessageSystem *msg, void **user_dat
 		llerrs << "image data chunk too large: " << data_size << " bytes" << llendl;
 		return;
 	}
-	U8 *data = new U8[data_size];
-	msg->getBinaryDataFast(_PREHASH_ImageData, _PREHASH_Data, data, data_size);
-	
 	LLViewerImage *image = gImageList.getImage(id);
 	if (!image)
 	{
-		delete [] data;
 		return;
 	}
 	image->mLastPacketTimer.reset();
-	bool res = LLAppViewer::getTextureFetch()->receiveImagePacket(msg->getSender(), id, packet_num, data_size, data);
-	if (!res)
-	{
-		delete[] data;
-	}
+
+	// the fetcher copies this into the image's packet buffer
+	U8 data[MTUBYTES];
+	msg->getBinaryDataFast(_PREHASH_ImageData, _PREHASH_Data, data, data_size);
+	LLAppViewer::getTextureFetch()->receiveImagePacket(msg->getSender(), id, packet_num, data_size, data);
 }
 
 
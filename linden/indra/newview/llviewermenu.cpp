@@ -469,6 +469,7 @@ void handle_debug_avatar_textures(void*);
 void handle_grab_texture(void*);
 BOOL enable_grab_texture(void*);
 void handle_dump_region_object_cache(void*);
+void handle_dump_volume_vertex_stats(void*);
 
 BOOL menu_ui_enabled(void *user_data);
 void check_toggle_control( LLUICtrl *, void* user_data );
@@ -1255,6 +1256,8 @@ void init_debug_rendering_menu(LLMenuGL* menu)
 	menu->append(new LLMenuItemToggleGL("Hide Selected", &gHideSelectedObjects));
 	menu->appendSeparator();
 	menu->append(new LLMenuItemCheckGL("Tangent Basis", menu_toggle_control, NULL, menu_check_control, (void*)"ShowTangentBasis"));
+	menu->append(new LLMenuItemCheckGL("Packed Volume Vertices", menu_toggle_control, NULL, menu_check_control, (void*)"RenderPackedVertices"));
+	menu->append(new LLMenuItemCallGL("Dump Volume Vertex Stats", handle_dump_volume_vertex_stats, NULL, NULL));
 	menu->append(new LLMenuItemCallGL("Selected Texture Info", handle_selected_texture_info, NULL, NULL, 'T', MASK_CONTROL|MASK_SHIFT|MASK_ALT));
 	//menu->append(new LLMenuItemCallGL("Dump Image List", handle_dump_image_list, NULL, NULL, 'I', MASK_CONTROL|MASK_SHIFT));
 	
@@ -2716,6 +2719,15 @@ void handle_dump_region_object_cache(void*)
 	}
 }
 
+void handle_dump_volume_vertex_stats(void*)
+{
+	LLPrimitive::getVolumeManager()->dumpVertexStats();
+	llinfos << "Face vertices rebuilt since last dump: " << LLFace::sPackedVertexCount << " packed, "
+			<< LLFace::sUnpackedVertexCount << " unpacked" << llendl;
+	LLFace::sPackedVertexCount = 0;
+	LLFace::sUnpackedVertexCount = 0;
+}
+
 void handle_dump_focus(void *)
 {
 	LLUICtrl *ctrl = dynamic_cast<LLUICtrl*>(gFocusMgr.getKeyboardFocus());
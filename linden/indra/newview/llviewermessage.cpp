@@ -60,6 +60,7 @@
 #include "lltransactionflags.h"
 #include "llxfermanager.h"
 #include "message.h"
+#include "message_accessors.h"
 #include "sound_ids.h"
 #include "lltimer.h"
 #include "llmd5.h"
@@ -1345,21 +1346,42 @@ void process_improved_im(LLMessageSystem *msg, void **user_data)
 	std::string buffer;
 	
 	// *TODO:translate - need to fix the full name to first/last (maybe)
-	msg->getUUIDFast(_PREHASH_AgentData, _PREHASH_AgentID, from_id);
-	msg->getBOOLFast(_PREHASH_MessageBlock, _PREHASH_FromGroup, from_group);
-	msg->getUUIDFast(_PREHASH_MessageBlock, _PREHASH_ToAgentID, to_id);
-	msg->getU8Fast(  _PREHASH_MessageBlock, _PREHASH_Offline, offline);
-	msg->getU8Fast(  _PREHASH_MessageBlock, _PREHASH_Dialog, d);
-	msg->getUUIDFast(_PREHASH_MessageBlock, _PREHASH_ID, session_id);
-	msg->getU32Fast( _PREHASH_MessageBlock, _PREHASH_Timestamp, t);
-	//msg->getData("MessageBlock", "Count",		&count);
-	msg->getStringFast(_PREHASH_MessageBlock, _PREHASH_FromAgentName, name);
-	msg->getStringFast(_PREHASH_MessageBlock, _PREHASH_Message,		message);
-	msg->getU32Fast(_PREHASH_MessageBlock, _PREHASH_ParentEstateID, parent_estate_id);
-	msg->getUUIDFast(_PREHASH_MessageBlock, _PREHASH_RegionID, region_id);
-	msg->getVector3Fast(_PREHASH_MessageBlock, _PREHASH_Position, position);
-	msg->getBinaryDataFast(  _PREHASH_MessageBlock, _PREHASH_BinaryBucket, binary_bucket, 0, 0, MTUBYTES);
-	binary_bucket_size = msg->getSizeFast(_PREHASH_MessageBlock, _PREHASH_BinaryBucket);
+	if (msg->hasAccessorLayout())
+	{
+		using namespace LLMsgIndex::ImprovedInstantMessage;
+		msg->getUUIDIndex(BLOCK_AgentData, AgentData_AgentID, from_id);
+		msg->getBOOLIndex(BLOCK_MessageBlock, MessageBlock_FromGroup, from_group);
+		msg->getUUIDIndex(BLOCK_MessageBlock, MessageBlock_ToAgentID, to_id);
+		msg->getU8Index(  BLOCK_MessageBlock, MessageBlock_Offline, offline);
+		msg->getU8Index(  BLOCK_MessageBlock, MessageBlock_Dialog, d);
+		msg->getUUIDIndex(BLOCK_MessageBlock, MessageBlock_ID, session_id);
+		msg->getU32Index( BLOCK_MessageBlock, MessageBlock_Timestamp, t);
+		//msg->getData("MessageBlock", "Count",		&count);
+		msg->getStringIndex(BLOCK_MessageBlock, MessageBlock_FromAgentName, name);
+		msg->getStringIndex(BLOCK_MessageBlock, MessageBlock_Message,		message);
+		msg->getU32Index(BLOCK_MessageBlock, MessageBlock_ParentEstateID, parent_estate_id);
+		msg->getUUIDIndex(BLOCK_MessageBlock, MessageBlock_RegionID, region_id);
+		msg->getVector3Index(BLOCK_MessageBlock, MessageBlock_Position, position);
+		msg->getBinaryDataIndex(  BLOCK_MessageBlock, MessageBlock_BinaryBucket, binary_bucket, 0, 0, MTUBYTES);
+		binary_bucket_size = msg->getSizeIndex(BLOCK_MessageBlock, MessageBlock_BinaryBucket);
+	}
+	else
+	{
+		msg->getUUIDFast(_PREHASH_AgentData, _PREHASH_AgentID, from_id);
+		msg->getBOOLFast(_PREHASH_MessageBlock, _PREHASH_FromGroup, from_group);
+		msg->getUUIDFast(_PREHASH_MessageBlock, _PREHASH_ToAgentID, to_id);
+		msg->getU8Fast(  _PREHASH_MessageBlock, _PREHASH_Offline, offline);
+		msg->getU8Fast(  _PREHASH_MessageBlock, _PREHASH_Dialog, d);
+		msg->getUUIDFast(_PREHASH_MessageBlock, _PREHASH_ID, session_id);
+		msg->getU32Fast( _PREHASH_MessageBlock, _PREHASH_Timestamp, t);
+		msg->getStringFast(_PREHASH_MessageBlock, _PREHASH_FromAgentName, name);
+		msg->getStringFast(_PREHASH_MessageBlock, _PREHASH_Message,		message);
+		msg->getU32Fast(_PREHASH_MessageBlock, _PREHASH_ParentEstateID, parent_estate_id);
+		msg->getUUIDFast(_PREHASH_MessageBlock, _PREHASH_RegionID, region_id);
+		msg->getVector3Fast(_PREHASH_MessageBlock, _PREHASH_Position, position);
+		msg->getBinaryDataFast(  _PREHASH_MessageBlock, _PREHASH_BinaryBucket, binary_bucket, 0, 0, MTUBYTES);
+		binary_bucket_size = msg->getSizeFast(_PREHASH_MessageBlock, _PREHASH_BinaryBucket);
+	}
 	EInstantMessage dialog = (EInstantMessage)d;
 	time_t timestamp = (time_t)t;
 
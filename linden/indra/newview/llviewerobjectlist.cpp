@@ -34,6 +34,7 @@
 #include "llviewerobjectlist.h"
 
 #include "message.h"
+#include "message_accessors.h"
 #include "timing.h"
 #include "llfasttimer.h"
 #include "llrender.h"
@@ -281,7 +282,19 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 	// Coordinates in simulators are region-local
 	// Until we get region-locality working on viewer we
 	// have to transform to absolute coordinates.
-	num_objects = mesgsys->getNumberOfBlocksFast(_PREHASH_ObjectData);
+	// ObjectUpdate, ObjectUpdateCompressed, ObjectUpdateCached and
+	// ImprovedTerseObjectUpdate all share the RegionData and ObjectData
+	// block indices, the variables inside ObjectData differ.
+	// Without a matching message_accessors.h, read by name instead.
+	const BOOL use_index = mesgsys->hasAccessorLayout();
+	if (use_index)
+	{
+		num_objects = mesgsys->getNumberOfBlocksIndex(LLMsgIndex::ObjectUpdate::BLOCK_ObjectData);
+	}
+	else
+	{
+		num_objects = mesgsys->getNumberOfBlocksFast(_PREHASH_ObjectData);
+	}
 
 	if (!cached && !compressed && update_type != OUT_FULL)
 	{
@@ -314,7 +327,15 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 	}
 
 	U64 region_handle;
-	mesgsys->getU64Fast(_PREHASH_RegionData, _PREHASH_RegionHandle, region_handle);
+	if (use_index)
+	{
+		mesgsys->getU64Index(LLMsgIndex::ObjectUpdate::BLOCK_RegionData, 
+							 LLMsgIndex::ObjectUpdate::RegionData_RegionHandle, region_handle);
+	}
+	else
+	{
+		mesgsys->getU64Fast(_PREHASH_RegionData, _PREHASH_RegionHandle, region_handle);
+	}
 	LLViewerRegion *regionp = LLWorld::getInstance()->getRegionFromHandle(region_handle);
 
 	if (!regionp)
@@ -336,8 +357,18 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 		{
 			U32 id;
 			U32 crc;
-			mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_ID, id, i);
-			mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_CRC, crc, i);
+			if (use_index)
+			{
+				mesgsys->getU32Index(LLMsgIndex::ObjectUpdateCached::BLOCK_ObjectData, 
+									 LLMsgIndex::ObjectUpdateCached::ObjectData_ID, id, i);
+				mesgsys->getU32Index(LLMsgIndex::ObjectUpdateCached::BLOCK_ObjectData, 
+									 LLMsgIndex::ObjectUpdateCached::ObjectData_CRC, crc, i);
+			}
+			else
+			{
+				mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_ID, id, i);
+				mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_CRC, crc, i);
+			}
 		
 			// Lookup data packer and add this id to cache miss lists if necessary.
 			cached_dpp = regionp->getDP(id, crc);
@@ -362,15 +393,33 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 			compressed_dp.reset();
 
 			U32 flags = 0;
+			S32 data_var = LLMsgIndex::ImprovedTerseObjectUpdate::ObjectData_Data;
 			if (update_type != OUT_TERSE_IMPROVED)
 			{
-				mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_UpdateFlags, flags, i);
+				if (use_index)
+				{
+					mesgsys->getU32Index(LLMsgIndex::ObjectUpdateCompressed::BLOCK_ObjectData, 
+										 LLMsgIndex::ObjectUpdateCompressed::ObjectData_UpdateFlags, flags, i);
+				}
+				else
+				{
+					mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_UpdateFlags, flags, i);
+				}
+				data_var = LLMsgIndex::ObjectUpdateCompressed::ObjectData_Data;
 			}
 			
 			if (flags & FLAGS_ZLIB_COMPRESSED)
 			{
-				compressed_length = mesgsys->getSizeFast(_PREHASH_ObjectData, i, _PREHASH_Data);
-				mesgsys->getBinaryDataFast(_PREHASH_ObjectData, _PREHASH_Data, compbuffer, 0, i);
+				if (use_index)
+				{
+					compressed_length = mesgsys->getSizeIndex(LLMsgIndex::ObjectUpdateCompressed::BLOCK_ObjectData, data_var, i);
+					mesgsys->getBinaryDataIndex(LLMsgIndex::ObjectUpdateCompressed::BLOCK_ObjectData, data_var, compbuffer, 0, i);
+				}
+				else
+				{
+					compressed_length = mesgsys->getSizeFast(_PREHASH_ObjectData, i, _PREHASH_Data);
+					mesgsys->getBinaryDataFast(_PREHASH_ObjectData, _PREHASH_Data, compbuffer, 0, i);
+				}
 				uncompressed_length = 2048;
 				uncompress(compressed_dpbuffer, (unsigned long *)&uncompressed_length,
 						   compbuffer, compressed_length);
@@ -378,8 +427,16 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 			}
 			else
 			{
-				uncompressed_length = mesgsys->getSizeFast(_PREHASH_ObjectData, i, _PREHASH_Data);
-				mesgsys->getBinaryDataFast(_PREHASH_ObjectData, _PREHASH_Data, compressed_dpbuffer, 0, i);
+				if (use_index)
+				{
+					uncompressed_length = mesgsys->getSizeIndex(LLMsgIndex::ObjectUpdateCompressed::BLOCK_ObjectData, data_var, i);
+					mesgsys->getBinaryDataIndex(LLMsgIndex::ObjectUpdateCompressed::BLOCK_ObjectData, data_var, compressed_dpbuffer, 0, i);
+				}
+				else
+				{
+					uncompressed_length = mesgsys->getSizeFast(_PREHASH_ObjectData, i, _PREHASH_Data);
+					mesgsys->getBinaryDataFast(_PREHASH_ObjectData, _PREHASH_Data, compressed_dpbuffer, 0, i);
+				}
 				compressed_dp.assignBuffer(compressed_dpbuffer, uncompressed_length);
 			}
 
@@ -406,7 +463,15 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 		}
 		else if (update_type != OUT_FULL)
 		{
-			mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_ID, local_id, i);
+			if (use_index)
+			{
+				mesgsys->getU32Index(LLMsgIndex::ObjectUpdate::BLOCK_ObjectData, 
+									 LLMsgIndex::ObjectUpdate::ObjectData_ID, local_id, i);
+			}
+			else
+			{
+				mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_ID, local_id, i);
+			}
 			getUUIDFromLocal(fullid,
 							local_id,
 							gMessageSystem->getSenderIP(),
@@ -419,8 +484,18 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 		}
 		else
 		{
-			mesgsys->getUUIDFast(_PREHASH_ObjectData, _PREHASH_FullID, fullid, i);
-			mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_ID, local_id, i);
+			if (use_index)
+			{
+				mesgsys->getUUIDIndex(LLMsgIndex::ObjectUpdate::BLOCK_ObjectData, 
+									  LLMsgIndex::ObjectUpdate::ObjectData_FullID, fullid, i);
+				mesgsys->getU32Index(LLMsgIndex::ObjectUpdate::BLOCK_ObjectData, 
+									 LLMsgIndex::ObjectUpdate::ObjectData_ID, local_id, i);
+			}
+			else
+			{
+				mesgsys->getUUIDFast(_PREHASH_ObjectData, _PREHASH_FullID, fullid, i);
+				mesgsys->getU32Fast(_PREHASH_ObjectData, _PREHASH_ID, local_id, i);
+			}
 		//	llinfos << "Full Update, obj " << local_id << ", global ID" << fullid << "from " << mesgsys->getSender() << llendl;
 		}
 		objectp = findObject(fullid);
@@ -457,7 +532,15 @@ void LLViewerObjectList::processObjectUpdate(LLMessageSystem *mesgsys,
 					continue;
 				}
 
-				mesgsys->getU8Fast(_PREHASH_ObjectData, _PREHASH_PCode, pcode, i);
+				if (use_index)
+				{
+					mesgsys->getU8Index(LLMsgIndex::ObjectUpdate::BLOCK_ObjectData, 
+										LLMsgIndex::ObjectUpdate::ObjectData_PCode, pcode, i);
+				}
+				else
+				{
+					mesgsys->getU8Fast(_PREHASH_ObjectData, _PREHASH_PCode, pcode, i);
+				}
 			}
 #ifdef IGNORE_DEAD
 			if (mDeadObjects.find(fullid) != mDeadObjects.end())
@@ -460,6 +460,16 @@ public:
 			
 			ypos += y_inc;
 
+			U32 layout_hits, layout_misses;
+			LLHUDText::getLayoutCacheStats(layout_hits, layout_misses);
+			if (layout_hits + layout_misses > 0)
+			{
+				addText(xpos, ypos, llformat("HUD text layout: %u hits, %u misses (%.0f%%)", layout_hits, layout_misses,
+					100.f * (F32)layout_hits / (F32)(layout_hits + layout_misses)));
+				ypos += y_inc;
+			}
+			LLHUDText::resetLayoutCacheStats();
+
 			LLVertexBuffer::sBindCount = LLImageGL::sBindCount = 
 				LLVertexBuffer::sSetCount = LLImageGL::sUniqueCount = 
 				gPipeline.mNumVisibleNodes = 0;
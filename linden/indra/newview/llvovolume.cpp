@@ -59,6 +59,7 @@
 #include "llsky.h"
 #include "llviewercamera.h"
 #include "llviewerimagelist.h"
+#include "llviewerobjectlist.h"
 #include "llviewerregion.h"
 #include "llviewertextureanim.h"
 #include "llworld.h"
@@ -69,6 +70,9 @@ const S32 MIN_QUIET_FRAMES_COALESCE = 30;
 const F32 FORCE_SIMPLE_RENDER_AREA = 512.f;
 const F32 FORCE_CULL_AREA = 8.f;
 const S32 MAX_SCULPT_REZ = 128;
+// start generating the next detail level up once the object is this close
+// (as a fraction of its current tan angle) to switching to it
+const F32 LOD_PREFETCH_MARGIN = 0.2f;
 
 BOOL gAnimateTextures = TRUE;
 extern BOOL gHideSelectedObjects;
@@ -76,6 +80,7 @@ extern BOOL gHideSelectedObjects;
 F32 LLVOVolume::sLODFactor = 1.f;
 F32	LLVOVolume::sLODSlopDistanceFactor = 0.5f; //Changing this to zero, effectively disables the LOD transition slop 
 F32 LLVOVolume::sDistanceFactor = 1.0f;
+BOOL LLVOVolume::sAsyncVolumes = TRUE;
 S32 LLVOVolume::sNumLODChanges = 0;
 
 LLVOVolume::LLVOVolume(const LLUUID &id, const LLPCode pcode, LLViewerRegion *regionp)
@@ -851,6 +856,18 @@ BOOL LLVOVolume::calcLOD()
 	cur_detail = computeLODDetail(llround(distance, 0.01f), 
 									llround(radius, 0.01f));
 
+	if (sAsyncVolumes && LLPipeline::sDynamicLOD && cur_detail < LLVolumeLODGroup::NUM_LODS - 1)
+	{
+		// Getting close to the next detail level up, have it ready in time
+		F32 tan_angle = llround((sLODFactor*llround(radius, 0.01f))/llround(distance, 0.01f), 0.01f);
+		F32 to_lower, to_higher;
+		LLVolumeLODGroup::getDetailProximity(tan_angle, to_lower, to_higher);
+		if (to_higher < tan_angle * LOD_PREFETCH_MARGIN)
+		{
+			requestVolumeLOD(cur_detail + 1, FALSE);
+		}
+	}
+
 	if (cur_detail != mLOD)
 	{
 		mAppAngle = llround((F32) atan2( mDrawable->getRadius(), mDrawable->mDistanceWRTCamera) * RAD_TO_DEG, 0.01f);
@@ -872,7 +889,9 @@ BOOL LLVOVolume::updateLOD()
 	
 	BOOL lod_changed = calcLOD();
 
-	if (lod_changed)
+	// If the new detail level is still being generated, onVolumeReady()
+	// does this instead and the old one is drawn until then
+	if (lod_changed && requestVolumeLOD(mLOD, TRUE))
 	{
 		gPipeline.markRebuild(mDrawable, LLDrawable::REBUILD_VOLUME, FALSE);
 		mLODChanged = TRUE;
@@ -883,6 +902,46 @@ BOOL LLVOVolume::updateLOD()
 	return lod_changed;
 }
 
+BOOL LLVOVolume::requestVolumeLOD(S32 detail, BOOL notify)
+{
+	if (!sAsyncVolumes || !getVolume() || isSculpted() ||
+		(mVolumeImpl && mVolumeImpl->isVolumeUnique()))
+	{
+		return TRUE;
+	}
+
+	LLUUID* userdata = notify ? new LLUUID(getID()) : NULL;
+	BOOL ready = LLPrimitive::getVolumeManager()->requestVolume(getVolume()->getParams(), detail,
+																notify ? onVolumeReady : NULL, userdata);
+	if (ready)
+	{
+		delete userdata;
+	}
+	return ready;
+}
+
+// static
+void LLVOVolume::onVolumeReady(BOOL success, const LLVolumeParams& volume_params, S32 detail, void* userdata)
+{
+	LLUUID* idp = (LLUUID*)userdata;
+	LLViewerObject* objectp = success ? gObjectList.findObject(*idp) : NULL;
+	delete idp;
+
+	if (!objectp || objectp->isDead() || objectp->getPCode() != LL_PCODE_VOLUME)
+	{
+		return;
+	}
+
+	// only rebuild if the object still wants this volume
+	LLVOVolume* volobjp = (LLVOVolume*)objectp;
+	if (volobjp->mDrawable.notNull() && volobjp->mLOD == detail &&
+		volobjp->getVolume() && volobjp->getVolume()->getParams() == volume_params)
+	{
+		gPipeline.markRebuild(volobjp->mDrawable, LLDrawable::REBUILD_VOLUME, FALSE);
+		volobjp->mLODChanged = TRUE;
+	}
+}
+
 BOOL LLVOVolume::setDrawableParent(LLDrawable* parentp)
 {
 	if (!LLViewerObject::setDrawableParent(parentp))
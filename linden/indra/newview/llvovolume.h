@@ -212,6 +212,11 @@ public:
 protected:
 	S32	computeLODDetail(F32	distance, F32 radius);
 	BOOL calcLOD();
+	// Asks LLVolumeMgr to generate detail off the main thread.  Returns TRUE
+	// if setVolume() can switch to it right away; otherwise, if notify, the
+	// drawable is rebuilt once the volume is ready.
+	BOOL requestVolumeLOD(S32 detail, BOOL notify);
+	static void onVolumeReady(BOOL success, const LLVolumeParams& volume_params, S32 detail, void* userdata);
 	LLFace* addFace(S32 face_index);
 	void updateTEData();
 
@@ -239,6 +244,7 @@ public:
 	static F32 sLODSlopDistanceFactor;// Changing this to zero, effectively disables the LOD transition slop 
 	static F32 sLODFactor;				// LOD scale factor
 	static F32 sDistanceFactor;			// LOD distance factor
+	static BOOL sAsyncVolumes;			// generate LOD changes on the job threads
 		
 protected:
 	static S32 sNumLODChanges;
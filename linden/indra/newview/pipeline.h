@@ -380,6 +380,7 @@ public:
 	static BOOL				sRenderBump;
 	static BOOL				sUseFBO;
 	static BOOL				sUseFarClip;
+	static BOOL				sParallelCull; // classify spatial groups against the frustum on worker threads
 	static BOOL				sSkipUpdate; //skip lod updates
 	static BOOL				sWaterReflections;
 	static BOOL				sDynamicLOD;
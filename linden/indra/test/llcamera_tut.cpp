@@ -0,0 +1,173 @@
+/** 
+ * @file llcamera_tut.cpp
+ * @date 2009-07
+ * @brief Tests and timings for the batch frustum tests in LLCamera.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "llcamera.h"
+#include "lltimer.h"
+
+namespace tut
+{
+	struct llcamera_data
+	{
+		llcamera_data() : mSeed(1)
+		{
+			// a 60x45 degree frustum at the origin looking down +X, corners
+			// in the order LLViewerCamera unprojects them
+			LLVector3 frust[8];
+			frust[0].setVec(1.f, 0.5f, -0.4f);
+			frust[1].setVec(1.f, -0.5f, -0.4f);
+			frust[2].setVec(1.f, -0.5f, 0.4f);
+			frust[3].setVec(1.f, 0.5f, 0.4f);
+			for (U32 i = 0; i < 4; i++)
+			{
+				frust[i+4] = frust[i] * 64.f;
+			}
+			mCamera.calcAgentFrustumPlanes(frust);
+		}
+
+		F32 frand(F32 min, F32 max)
+		{
+			mSeed = mSeed * 1103515245 + 12345;
+			return min + (max - min) * (F32) ((mSeed >> 8) & 0xffff) / 65535.f;
+		}
+
+		// boxes scattered around and through the frustum, with a few
+		// sitting exactly on a plane
+		void makeBoxes(U32 count)
+		{
+			mCenters.resize(count);
+			mRadii.resize(count);
+			for (U32 i = 0; i < count; i++)
+			{
+				mCenters[i].setVec(frand(-16.f, 80.f), frand(-48.f, 48.f), frand(-40.f, 40.f));
+				mRadii[i].setVec(frand(0.f, 8.f), frand(0.f, 8.f), frand(0.f, 8.f));
+				if (i % 17 == 0)
+				{
+					mCenters[i].mV[VX] = 64.f - mRadii[i].mV[VX];
+				}
+			}
+		}
+
+		void ensureAgreement(const char* msg, U32 count)
+		{
+			std::vector<S32> res(count + 1, -1);
+			mCamera.AABBInFrustumBatch(&mCenters[0], &mRadii[0], &res[0], count);
+			for (U32 i = 0; i < count; i++)
+			{
+				ensure_equals(msg, res[i], mCamera.AABBInFrustum(mCenters[i], mRadii[i]));
+			}
+
+			mCamera.AABBInFrustumNoFarClipBatch(&mCenters[0], &mRadii[0], &res[0], count);
+			for (U32 i = 0; i < count; i++)
+			{
+				ensure_equals(msg, res[i], mCamera.AABBInFrustumNoFarClip(mCenters[i], mRadii[i]));
+			}
+			ensure_equals("wrote past the end", res[count], -1);
+		}
+
+		LLCamera mCamera;
+		U32 mSeed;
+		std::vector<LLVector3> mCenters;
+		std::vector<LLVector3> mRadii;
+	};
+	typedef test_group<llcamera_data> llcamera_test;
+	typedef llcamera_test::object llcamera_object;
+	tut::llcamera_test llcamera_testcase("llcamera");
+
+	template<> template<>
+	void llcamera_object::test<1>()
+		// sanity check the frustum used by the other tests
+	{
+		ensure_equals("inside", mCamera.AABBInFrustum(LLVector3(10.f, 0.f, 0.f), LLVector3(1.f, 1.f, 1.f)), 2);
+		ensure_equals("straddling", mCamera.AABBInFrustum(LLVector3(1.f, 0.f, 0.f), LLVector3(1.f, 1.f, 1.f)), 1);
+		ensure_equals("behind", mCamera.AABBInFrustum(LLVector3(-10.f, 0.f, 0.f), LLVector3(1.f, 1.f, 1.f)), 0);
+		ensure_equals("past far", mCamera.AABBInFrustum(LLVector3(100.f, 0.f, 0.f), LLVector3(1.f, 1.f, 1.f)), 0);
+		ensure_equals("past far, no far clip", mCamera.AABBInFrustumNoFarClip(LLVector3(100.f, 0.f, 0.f), LLVector3(1.f, 1.f, 1.f)), 2);
+	}
+
+	template<> template<>
+	void llcamera_object::test<2>()
+		// batch results match the single box tests exactly
+	{
+		makeBoxes(10003);
+		ensureAgreement("6 planes", 10003);
+
+		// short batches that never reach the vector loop
+		for (U32 count = 1; count < 9; count++)
+		{
+			ensureAgreement("short batch", count);
+		}
+
+		mCamera.setUserClipPlane(LLPlane(LLVector3(20.f, 0.f, 0.f), LLVector3(1.f, 0.f, 0.f)));
+		ensureAgreement("user clip plane", 10003);
+		mCamera.disableUserClipPlane();
+	}
+
+	template<> template<>
+	void llcamera_object::test<3>()
+		// single box against batch timings
+	{
+		const U32 NUM_BOXES = 65536;
+		const S32 PASSES = 20;
+		makeBoxes(NUM_BOXES);
+		std::vector<S32> res(NUM_BOXES);
+
+		LLTimer timer;
+		S32 visible = 0;
+		for (S32 pass = 0; pass < PASSES; pass++)
+		{
+			for (U32 i = 0; i < NUM_BOXES; i++)
+			{
+				visible += mCamera.AABBInFrustumNoFarClip(mCenters[i], mRadii[i]) ? 1 : 0;
+			}
+		}
+		F64 single_time = timer.getElapsedTimeF64() / PASSES;
+
+		timer.reset();
+		for (S32 pass = 0; pass < PASSES; pass++)
+		{
+			mCamera.AABBInFrustumNoFarClipBatch(&mCenters[0], &mRadii[0], &res[0], NUM_BOXES);
+			for (U32 i = 0; i < NUM_BOXES; i++)
+			{
+				visible -= res[i] ? 1 : 0;
+			}
+		}
+		F64 batch_time = timer.getElapsedTimeF64() / PASSES;
+
+		llinfos << NUM_BOXES << " box frustum test: single " << single_time * 1000.0
+				<< " ms, batch " << batch_time * 1000.0 << " ms" << llendl;
+		ensure_equals("same visible count", visible, 0);
+	}
+}
@@ -0,0 +1,349 @@
+/** 
+ * @file llfont_tut.cpp
+ * @date 2009-07
+ * @brief Tests for LLFont's glyph page table and LLFontGL's glyph quads, with layout timings.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "llfont.h"
+#include "llfontgl.h"
+#include "lltimer.h"
+#include "v4coloru.h"
+
+namespace
+{
+	// The timings use the viewer's UI font, which the artwork package
+	// unpacks next to the viewer sources. The tests run from indra/test.
+	const std::string FONT_FILE = "../newview/fonts/MtBkLfRg.ttf";
+	const F32 FONT_POINT_SIZE = 12.f;
+	const F32 FONT_DPI = 96.f;
+	const S32 LAYOUT_PASSES = 200;
+
+	// Characters either side of the page table's page and plane edges
+	const llwchar EDGE_CHARS[] = { 0, 0x20, 'A', 0xff, 0x100, 0x3a9, 0x4e2d, 0xfeff, 0xfffd, 0xffff, 0x10000, 0x1f600, 0x10ffff };
+	const S32 EDGE_CHAR_COUNT = sizeof(EDGE_CHARS) / sizeof(EDGE_CHARS[0]);
+
+	// LLFontGL's quad builders, used without a font or GL context
+	class LLFontGLQuads : public LLFontGL
+	{
+	public:
+		using LLFontGL::getGlyphRects;
+		using LLFontGL::drawGlyph;
+	};
+
+	class LLFontTest : public LLFont
+	{
+	public:
+		LLFontGlyphInfo* lookup(llwchar wch) const
+		{
+			return getGlyphInfo(wch);
+		}
+		LLFontGlyphInfo* lookupInMap(llwchar wch) const
+		{
+			char_glyph_info_map_t::const_iterator iter = mCharGlyphInfoMap.find(wch);
+			return (iter == mCharGlyphInfoMap.end()) ? NULL : iter->second;
+		}
+		// a glyph info tagged with its character, as addGlyph() would insert
+		void insert(llwchar wch)
+		{
+			insertGlyphInfo(wch, new LLFontGlyphInfo(wch));
+		}
+		void add(llwchar wch)
+		{
+			if (!hasGlyph(wch))
+			{
+				addChar(wch);
+			}
+		}
+
+		// LLFontGL::render()'s glyph loop without the clipping and batching,
+		// writing the quads out instead of drawing them. Returns the number
+		// of quads.
+		S32 layout(const LLWString& text, U8 style, LLVector3* vertices, LLVector2* uvs, LLColor4U* colors, F32& width)
+		{
+			const LLColor4U color(255, 255, 255, 255);
+			const LLColor4U shadow_color(0, 0, 0, 128);
+			const F32 slant_offset = (style & LLFontGL::ITALIC) ? -mAscender * 0.2f : 0.f;
+			const F32 inv_width = 1.f / mBitmapWidth;
+			const F32 inv_height = 1.f / mBitmapHeight;
+			S32 quad_count = 0;
+			F32 cur_x = 0.f;
+			for (U32 i = 0; i < text.size(); i++)
+			{
+				llwchar wch = text[i];
+				add(wch);
+				const LLFontGlyphInfo* fgi = getGlyphInfo(wch);
+				LLRectf screen_rect;
+				LLRectf uv_rect;
+				LLFontGLQuads::getGlyphRects(fgi, cur_x, 0.f, inv_width, inv_height, screen_rect, uv_rect);
+				LLFontGLQuads::drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect,
+										 color, shadow_color, style, slant_offset);
+
+				cur_x += fgi->mXAdvance;
+				if (i + 1 < text.size())
+				{
+					add(text[i + 1]);
+					cur_x += getXKerning(wch, text[i + 1]);
+				}
+				cur_x = (F32)llfloor(cur_x + 0.5f);
+			}
+			width = cur_x;
+			return quad_count;
+		}
+	};
+
+	// A chat line's worth of mostly ASCII text with a few wider characters
+	LLWString make_text()
+	{
+		const std::string line = "The quick brown fox jumps over the lazy dog. Hover text, names & chat 0123456789! ";
+		LLWString text;
+		for (S32 i = 0; i < 20; i++)
+		{
+			for (U32 j = 0; j < line.size(); j++)
+			{
+				text.push_back((llwchar)(U8)line[j]);
+			}
+			text.push_back(0xe9);
+			text.push_back(0x3a9);
+			text.push_back(0x4e2d);
+			text.push_back(0x1f600);
+		}
+		return text;
+	}
+}
+
+namespace tut
+{
+	struct llfont_data
+	{
+	};
+	typedef test_group<llfont_data> llfont_test;
+	typedef llfont_test::object llfont_object;
+	tut::llfont_test llfont_testcase("llfont");
+
+	template<> template<>
+	void llfont_object::test<1>()
+		// the page table finds what mCharGlyphInfoMap holds, in and beyond
+		// the Basic Multilingual Plane
+	{
+		LLFontTest font;
+		for (S32 i = 0; i < EDGE_CHAR_COUNT; i++)
+		{
+			font.insert(EDGE_CHARS[i]);
+		}
+
+		S32 mismatches = 0;
+		for (U32 wch = 0; wch <= 0xffff; wch++)
+		{
+			if (font.lookup((llwchar)wch) != font.lookupInMap((llwchar)wch))
+			{
+				mismatches++;
+			}
+		}
+		ensure_equals("BMP mismatches", mismatches, 0);
+
+		for (S32 i = 0; i < EDGE_CHAR_COUNT; i++)
+		{
+			const LLFontGlyphInfo* gi = font.lookup(EDGE_CHARS[i]);
+			ensure("inserted", gi != NULL);
+			ensure_equals("right glyph", gi->mGlyphIndex, (U32)EDGE_CHARS[i]);
+		}
+		// neighbours on an allocated page, on an unallocated page and past
+		// the end of the table
+		ensure("same page", font.lookup(0x101) == NULL);
+		ensure("empty page", font.lookup(0x200) == NULL);
+		ensure("beyond the BMP", font.lookup(0x10001) == NULL);
+		ensure("last char", font.lookup(0x10ffff) == font.lookupInMap(0x10ffff));
+
+		// replacing a glyph's info replaces it for both lookups
+		const llwchar replaced[] = { 0, 0xff, 0x4e2d, 0xffff, 0x10000, 0x1f600 };
+		for (S32 i = 0; i < 6; i++)
+		{
+			LLFontGlyphInfo* old_gi = font.lookup(replaced[i]);
+			font.insert(replaced[i]);
+			ensure("replaced", font.lookup(replaced[i]) != old_gi);
+			ensure("replaced in both", font.lookup(replaced[i]) == font.lookupInMap(replaced[i]));
+		}
+	}
+
+	template<> template<>
+	void llfont_object::test<2>()
+		// a glyph's rects and the quads LLFontGL::render() builds from them
+	{
+		LLFontGlyphInfo fgi(1);
+		fgi.mWidth = 6;
+		fgi.mHeight = 8;
+		fgi.mXBitmapOffset = 10;
+		fgi.mYBitmapOffset = 20;
+		fgi.mXBearing = 1;
+		fgi.mYBearing = 7;
+
+		// the glyph's bitmap with half a texel of padding around it
+		LLRectf screen_rect;
+		LLRectf uv_rect;
+		LLFontGLQuads::getGlyphRects(&fgi, 100.f, 50.f, 1.f / 64.f, 1.f / 128.f, screen_rect, uv_rect);
+		ensure_equals("uv left", uv_rect.mLeft, 9.5f / 64.f);
+		ensure_equals("uv top", uv_rect.mTop, 28.5f / 128.f);
+		ensure_equals("uv right", uv_rect.mRight, 16.5f / 64.f);
+		ensure_equals("uv bottom", uv_rect.mBottom, 19.5f / 128.f);
+		ensure_equals("screen left", screen_rect.mLeft, 100.5f);
+		ensure_equals("screen top", screen_rect.mTop, 57.5f);
+		ensure_equals("screen right", screen_rect.mRight, 107.5f);
+		ensure_equals("screen bottom", screen_rect.mBottom, 48.5f);
+
+		const LLColor4U color(255, 255, 255, 255);
+		const LLColor4U shadow_color(0, 0, 0, 128);
+		LLVector3 vertices[6 * 4];
+		LLVector2 uvs[6 * 4];
+		LLColor4U colors[6 * 4];
+
+		S32 quad_count = 0;
+		LLFontGLQuads::drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, color, shadow_color, LLFontGL::NORMAL, 0.f);
+		ensure_equals("normal quads", quad_count, 1);
+		ensure_equals("top right", vertices[0], LLVector3(107.5f, 57.5f, 0.f));
+		ensure_equals("bottom left", vertices[2], LLVector3(100.5f, 48.5f, 0.f));
+		ensure_equals("top right uv", uvs[0], LLVector2(uv_rect.mRight, uv_rect.mTop));
+		ensure_equals("bottom left uv", uvs[2], LLVector2(uv_rect.mLeft, uv_rect.mBottom));
+		ensure("color", colors[3] == color);
+
+		// italics slant the bottom edge, appending to what is there
+		LLFontGLQuads::drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, color, shadow_color, LLFontGL::ITALIC, -2.f);
+		ensure_equals("italic quads", quad_count, 2);
+		ensure_equals("italic top left", vertices[5], LLVector3(100.5f, 57.5f, 0.f));
+		ensure_equals("italic bottom left", vertices[6], LLVector3(98.5f, 48.5f, 0.f));
+
+		// shadows come first so the glyph draws over them
+		quad_count = 0;
+		LLFontGLQuads::drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, color, shadow_color, LLFontGL::DROP_SHADOW, 0.f);
+		ensure_equals("shadow quads", quad_count, 2);
+		ensure_equals("shadow offset", vertices[0], LLVector3(108.5f, 56.5f, 0.f));
+		ensure("shadow color", colors[0] == shadow_color);
+		ensure("glyph color", colors[4] == color);
+
+		quad_count = 0;
+		LLFontGLQuads::drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, color, shadow_color, LLFontGL::DROP_SHADOW_SOFT, 0.f);
+		ensure_equals("soft shadow quads", quad_count, 6);
+		ensure("soft glyph color", colors[5 * 4] == color);
+
+		quad_count = 0;
+		LLFontGLQuads::drawGlyph(quad_count, vertices, uvs, colors, screen_rect, uv_rect, color, shadow_color, LLFontGL::BOLD, 0.f);
+		ensure_equals("bold quads", quad_count, 2);
+		ensure("bold offset", vertices[4].mV[VX] > vertices[0].mV[VX]);
+	}
+
+	template<> template<>
+	void llfont_object::test<3>()
+		// glyph lookup, layout and quad timings, when the artwork is there
+	{
+		if (!LLFile::isfile(FONT_FILE))
+		{
+			llinfos << "No " << FONT_FILE << ", not timing font layout" << llendl;
+			return;
+		}
+		if (!gFontManagerp)
+		{
+			LLFontManager::initClass();
+		}
+		LLFontTest font;
+		ensure("font loads", font.loadFace(FONT_FILE, FONT_POINT_SIZE, FONT_DPI, FONT_DPI, 2, FALSE));
+
+		const LLWString text = make_text();
+		const S32 chars = (S32)text.size();
+		std::vector<LLVector3> vertices(chars * 6 * 4);
+		std::vector<LLVector2> uvs(chars * 6 * 4);
+		std::vector<LLColor4U> colors(chars * 6 * 4);
+		F32 width = 0.f;
+		font.layout(text, LLFontGL::NORMAL, &vertices[0], &uvs[0], &colors[0], width);
+
+		// the page table against the map it indexes
+		LLTimer timer;
+		F32 page_advance = 0.f;
+		for (S32 pass = 0; pass < LAYOUT_PASSES; pass++)
+		{
+			for (S32 i = 0; i < chars; i++)
+			{
+				page_advance += font.lookup(text[i])->mXAdvance;
+			}
+		}
+		F64 page_time = timer.getElapsedTimeF64();
+		timer.reset();
+		F32 map_advance = 0.f;
+		for (S32 pass = 0; pass < LAYOUT_PASSES; pass++)
+		{
+			for (S32 i = 0; i < chars; i++)
+			{
+				map_advance += font.lookupInMap(text[i])->mXAdvance;
+			}
+		}
+		F64 map_time = timer.getElapsedTimeF64();
+		ensure_equals("same glyphs", page_advance, map_advance);
+
+		// advances and kerning only, as LLFontGL::getWidth() does
+		timer.reset();
+		F32 layout_width = 0.f;
+		for (S32 pass = 0; pass < LAYOUT_PASSES; pass++)
+		{
+			F32 cur_x = 0.f;
+			for (S32 i = 0; i < chars; i++)
+			{
+				cur_x += font.getXAdvance(text[i]);
+				if (i + 1 < chars)
+				{
+					cur_x += font.getXKerning(text[i], text[i + 1]);
+				}
+				cur_x = (F32)llfloor(cur_x + 0.5f);
+			}
+			layout_width = cur_x;
+		}
+		F64 layout_time = timer.getElapsedTimeF64();
+		ensure_equals("width", layout_width, width);
+
+		const U8 styles[] = { LLFontGL::NORMAL, LLFontGL::DROP_SHADOW_SOFT };
+		F64 quad_time[2];
+		for (S32 s = 0; s < 2; s++)
+		{
+			timer.reset();
+			for (S32 pass = 0; pass < LAYOUT_PASSES; pass++)
+			{
+				font.layout(text, styles[s], &vertices[0], &uvs[0], &colors[0], width);
+			}
+			quad_time[s] = timer.getElapsedTimeF64();
+		}
+
+		const F64 us_per_char = 1000000.0 / ((F64)LAYOUT_PASSES * chars);
+		llinfos << chars << " characters, us per character: page table lookup " << page_time * us_per_char
+				<< ", map lookup " << map_time * us_per_char
+				<< ", layout " << layout_time * us_per_char
+				<< ", layout and quads " << quad_time[0] * us_per_char
+				<< ", with soft shadow " << quad_time[1] * us_per_char << llendl;
+	}
+}
@@ -0,0 +1,158 @@
+/** 
+ * @file lljobsystem_tut.cpp
+ * @date 2009-07
+ * @brief Tests for the LLJobSystem work-stealing job threads.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include <algorithm>
+
+#include "lljobsystem.h"
+#include "llstl.h"
+
+namespace
+{
+	// Records the order jobs finish in
+	class LLOrderJob : public LLJob
+	{
+	public:
+		LLOrderJob(S32 id, LLAtomicS32* next_slot, S32* order)
+			: mID(id), mNextSlot(next_slot), mOrder(order) {}
+
+		/*virtual*/ void run()
+		{
+			mOrder[(*mNextSlot)++] = mID;
+		}
+
+	private:
+		S32 mID;
+		LLAtomicS32* mNextSlot;
+		S32* mOrder;
+	};
+
+	struct LLSumRange
+	{
+		LLSumRange(const std::vector<U32>& values) : mValues(values), mMutex(NULL), mSum(0), mCalls(0) {}
+
+		void operator()(S32 begin, S32 end)
+		{
+			U32 sum = 0;
+			for (S32 i = begin; i < end; i++)
+			{
+				sum += mValues[i];
+			}
+			mMutex.lock();
+			mSum += sum;
+			mCalls++;
+			mMutex.unlock();
+		}
+
+		const std::vector<U32>& mValues;
+		LLMutex mMutex;
+		U32 mSum;
+		S32 mCalls;
+	};
+}
+
+namespace tut
+{
+	struct lljobsystem_data
+	{
+		lljobsystem_data()
+		{
+			LLJobSystem::initClass(3);
+		}
+		~lljobsystem_data()
+		{
+			LLJobSystem::cleanupClass();
+		}
+	};
+	typedef test_group<lljobsystem_data> lljobsystem_test;
+	typedef lljobsystem_test::object lljobsystem_object;
+	tut::lljobsystem_test lljobsystem_testcase("lljobsystem");
+
+	template<> template<>
+	void lljobsystem_object::test<1>()
+		// every job runs once, and never before the jobs it depends on
+	{
+		// 0 -> {1, 2} -> 3, and 4..15 with no dependencies
+		const S32 COUNT = 16;
+		LLAtomicS32 next_slot;
+		next_slot = 0;
+		S32 order[COUNT];
+		std::vector<LLJob*> jobs;
+		for (S32 i = 0; i < COUNT; i++)
+		{
+			jobs.push_back(new LLOrderJob(i, &next_slot, order));
+		}
+		jobs[1]->addDependency(jobs[0]);
+		jobs[2]->addDependency(jobs[0]);
+		jobs[3]->addDependency(jobs[1]);
+		jobs[3]->addDependency(jobs[2]);
+
+		// submit the dependents first so they have to wait
+		std::reverse(jobs.begin(), jobs.end());
+		LLJobSystem::getInstance()->run(jobs);
+
+		ensure_equals("all jobs ran", (S32)next_slot, COUNT);
+		S32 position[COUNT];
+		for (S32 i = 0; i < COUNT; i++)
+		{
+			position[order[i]] = i;
+		}
+		ensure("1 after 0", position[1] > position[0]);
+		ensure("2 after 0", position[2] > position[0]);
+		ensure("3 after 1", position[3] > position[1]);
+		ensure("3 after 2", position[3] > position[2]);
+
+		std::for_each(jobs.begin(), jobs.end(), DeletePointer());
+	}
+
+	template<> template<>
+	void lljobsystem_object::test<2>()
+		// parallelFor covers the whole range exactly once
+	{
+		const S32 COUNT = 100000;
+		std::vector<U32> values(COUNT);
+		U32 expected = 0;
+		for (S32 i = 0; i < COUNT; i++)
+		{
+			values[i] = i * 7 + 3;
+			expected += values[i];
+		}
+
+		LLSumRange sum(values);
+		LLJobSystem::getInstance()->parallelFor(0, COUNT, 1000, sum);
+		ensure_equals("sum", sum.mSum, expected);
+		ensure_equals("ranges", sum.mCalls, 100);
+	}
+}
@@ -0,0 +1,265 @@
+/** 
+ * @file lloctree_tut.cpp
+ * @date 2009-07
+ * @brief Tests and timings for octree element storage.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "llmemory.h"
+#include "v3dmath.h"
+#include "lloctree.h"
+#include "lltimer.h"
+
+namespace
+{
+	// Stand-in for LLDrawable with just what LLOctreeNode needs.
+	class LLOctreeTestElement : public LLRefCount
+	{
+	public:
+		LLOctreeTestElement(const LLVector3d& pos, F64 radius)
+		:	mPositionGroup(pos),
+			mBinRadius(radius),
+			mBinIndex(-1)
+		{
+		}
+
+		const LLVector3d& getPositionGroup() const	{ return mPositionGroup; }
+		F64 getBinRadius() const					{ return mBinRadius; }
+		S32 getBinIndex() const						{ return mBinIndex; }
+		void setBinIndex(S32 index)					{ mBinIndex = index; }
+
+	private:
+		LLVector3d mPositionGroup;
+		F64 mBinRadius;
+		S32 mBinIndex;
+	};
+
+	typedef LLOctreeNode<LLOctreeTestElement> test_node;
+	typedef LLOctreeRoot<LLOctreeTestElement> test_root;
+
+	// Counts elements inside an axis aligned box, skipping branches that
+	// miss it the way the spatial partition cull does.
+	class LLOctreeBoxCounter : public LLOctreeTraveler<LLOctreeTestElement>
+	{
+	public:
+		LLOctreeBoxCounter(const LLVector3d& min, const LLVector3d& max)
+		:	mMin(min), mMax(max), mCount(0), mBadIndex(0)
+		{
+		}
+
+		virtual void traverse(const LLTreeNode<LLOctreeTestElement>* tree_node)
+		{
+			const test_node* node = (const test_node*) tree_node;
+			const LLVector3d& center = node->getCenter();
+			const LLVector3d& size = node->getSize();
+			for (U32 i = 0; i < 3; i++)
+			{
+				if (center.mdV[i] + size.mdV[i] < mMin.mdV[i] ||
+					center.mdV[i] - size.mdV[i] > mMax.mdV[i])
+				{
+					return;
+				}
+			}
+			LLOctreeTraveler<LLOctreeTestElement>::traverse(node);
+		}
+
+		virtual void visit(const test_node* branch)
+		{
+			const test_node::element_list& data = branch->getData();
+			for (U32 i = 0; i < data.size(); i++)
+			{
+				if (data[i]->getBinIndex() != (S32) i)
+				{
+					mBadIndex++;
+				}
+				if (inBox(data[i]->getPositionGroup()))
+				{
+					mCount++;
+				}
+			}
+		}
+
+		bool inBox(const LLVector3d& pos) const
+		{
+			for (U32 i = 0; i < 3; i++)
+			{
+				if (pos.mdV[i] < mMin.mdV[i] || pos.mdV[i] > mMax.mdV[i])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		LLVector3d mMin;
+		LLVector3d mMax;
+		S32 mCount;
+		S32 mBadIndex;
+	};
+}
+
+namespace tut
+{
+	struct LLOctreeTestData
+	{
+		enum { NUM_ELEMENTS = 50000 };
+
+		LLOctreeTestData()
+		:	mSeed(1)
+		{
+			for (S32 i = 0; i < NUM_ELEMENTS; i++)
+			{
+				// a 256m region, mostly small objects with a few big ones
+				LLVector3d pos(rand(256.0), rand(256.0), rand(64.0));
+				F64 radius = (i % 100) ? 0.25 + rand(4.0) : 16.0 + rand(64.0);
+				mElements.push_back(new LLOctreeTestElement(pos, radius));
+			}
+			mRoot = new test_root(LLVector3d(0,0,0), LLVector3d(1,1,1), NULL);
+		}
+
+		~LLOctreeTestData()
+		{
+			delete mRoot;
+		}
+
+		// repeatable across runs and platforms
+		F64 rand(F64 range)
+		{
+			mSeed = mSeed * 1103515245 + 12345;
+			return range * (F64)((mSeed >> 8) & 0xFFFF) / 65536.0;
+		}
+
+		S32 countInBox(const LLVector3d& min, const LLVector3d& max)
+		{
+			LLOctreeBoxCounter counter(min, max);
+			S32 count = 0;
+			for (U32 i = 0; i < mElements.size(); i++)
+			{
+				if (counter.inBox(mElements[i]->getPositionGroup()))
+				{
+					count++;
+				}
+			}
+			return count;
+		}
+
+		U32 mSeed;
+		std::vector<LLPointer<LLOctreeTestElement> > mElements;
+		test_node* mRoot;
+	};
+
+	typedef test_group<LLOctreeTestData> LLOctreeTestGroup;
+	typedef LLOctreeTestGroup::object LLOctreeTestObject;
+	LLOctreeTestGroup octreeTestGroup("LLOctree");
+
+	template<> template<>
+	void LLOctreeTestObject::test<1>()
+		// every element is found once, with a valid back index
+	{
+		for (U32 i = 0; i < mElements.size(); i++)
+		{
+			mRoot->insert(mElements[i]);
+		}
+
+		LLOctreeBoxCounter all(LLVector3d(-1.0e6, -1.0e6, -1.0e6), LLVector3d(1.0e6, 1.0e6, 1.0e6));
+		all.traverse(mRoot);
+		ensure_equals("all elements stored", all.mCount, (S32) NUM_ELEMENTS);
+		ensure_equals("back indices", all.mBadIndex, 0);
+
+		LLVector3d min(32.0, 96.0, 0.0);
+		LLVector3d max(96.0, 160.0, 20.0);
+		LLOctreeBoxCounter box(min, max);
+		box.traverse(mRoot);
+		ensure_equals("box query", box.mCount, countInBox(min, max));
+	}
+
+	template<> template<>
+	void LLOctreeTestObject::test<2>()
+		// swap removal keeps the rest of the tree intact
+	{
+		for (U32 i = 0; i < mElements.size(); i++)
+		{
+			mRoot->insert(mElements[i]);
+		}
+
+		for (U32 i = 0; i < mElements.size(); i += 2)
+		{
+			test_node* node = mRoot->getNodeAt(mElements[i]);
+			ensure("element is where getNodeAt says", node->hasData(mElements[i]));
+			node->remove(mElements[i]);
+			ensure_equals("index cleared", mElements[i]->getBinIndex(), -1);
+		}
+
+		LLOctreeBoxCounter all(LLVector3d(-1.0e6, -1.0e6, -1.0e6), LLVector3d(1.0e6, 1.0e6, 1.0e6));
+		all.traverse(mRoot);
+		ensure_equals("half removed", all.mCount, (S32) NUM_ELEMENTS / 2);
+		ensure_equals("back indices after removal", all.mBadIndex, 0);
+	}
+
+	template<> template<>
+	void LLOctreeTestObject::test<3>()
+		// insert, cull and remove timings for a 50k element scene
+	{
+		LLTimer timer;
+		for (U32 i = 0; i < mElements.size(); i++)
+		{
+			mRoot->insert(mElements[i]);
+		}
+		F64 insert_time = timer.getElapsedTimeF64();
+
+		const S32 CULL_PASSES = 20;
+		timer.reset();
+		S32 visible = 0;
+		for (S32 pass = 0; pass < CULL_PASSES; pass++)
+		{
+			// sweep a 64m view box across the region
+			LLVector3d min(pass * 8.0, 64.0, 0.0);
+			LLOctreeBoxCounter box(min, min + LLVector3d(64.0, 64.0, 64.0));
+			box.traverse(mRoot);
+			visible += box.mCount;
+		}
+		F64 cull_time = timer.getElapsedTimeF64() / CULL_PASSES;
+
+		timer.reset();
+		for (U32 i = 0; i < mElements.size(); i++)
+		{
+			mRoot->getNodeAt(mElements[i])->remove(mElements[i]);
+		}
+		F64 remove_time = timer.getElapsedTimeF64();
+
+		llinfos << NUM_ELEMENTS << " element octree: insert " << insert_time * 1000.0
+				<< " ms, cull traversal " << cull_time * 1000.0
+				<< " ms (" << visible / CULL_PASSES << " visible), remove "
+				<< remove_time * 1000.0 << " ms" << llendl;
+		ensure_equals("all removed", mRoot->getElementCount(), 0U);
+	}
+}
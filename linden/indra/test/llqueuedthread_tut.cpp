@@ -0,0 +1,239 @@
+/** 
+ * @file llqueuedthread_tut.cpp
+ * @date 2009-07
+ * @brief Tests and contention timings for the LLQueuedThread request queue.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include <algorithm>
+
+#include "llindexedheap.h"
+#include "llqueuedthread.h"
+#include "lltimer.h"
+
+namespace
+{
+	struct HeapItem
+	{
+		HeapItem() : mKey(0), mHeapIndex(-1) {}
+		U32 mKey;
+		S32 mHeapIndex;
+	};
+
+	struct heap_item_less
+	{
+		bool operator()(const HeapItem* lhs, const HeapItem* rhs) const
+		{
+			// larger key on top, ties broken by address like the request handles
+			return lhs->mKey == rhs->mKey ? lhs < rhs : lhs->mKey > rhs->mKey;
+		}
+	};
+	typedef LLIndexedHeap<HeapItem, heap_item_less> item_heap_t;
+
+	//------------------------------------------------------------------------
+
+	class LLTestQueuedThread : public LLQueuedThread
+	{
+	public:
+		class TestRequest : public QueuedRequest
+		{
+		public:
+			TestRequest(handle_t handle, U32 priority, LLTestQueuedThread* thread)
+				: QueuedRequest(handle, priority, FLAG_AUTO_COMPLETE), mThread(thread) {}
+			/*virtual*/ bool processRequest()
+			{
+				mThread->mProcessed++;
+				return true;
+			}
+		private:
+			LLTestQueuedThread* mThread;
+		};
+
+		LLTestQueuedThread() : LLQueuedThread("TestQueue", true), mProcessed(0) {}
+
+		handle_t add(U32 priority)
+		{
+			handle_t handle = generateHandle();
+			addRequest(new TestRequest(handle, priority, this));
+			return handle;
+		}
+
+		LLAtomicU32 mProcessed;
+	};
+
+	// Adds requests as fast as it can, re-prioritizing an earlier one after each add,
+	// the way LLTextureFetch and LLTextureCache do from the main thread.
+	class LLProducerThread : public LLThread
+	{
+	public:
+		LLProducerThread(LLTestQueuedThread* queue, U32 count, U32 seed)
+			: LLThread("TestProducer"), mDone(FALSE), mQueue(queue), mCount(count), mSeed(seed) {}
+
+		/*virtual*/ void run()
+		{
+			const U32 WINDOW = 64;
+			LLQueuedThread::handle_t handles[WINDOW];
+			for (U32 i = 0; i < mCount; i++)
+			{
+				handles[i % WINDOW] = mQueue->add(nextPriority());
+				if (i >= WINDOW)
+				{
+					mQueue->setPriority(handles[(i + 1) % WINDOW], nextPriority());
+				}
+			}
+			mDone = TRUE;
+		}
+
+		// mStatus is only RUNNING once run() has been entered, so don't rely on isStopped()
+		bool isDone() { return mDone && isStopped(); }
+
+	private:
+		LLAtomic32<BOOL> mDone;
+
+		U32 nextPriority()
+		{
+			mSeed = mSeed * 1103515245 + 12345;
+			return LLQueuedThread::PRIORITY_NORMAL | ((mSeed >> 4) & LLQueuedThread::PRIORITY_LOWBITS);
+		}
+
+		LLTestQueuedThread* mQueue;
+		U32 mCount;
+		U32 mSeed;
+	};
+}
+
+namespace tut
+{
+	struct llqueuedthread_data
+	{
+		llqueuedthread_data() : mSeed(1) {}
+
+		U32 rand()
+		{
+			mSeed = mSeed * 1103515245 + 12345;
+			return (mSeed >> 16) & 0x7fff;
+		}
+
+		U32 mSeed;
+	};
+	typedef test_group<llqueuedthread_data> llqueuedthread_test;
+	typedef llqueuedthread_test::object llqueuedthread_object;
+	tut::llqueuedthread_test llqueuedthread_testcase("llqueuedthread");
+
+	template<> template<>
+	void llqueuedthread_object::test<1>()
+		// heap pops in priority order through pushes, updates and erases
+	{
+		const U32 COUNT = 1000;
+		std::vector<HeapItem> items(COUNT);
+		item_heap_t heap;
+		for (U32 i = 0; i < COUNT; i++)
+		{
+			items[i].mKey = rand() % 100;
+			heap.push(&items[i]);
+		}
+		for (U32 i = 0; i < COUNT; i++)
+		{
+			HeapItem* item = &items[rand() % COUNT];
+			item->mKey = rand() % 100;
+			heap.update(item);
+		}
+		for (U32 i = 0; i < COUNT; i += 3)
+		{
+			heap.erase(&items[i]);
+			ensure("erased", !heap.contains(&items[i]));
+		}
+
+		std::vector<HeapItem*> expected;
+		for (U32 i = 0; i < COUNT; i++)
+		{
+			if (heap.contains(&items[i]))
+			{
+				expected.push_back(&items[i]);
+			}
+		}
+		std::sort(expected.begin(), expected.end(), heap_item_less());
+		ensure_equals("size", heap.size(), (U32)expected.size());
+		for (U32 i = 0; i < expected.size(); i++)
+		{
+			ensure("pop order", heap.pop() == expected[i]);
+		}
+		ensure("empty", heap.empty());
+	}
+
+	template<> template<>
+	void llqueuedthread_object::test<2>()
+		// 4 producers and 1 consumer thread; every request is processed exactly once
+	{
+		const U32 NUM_PRODUCERS = 4;
+		const U32 REQUESTS_PER_PRODUCER = 50000;
+		const U32 TOTAL = NUM_PRODUCERS * REQUESTS_PER_PRODUCER;
+
+		LLTestQueuedThread* queue = new LLTestQueuedThread;
+		std::vector<LLProducerThread*> producers;
+		for (U32 i = 0; i < NUM_PRODUCERS; i++)
+		{
+			producers.push_back(new LLProducerThread(queue, REQUESTS_PER_PRODUCER, i + 1));
+		}
+
+		LLTimer timer;
+		for (U32 i = 0; i < NUM_PRODUCERS; i++)
+		{
+			producers[i]->start();
+		}
+		for (U32 i = 0; i < NUM_PRODUCERS; i++)
+		{
+			while (!producers[i]->isDone())
+			{
+				ms_sleep(1);
+			}
+		}
+		F64 produce_time = timer.getElapsedTimeF64();
+		while ((U32)queue->mProcessed < TOTAL && timer.getElapsedTimeF64() < 60.0)
+		{
+			queue->update(0);
+			ms_sleep(1);
+		}
+		F64 total_time = timer.getElapsedTimeF64();
+
+		llinfos << TOTAL << " requests from " << NUM_PRODUCERS << " producers: queued in "
+				<< produce_time * 1000.0 << " ms, processed in " << total_time * 1000.0 << " ms" << llendl;
+		ensure_equals("all processed", (U32)queue->mProcessed, TOTAL);
+		ensure_equals("none pending", queue->getPending(), 0);
+
+		for (U32 i = 0; i < NUM_PRODUCERS; i++)
+		{
+			delete producers[i];
+		}
+		delete queue;
+	}
+}
@@ -0,0 +1,230 @@
+/** 
+ * @file llsdarena_tut.cpp
+ * @date 2009-07
+ * @brief Tests for LLSDArena and LLSDArenaScope.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "llapr.h"
+#include "llsd.h"
+#include "llsdarena.h"
+#include "llsdserialize.h"
+
+namespace tut
+{
+	struct llsdarena_data
+	{
+		llsdarena_data()
+		{
+			ll_init_apr();
+			LLSDArena::initClass();
+			mChunksAtStart = LLSDArena::getChunkCount();
+		}
+
+		~llsdarena_data()
+		{
+			LLSDArena::sEnabled = true;
+		}
+
+		// something shaped like a parsed message: an array of maps
+		static LLSD makeTree(S32 count)
+		{
+			LLSD tree;
+			for (S32 i = 0; i < count; i++)
+			{
+				LLSD entry;
+				entry["name"] = "an entry with a name long enough to need its own buffer";
+				entry["index"] = i;
+				entry["scale"] = i * 0.5;
+				entry["enabled"] = (i & 1) != 0;
+				tree.append(entry);
+			}
+			return tree;
+		}
+
+		S32 chunksInUse() const { return LLSDArena::getChunkCount() - mChunksAtStart; }
+
+		S32 mChunksAtStart;
+	};
+	typedef test_group<llsdarena_data> llsdarena_test;
+	typedef llsdarena_test::object llsdarena_object;
+	tut::llsdarena_test llsdarena_testcase("llsdarena");
+
+	template<> template<>
+	void llsdarena_object::test<1>()
+		// without a scope values come from the heap
+	{
+		LLSD tree = makeTree(100);
+		ensure_equals("no chunks", chunksInUse(), 0);
+
+		void* ptr = LLSDArena::allocate(64);
+		ensure("allocated", ptr != NULL);
+		LLSDArena::free(ptr);
+		LLSDArena::free(NULL);
+		ensure_equals("still no chunks", chunksInUse(), 0);
+	}
+
+	template<> template<>
+	void llsdarena_object::test<2>()
+		// values made in a scope live in chunks, freed with the last value in them
+	{
+		LLSD tree;
+		{
+			LLSDArenaScope scope;
+			tree = makeTree(1000);
+			ensure("chunks allocated", chunksInUse() > 1);
+		}
+		ensure("chunks outlive the scope", chunksInUse() > 1);
+		ensure_equals("values intact", tree[999]["index"].asInteger(), 999);
+
+		// one value kept from the tree holds on to its own chunk only
+		LLSD kept = tree[500]["scale"];
+		tree.clear();
+		ensure_equals("one chunk kept", chunksInUse(), 1);
+		ensure_equals("kept value", kept.asReal(), 250.0);
+
+		// copies share the value, the chunk goes with the last of them
+		LLSD copy = kept;
+		kept.clear();
+		ensure_equals("copy keeps the chunk", chunksInUse(), 1);
+		copy.clear();
+		ensure_equals("all chunks freed", chunksInUse(), 0);
+	}
+
+	template<> template<>
+	void llsdarena_object::test<3>()
+		// nested scopes share the outermost scope's arena
+	{
+		LLSD outer_value;
+		LLSD inner_value;
+		{
+			LLSDArenaScope outer;
+			outer_value = makeTree(10);
+			S32 chunks = chunksInUse();
+			ensure_equals("one chunk so far", chunks, 1);
+			{
+				LLSDArenaScope inner;
+				inner_value = makeTree(10);
+				ensure_equals("inner scope fills the same chunk", chunksInUse(), chunks);
+			}
+			// the inner scope did not end the outer one
+			LLSD more = makeTree(10);
+			ensure_equals("still the same chunk", chunksInUse(), chunks);
+		}
+		LLSD after = makeTree(10);
+		ensure_equals("no arena after the outer scope", chunksInUse(), 1);
+
+		outer_value.clear();
+		ensure_equals("chunk kept by the inner values", chunksInUse(), 1);
+		inner_value.clear();
+		ensure_equals("all chunks freed", chunksInUse(), 0);
+	}
+
+	template<> template<>
+	void llsdarena_object::test<4>()
+		// LLSD::Impl's operator new and delete go through the arena
+	{
+		LLSDArenaScope scope;
+		ensure_equals("no chunks yet", chunksInUse(), 0);
+		{
+			LLSD value = 42;
+			ensure_equals("integer from a chunk", chunksInUse(), 1);
+			LLSD str = "a string value";
+			LLSD map = LLSD::emptyMap();
+			LLSD array = LLSD::emptyArray();
+			ensure_equals("same chunk", chunksInUse(), 1);
+		}
+		// freed while the chunk is still being filled: the chunk stays
+		ensure_equals("filling chunk kept", chunksInUse(), 1);
+
+		// a temporary freed straight away gives its space back
+		void* first = LLSDArena::allocate(40);
+		LLSDArena::free(first);
+		void* second = LLSDArena::allocate(40);
+		ensure("space reused", first == second);
+		LLSDArena::free(second);
+
+		// large allocations go on the heap
+		void* large = LLSDArena::allocate(64 * 1024);
+		ensure_equals("large not in a chunk", chunksInUse(), 1);
+		memset(large, 0, 64 * 1024);
+		LLSDArena::free(large);
+	}
+
+	template<> template<>
+	void llsdarena_object::test<5>()
+		// disabled scopes have no effect
+	{
+		LLSDArena::sEnabled = false;
+		LLSDArenaScope scope;
+		LLSD tree = makeTree(100);
+		ensure_equals("no chunks", chunksInUse(), 0);
+	}
+
+	template<> template<>
+	void llsdarena_object::test<6>()
+		// parsers open a scope, and interned keys come out the same
+	{
+		std::string xml;
+		{
+			std::ostringstream ostr;
+			LLSDSerialize::toXML(makeTree(200), ostr);
+			xml = ostr.str();
+		}
+
+		LLSD parsed;
+		std::istringstream istr(xml);
+		ensure("parsed", LLSDSerialize::fromXML(parsed, istr) > 0);
+		ensure("parsed into chunks", chunksInUse() > 0);
+		ensure_equals("parsed values", parsed[199]["index"].asInteger(), 199);
+		ensure_equals("parsed keys", parsed[199]["name"].asString(),
+					  std::string("an entry with a name long enough to need its own buffer"));
+		parsed.clear();
+		ensure_equals("all chunks freed", chunksInUse(), 0);
+
+		const std::string key("a map key long enough to need its own buffer");
+		ensure("no scope, no interning", &LLSDArena::intern(key) == &key);
+		{
+			LLSDArenaScope scope;
+			const std::string same_key(key);
+			const std::string& first = LLSDArena::intern(key);
+			const std::string& second = LLSDArena::intern(same_key);
+			ensure_equals("interned value", first, key);
+#if LL_SHARED_STRING_BUFFERS
+			ensure("one copy per scope", &first == &second);
+#else
+			// copies would not share buffers, so there is nothing to gain
+			ensure("returned as is", &first == &key && &second == &same_key);
+#endif
+		}
+	}
+}
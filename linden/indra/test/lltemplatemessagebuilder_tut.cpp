@@ -104,8 +104,9 @@ namespace tut
 			U8 offset = 0)
 		{
 			numberMap[1] = &messageTemplate;
+			// the reader decodes in place, so the buffer has to outlive it
 			const U32 bufferSize = 1024;
-			U8 buffer[bufferSize];
+			static U8 buffer[bufferSize];
 			// zero out the packet ID field
 			memset(buffer, 0, LL_PACKET_ID_SIZE);
 			U32 builtSize = builder->buildMessage(buffer, bufferSize, offset);
@@ -966,5 +967,54 @@ namespace tut
 		ensure_equals("Ensure unchanged buffer ", strlen(outBuffer), 0);
 		delete reader;
 	}
-}
 
+	template<> template<>
+	void LLTemplateMessageBuilderTestObject::test<46>()
+		// reader reuses the template layout across messages
+	{
+		LLMessageTemplate messageTemplate = defaultTemplate();
+		messageTemplate.addBlock(createBlock(_PREHASH_Test0, MVT_U32, 4));
+		messageTemplate.addBlock(createBlock(_PREHASH_Test1, MVT_VARIABLE, 1));
+		numberMap[1] = &messageTemplate;
+		LLTemplateMessageReader* reader = 
+			new LLTemplateMessageReader(numberMap);
+
+		const U32 bufferSize = 1024;
+		U8 buffer[bufferSize];
+		for (U32 count = 1; count <= 3; ++count)
+		{
+			LLTemplateMessageBuilder* builder = defaultBuilder(messageTemplate);
+			for (U32 i = 0; i < count; ++i)
+			{
+				if (i)
+				{
+					builder->nextBlock(_PREHASH_Test0);
+				}
+				builder->addU32(_PREHASH_Test0, count * 10 + i);
+			}
+			builder->nextBlock(_PREHASH_Test1);
+			builder->addString(_PREHASH_Test0, "layout");
+			memset(buffer, 0, LL_PACKET_ID_SIZE);
+			U32 builtSize = builder->buildMessage(buffer, bufferSize, 0);
+			delete builder;
+
+			reader->validateMessage(buffer, builtSize, LLHost());
+			reader->readMessage(buffer, LLHost());
+			ensure_equals("Ensure block count", 
+						  reader->getNumberOfBlocks(_PREHASH_Test0), (S32)count);
+			for (U32 i = 0; i < count; ++i)
+			{
+				U32 outValue;
+				reader->getU32(_PREHASH_Test0, _PREHASH_Test0, outValue, i);
+				ensure_equals("Ensure repeated value", outValue, count * 10 + i);
+			}
+			std::string outString;
+			reader->getString(_PREHASH_Test1, _PREHASH_Test0, outString);
+			ensure_equals("Ensure string", outString, std::string("layout"));
+			ensure_equals("Ensure string size", 
+						  reader->getSize(_PREHASH_Test1, 0, _PREHASH_Test0), 7);
+			reader->clearMessage();
+		}
+		delete reader;
+	}
+}
@@ -0,0 +1,173 @@
+/** 
+ * @file lltemplatemessagereader_tut.cpp
+ * @date 2009-06
+ * @brief Tests and timings for index based template message reads.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "llapr.h"
+#include "llmessagetemplate.h"
+#include "lltemplatemessagebuilder.h"
+#include "lltemplatemessagereader.h"
+#include "lltimer.h"
+#include "llversionserver.h"
+#include "message.h"
+#include "message_prehash.h"
+
+namespace tut
+{
+	static LLTemplateMessageBuilder::message_template_name_map_t readerNameMap;
+	static LLTemplateMessageReader::message_template_number_map_t readerNumberMap;
+
+	struct LLTemplateMessageReaderTestData
+	{
+		enum { NUM_BLOCKS = 40, NUM_PASSES = 2000 };
+
+		LLMessageTemplate mTemplate;
+		U8 mBuffer[MAX_BUFFER_SIZE];
+		LLTemplateMessageReader* mReader;
+
+		LLTemplateMessageReaderTestData() :
+			mTemplate(_PREHASH_TestMessage, 1, MFT_HIGH),
+			mReader(NULL)
+		{
+			if (!gMessageSystem)
+			{
+				ll_init_apr();
+				start_messaging_system("notafile", 13035,
+									   LL_VERSION_MAJOR,
+									   LL_VERSION_MINOR,
+									   LL_VERSION_PATCH,
+									   FALSE,
+									   "notasharedsecret",
+									   NULL,
+									   false);
+			}
+
+			// shaped like ObjectUpdateCached, a variable block of U32s
+			LLMessageBlock* block = new LLMessageBlock(_PREHASH_Test0, MBT_VARIABLE);
+			block->addVariable(_PREHASH_Test0, MVT_U32, 4);
+			block->addVariable(_PREHASH_Test1, MVT_U32, 4);
+			block->addVariable(_PREHASH_Test2, MVT_U32, 4);
+			mTemplate.addBlock(block);
+			readerNameMap[_PREHASH_TestMessage] = &mTemplate;
+			readerNumberMap[1] = &mTemplate;
+
+			LLTemplateMessageBuilder builder(readerNameMap);
+			builder.newMessage(_PREHASH_TestMessage);
+			for (U32 i = 0; i < NUM_BLOCKS; ++i)
+			{
+				builder.nextBlock(_PREHASH_Test0);
+				builder.addU32(_PREHASH_Test0, i);
+				builder.addU32(_PREHASH_Test1, i * 2);
+				builder.addU32(_PREHASH_Test2, i * 3);
+			}
+			memset(mBuffer, 0, LL_PACKET_ID_SIZE);
+			U32 size = builder.buildMessage(mBuffer, MAX_BUFFER_SIZE, 0);
+
+			mReader = new LLTemplateMessageReader(readerNumberMap);
+			mReader->validateMessage(mBuffer, size, LLHost());
+			mReader->readMessage(mBuffer, LLHost());
+		}
+
+		~LLTemplateMessageReaderTestData()
+		{
+			delete mReader;
+		}
+	};
+
+	typedef test_group<LLTemplateMessageReaderTestData> LLTemplateMessageReaderTestGroup;
+	typedef LLTemplateMessageReaderTestGroup::object LLTemplateMessageReaderTestObject;
+	LLTemplateMessageReaderTestGroup templateMessageReaderTestGroup("LLTemplateMessageReader");
+
+	template<> template<>
+	void LLTemplateMessageReaderTestObject::test<1>()
+		// index reads match name reads
+	{
+		ensure_equals("Ensure block count", 
+					  mReader->getNumberOfBlocksIndex(0), 
+					  mReader->getNumberOfBlocks(_PREHASH_Test0));
+		for (S32 i = 0; i < NUM_BLOCKS; ++i)
+		{
+			U32 by_name, by_index;
+			mReader->getU32(_PREHASH_Test0, _PREHASH_Test2, by_name, i);
+			mReader->getDataIndex(0, 2, &by_index, sizeof(U32), i);
+			ensure_equals("Ensure same value", by_index, by_name);
+			ensure_equals("Ensure value", by_index, (U32)i * 3);
+			ensure_equals("Ensure size", mReader->getSizeIndex(0, 2, i), 4);
+		}
+	}
+
+	template<> template<>
+	void LLTemplateMessageReaderTestObject::test<2>()
+		// lookup cost of name reads against index reads
+	{
+		LLTimer timer;
+		U32 name_sum = 0;
+		char* vars[3] = { _PREHASH_Test0, _PREHASH_Test1, _PREHASH_Test2 };
+		for (S32 pass = 0; pass < NUM_PASSES; ++pass)
+		{
+			for (S32 i = 0; i < NUM_BLOCKS; ++i)
+			{
+				for (S32 v = 0; v < 3; ++v)
+				{
+					U32 value;
+					mReader->getU32(_PREHASH_Test0, vars[v], value, i);
+					name_sum += value;
+				}
+			}
+		}
+		F64 name_time = timer.getElapsedTimeF64();
+
+		timer.reset();
+		U32 index_sum = 0;
+		for (S32 pass = 0; pass < NUM_PASSES; ++pass)
+		{
+			for (S32 i = 0; i < NUM_BLOCKS; ++i)
+			{
+				for (S32 v = 0; v < 3; ++v)
+				{
+					U32 value;
+					mReader->getDataIndex(0, v, &value, sizeof(U32), i);
+					index_sum += value;
+				}
+			}
+		}
+		F64 index_time = timer.getElapsedTimeF64();
+
+		const S32 reads = NUM_PASSES * NUM_BLOCKS * 3;
+		llinfos << "Template reads by name: " << name_time * 1.0e9 / reads 
+				<< " ns, by index: " << index_time * 1.0e9 / reads 
+				<< " ns (" << reads << " reads)" << llendl;
+		ensure_equals("Ensure same sums", index_sum, name_sum);
+	}
+}
@@ -0,0 +1,296 @@
+/** 
+ * @file llvfs_tut.cpp
+ * @date 2009-07
+ * @brief Tests for concurrent LLVFS reads and writes, and compaction.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "lldir.h"
+#include "llfile.h"
+#include "llthread.h"
+#include "lltimer.h"
+#include "llvfs.h"
+
+namespace
+{
+	const S32 FILE_COUNT = 256;
+	const S32 FILE_SIZE = 16 * 1024;
+	const S32 READS_PER_THREAD = 4000;
+
+	void fill_file(U8* buffer, S32 index)
+	{
+		for (S32 i = 0; i < FILE_SIZE; i++)
+		{
+			buffer[i] = (U8)(index * 31 + i * 7 + (i >> 8));
+		}
+	}
+
+	// Reads (or rewrites) random files and counts reads that came back
+	// with someone else's bytes
+	class LLVFSTestThread : public LLThread
+	{
+	public:
+		LLVFSTestThread(LLVFS* vfs, const std::vector<LLUUID>& ids, U32 seed, bool writer)
+			: LLThread("vfs test"), mVFS(vfs), mIDs(ids), mSeed(seed), mWriter(writer), mBadReads(0), mDone(false) {}
+
+		/*virtual*/ void run()
+		{
+			std::vector<U8> buffer(FILE_SIZE);
+			std::vector<U8> expected(FILE_SIZE);
+			U32 seed = mSeed;
+			for (S32 i = 0; i < READS_PER_THREAD; i++)
+			{
+				seed = seed * 1664525 + 1013904223;
+				S32 index = (seed >> 8) % FILE_COUNT;
+				fill_file(&expected[0], index);
+				if (mWriter)
+				{
+					// same bytes the file already holds, so readers can check
+					mVFS->storeData(mIDs[index], LLAssetType::AT_TEXTURE, &expected[0], 0, FILE_SIZE);
+				}
+				else if (mVFS->getData(mIDs[index], LLAssetType::AT_TEXTURE, &buffer[0], 0, FILE_SIZE) != FILE_SIZE
+						 || memcmp(&buffer[0], &expected[0], FILE_SIZE))
+				{
+					mBadReads++;
+				}
+			}
+			mDone = true;
+		}
+
+		LLVFS* mVFS;
+		const std::vector<LLUUID>& mIDs;
+		U32 mSeed;
+		bool mWriter;
+		S32 mBadReads;
+		volatile bool mDone;
+	};
+}
+
+namespace tut
+{
+	struct llvfs_data
+	{
+		llvfs_data()
+		{
+			mIndexFilename = gDirUtilp->getTempFilename();
+			mDataFilename = gDirUtilp->getTempFilename();
+			mVFS = new LLVFS(mIndexFilename, mDataFilename, FALSE, 16 * 1024 * 1024, FALSE);
+			std::vector<U8> buffer(FILE_SIZE);
+			for (S32 i = 0; i < FILE_COUNT; i++)
+			{
+				LLUUID id;
+				id.generate();
+				mIDs.push_back(id);
+				mVFS->setMaxSize(id, LLAssetType::AT_TEXTURE, FILE_SIZE);
+				fill_file(&buffer[0], i);
+				mVFS->storeData(id, LLAssetType::AT_TEXTURE, &buffer[0], 0, FILE_SIZE);
+			}
+		}
+		~llvfs_data()
+		{
+			delete mVFS;
+			LLFile::remove(mIndexFilename);
+			LLFile::remove(mDataFilename);
+		}
+
+		// Runs readers (and a writer) to completion, returns the bad reads
+		S32 runThreads(S32 readers, bool writer, F64& seconds)
+		{
+			std::vector<LLVFSTestThread*> threads;
+			for (S32 i = 0; i < readers; i++)
+			{
+				threads.push_back(new LLVFSTestThread(mVFS, mIDs, i + 1, false));
+			}
+			if (writer)
+			{
+				threads.push_back(new LLVFSTestThread(mVFS, mIDs, 99, true));
+			}
+			LLTimer timer;
+			for (U32 i = 0; i < threads.size(); i++)
+			{
+				threads[i]->start();
+			}
+			S32 bad_reads = 0;
+			for (U32 i = 0; i < threads.size(); i++)
+			{
+				while (!threads[i]->mDone || !threads[i]->isStopped())
+				{
+					ms_sleep(1);
+				}
+				bad_reads += threads[i]->mBadReads;
+				delete threads[i];
+			}
+			seconds = timer.getElapsedTimeF64();
+			return bad_reads;
+		}
+
+		std::string mIndexFilename;
+		std::string mDataFilename;
+		LLVFS* mVFS;
+		std::vector<LLUUID> mIDs;
+	};
+	typedef test_group<llvfs_data> llvfs_test;
+	typedef llvfs_test::object llvfs_object;
+	tut::llvfs_test llvfs_testcase("llvfs");
+
+	template<> template<>
+	void llvfs_object::test<1>()
+		// concurrent readers each see their own file's bytes
+	{
+		ensure("valid", mVFS->isValid());
+		for (S32 readers = 1; readers <= 8; readers *= 2)
+		{
+			F64 seconds = 0.0;
+			S32 bad_reads = runThreads(readers, false, seconds);
+			llinfos << readers << " VFS readers: " << readers * READS_PER_THREAD * (F64)FILE_SIZE / seconds / (1024.0 * 1024.0)
+					<< " MB/s" << llendl;
+			ensure_equals("bad reads", bad_reads, 0);
+		}
+	}
+
+	template<> template<>
+	void llvfs_object::test<2>()
+		// readers are unaffected by a writer storing into the same files
+	{
+		F64 seconds = 0.0;
+		S32 bad_reads = runThreads(4, true, seconds);
+		llinfos << "4 VFS readers and a writer: " << 5 * READS_PER_THREAD * (F64)FILE_SIZE / seconds / (1024.0 * 1024.0)
+				<< " MB/s" << llendl;
+		ensure_equals("bad reads", bad_reads, 0);
+	}
+
+	template<> template<>
+	void llvfs_object::test<3>()
+		// compaction coalesces the holes left by removed files and keeps
+		// the remaining files intact
+	{
+		for (S32 i = 0; i < FILE_COUNT; i += 2)
+		{
+			mVFS->removeFile(mIDs[i], LLAssetType::AT_TEXTURE);
+		}
+		ensure("fragmented", mVFS->getFragmentation() > 0.f);
+
+		mVFS->startCompacting();
+		S32 slices = 0;
+		while (!mVFS->compact(0.002f))
+		{
+			slices++;
+		}
+		llinfos << "VFS compacted in " << slices + 1 << " slices" << llendl;
+		ensure_equals("fragmentation", mVFS->getFragmentation(), 0.f);
+		ensure("done", !mVFS->isCompacting());
+
+		std::vector<U8> buffer(FILE_SIZE);
+		std::vector<U8> expected(FILE_SIZE);
+		for (S32 i = 1; i < FILE_COUNT; i += 2)
+		{
+			fill_file(&expected[0], i);
+			ensure_equals("size", mVFS->getData(mIDs[i], LLAssetType::AT_TEXTURE, &buffer[0], 0, FILE_SIZE), FILE_SIZE);
+			ensure("data", !memcmp(&buffer[0], &expected[0], FILE_SIZE));
+		}
+	}
+
+	template<> template<>
+	void llvfs_object::test<4>()
+		// files moved by growing, removing and compacting stay findable by
+		// location, and compaction leaves files too big to move in one go
+	{
+		for (S32 i = 0; i < FILE_COUNT; i += 4)
+		{
+			mVFS->removeFile(mIDs[i], LLAssetType::AT_TEXTURE);
+		}
+		for (S32 i = 1; i < FILE_COUNT; i += 4)
+		{
+			// the next file is in the way, so these move to the end
+			ensure("grow", mVFS->setMaxSize(mIDs[i], LLAssetType::AT_TEXTURE, 2 * FILE_SIZE));
+		}
+
+		const S32 big_size = 1024 * 1024;
+		std::vector<U8> big(big_size);
+		for (S32 i = 0; i < big_size; i++)
+		{
+			big[i] = (U8)(i * 13 + (i >> 12));
+		}
+		LLUUID big_id;
+		big_id.generate();
+		mVFS->setMaxSize(big_id, LLAssetType::AT_TEXTURE, big_size);
+		ensure_equals("big store", mVFS->storeData(big_id, LLAssetType::AT_TEXTURE, &big[0], 0, big_size), big_size);
+
+		mVFS->startCompacting();
+		S32 slices = 0;
+		F32 longest = 0.f;
+		LLTimer timer;
+		BOOL done = FALSE;
+		while (!done)
+		{
+			timer.reset();
+			done = mVFS->compact(0.002f);
+			longest = llmax(longest, timer.getElapsedTimeF32());
+			slices++;
+		}
+		llinfos << "VFS compacted in " << slices << " slices, longest " << longest * 1000.f << " ms" << llendl;
+		ensure("big file stays", mVFS->getFragmentation() > 0.f);
+
+		std::vector<U8> buffer(big_size);
+		std::vector<U8> expected(FILE_SIZE);
+		for (S32 i = 0; i < FILE_COUNT; i++)
+		{
+			if (i % 4 == 0)
+			{
+				ensure("removed", !mVFS->getExists(mIDs[i], LLAssetType::AT_TEXTURE));
+				continue;
+			}
+			fill_file(&expected[0], i);
+			ensure_equals("size", mVFS->getData(mIDs[i], LLAssetType::AT_TEXTURE, &buffer[0], 0, FILE_SIZE), FILE_SIZE);
+			ensure("data", !memcmp(&buffer[0], &expected[0], FILE_SIZE));
+		}
+		ensure_equals("big size", mVFS->getData(big_id, LLAssetType::AT_TEXTURE, &buffer[0], 0, big_size), big_size);
+		ensure("big data", !memcmp(&buffer[0], &big[0], big_size));
+
+		// without it in the way, the next pass closes every hole
+		mVFS->removeFile(big_id, LLAssetType::AT_TEXTURE);
+		mVFS->startCompacting();
+		while (!mVFS->compact(0.002f))
+		{
+		}
+		ensure_equals("fragmentation", mVFS->getFragmentation(), 0.f);
+		for (S32 i = 1; i < FILE_COUNT; i++)
+		{
+			if (i % 4 == 0)
+			{
+				continue;
+			}
+			fill_file(&expected[0], i);
+			ensure_equals("size after", mVFS->getData(mIDs[i], LLAssetType::AT_TEXTURE, &buffer[0], 0, FILE_SIZE), FILE_SIZE);
+			ensure("data after", !memcmp(&buffer[0], &expected[0], FILE_SIZE));
+		}
+	}
+}
@@ -0,0 +1,508 @@
+/** 
+ * @file llvolume_tut.cpp
+ * @date 2009-07
+ * @brief Tests and timings for LLVolumeFace's packed vertex transforms and picking.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include "llvolume.h"
+#include "llquaternion.h"
+#include "lltimer.h"
+#include "m3math.h"
+#include "m4math.h"
+
+namespace tut
+{
+	// Vertex buffer layout with a guard float after each attribute, to
+	// catch transforms that store more than they should.
+	struct llvolume_vertex
+	{
+		LLVector3 mPosition;
+		F32 mPositionGuard;
+		LLVector3 mNormal;
+		F32 mNormalGuard;
+		LLVector2 mTexCoord;
+		F32 mTexCoordGuard[2];
+	};
+
+	const F32 GUARD = 12345.f;
+
+	struct llvolume_data
+	{
+		llvolume_data() : mSeed(1)
+		{
+			// an instance rotated, unevenly scaled and moved away from the
+			// origin, like a typical prim
+			LLQuaternion rot(0.7f, LLVector3(0.3f, -0.5f, 0.8f));
+			mMatVert.initAll(LLVector3(2.f, 0.5f, 7.f), rot, LLVector3(128.f, 96.f, 30.f));
+			mMatNormal = mMatVert.getMat3();
+
+			mCosAng = cosf(0.6f);
+			mSinAng = sinf(0.6f);
+			mOffS = 0.25f;
+			mOffT = -0.1f;
+			mMagS = 3.f;
+			mMagT = 0.75f;
+		}
+
+		LLVolume* makeVolume(U8 profile, U8 path, F32 hollow, F32 detail)
+		{
+			LLVolumeParams params;
+			params.setType(profile, path);
+			params.setHollow(hollow);
+			return new LLVolume(params, detail, FALSE, FALSE);
+		}
+
+		// the shapes most objects are made of, at the highest detail
+		void makeVolumes()
+		{
+			mVolumes.push_back(makeVolume(LL_PCODE_PROFILE_SQUARE, LL_PCODE_PATH_LINE, 0.f, 4.f));
+			mVolumes.push_back(makeVolume(LL_PCODE_PROFILE_CIRCLE, LL_PCODE_PATH_LINE, 0.5f, 4.f));
+			mVolumes.push_back(makeVolume(LL_PCODE_PROFILE_CIRCLE_HALF, LL_PCODE_PATH_CIRCLE, 0.f, 4.f));
+			mVolumes.push_back(makeVolume(LL_PCODE_PROFILE_CIRCLE, LL_PCODE_PATH_CIRCLE, 0.f, 4.f));
+		}
+
+		F32 frand(F32 min, F32 max)
+		{
+			mSeed = mSeed * 1103515245 + 12345;
+			return min + (max - min) * (F32) ((mSeed >> 8) & 0xffff) / 65535.f;
+		}
+
+		// Segments from outside a face's extents to the far side of it:
+		// most aimed at random points in the extents, the rest aimed exactly
+		// at vertices, where several triangles are hit at the same t.
+		void makeSegments(const LLVolumeFace& vf, U32 count)
+		{
+			LLVector3 center = (vf.mExtents[0] + vf.mExtents[1]) * 0.5f;
+			F32 radius = (vf.mExtents[1] - vf.mExtents[0]).magVec() + 1.f;
+			mStarts.resize(count);
+			mDirs.resize(count);
+			for (U32 i = 0; i < count; i++)
+			{
+				LLVector3 from(frand(-1.f, 1.f), frand(-1.f, 1.f), frand(-1.f, 1.f));
+				from.normVec();
+				mStarts[i] = center + from * radius;
+
+				LLVector3 target;
+				if (i % 4 == 0)
+				{
+					target = vf.mVertices[i % vf.mVertices.size()].mPosition;
+				}
+				else
+				{
+					for (S32 j = 0; j < 3; j++)
+					{
+						target.mV[j] = frand(vf.mExtents[0].mV[j] - 0.1f, vf.mExtents[1].mV[j] + 0.1f);
+					}
+				}
+				mDirs[i] = (target - mStarts[i]) * 2.f;
+			}
+		}
+
+		static BOOL closeEnough(F32 a, F32 b, F32 tolerance)
+		{
+			return fabsf(a - b) <= tolerance * llmax(1.f, fabsf(a), fabsf(b));
+		}
+
+		// xform() from llface.cpp, which the unpacked path uses
+		void xform(LLVector2& tc) const
+		{
+			F32 s = tc.mV[0] - 0.5f;
+			F32 t = tc.mV[1] - 0.5f;
+			F32 temp = s;
+			s = s * mCosAng + t * mSinAng;
+			t = -temp * mSinAng + t * mCosAng;
+			s *= mMagS;
+			t *= mMagT;
+			tc.mV[0] = s + (mOffS + 0.5f);
+			tc.mV[1] = t + (mOffT + 0.5f);
+		}
+
+		// Runs the scalar or the SSE2 transforms over a face into a
+		// guarded vertex buffer.
+		void transform(const LLVolumeFace& vf, S32 count, BOOL sse2, std::vector<llvolume_vertex>& out)
+		{
+			llvolume_vertex guarded;
+			guarded.mPositionGuard = GUARD;
+			guarded.mNormalGuard = GUARD;
+			guarded.mTexCoordGuard[0] = guarded.mTexCoordGuard[1] = GUARD;
+			out.assign(count + 1, guarded);
+
+			LLStrider<LLVector3> positions;
+			LLStrider<LLVector3> normals;
+			LLStrider<LLVector2> tex_coords;
+			positions = &out[0].mPosition;
+			normals = &out[0].mNormal;
+			tex_coords = &out[0].mTexCoord;
+			positions.setStride(sizeof(llvolume_vertex));
+			normals.setStride(sizeof(llvolume_vertex));
+			tex_coords.setStride(sizeof(llvolume_vertex));
+
+			if (sse2)
+			{
+				LLVolumeFace::transformPositionsSSE2(&vf.mPackedPositions[0], count, mMatVert, positions);
+				LLVolumeFace::transformNormalsSSE2(&vf.mPackedNormals[0], count, mMatNormal, normals);
+				LLVolumeFace::transformTexCoordsSSE2(&vf.mPackedTexCoords[0], count, mCosAng, mSinAng,
+													 mOffS, mOffT, mMagS, mMagT, tex_coords);
+			}
+			else
+			{
+				LLVolumeFace::transformPositions(&vf.mPackedPositions[0], count, mMatVert, positions);
+				LLVolumeFace::transformNormals(&vf.mPackedNormals[0], count, mMatNormal, normals);
+				LLVolumeFace::transformTexCoords(&vf.mPackedTexCoords[0], count, mCosAng, mSinAng,
+												 mOffS, mOffT, mMagS, mMagT, tex_coords);
+			}
+
+			for (S32 i = 0; i < count; i++)
+			{
+				ensure_equals("position guard", out[i].mPositionGuard, GUARD);
+				ensure_equals("normal guard", out[i].mNormalGuard, GUARD);
+				ensure_equals("texcoord guard", out[i].mTexCoordGuard[0], GUARD);
+			}
+			ensure("wrote past the end", out[count].mPosition.isExactlyZero() &&
+										 out[count].mNormal.isExactlyZero() &&
+										 out[count].mTexCoord.isExactlyZero());
+		}
+
+		// Compares the first count vertices of a face, transformed one
+		// LLVolumeFace::VertexData at a time, with out.
+		void ensureAgreement(const char* msg, const LLVolumeFace& vf, S32 count,
+							 const std::vector<llvolume_vertex>& out, F32 tolerance)
+		{
+			for (S32 i = 0; i < count; i++)
+			{
+				const LLVolumeFace::VertexData& v = vf.mVertices[i];
+				LLVector3 position = v.mPosition * mMatVert;
+				LLVector3 normal = v.mNormal * mMatNormal;
+				normal.normVec();
+				LLVector2 tc = v.mTexCoord;
+				xform(tc);
+
+				for (S32 j = 0; j < 3; j++)
+				{
+					ensure(msg, closeEnough(out[i].mPosition.mV[j], position.mV[j], tolerance));
+					ensure(msg, closeEnough(out[i].mNormal.mV[j], normal.mV[j], tolerance));
+				}
+				for (S32 j = 0; j < 2; j++)
+				{
+					ensure(msg, closeEnough(out[i].mTexCoord.mV[j], tc.mV[j], tolerance));
+				}
+			}
+		}
+
+		~llvolume_data()
+		{
+			for (U32 i = 0; i < mVolumes.size(); i++)
+			{
+				mVolumes[i] = NULL;
+			}
+		}
+
+		std::vector<LLPointer<LLVolume> > mVolumes;
+		U32 mSeed;
+		std::vector<LLVector3> mStarts;
+		std::vector<LLVector3> mDirs;
+		LLMatrix4 mMatVert;
+		LLMatrix3 mMatNormal;
+		F32 mCosAng;
+		F32 mSinAng;
+		F32 mOffS;
+		F32 mOffT;
+		F32 mMagS;
+		F32 mMagT;
+	};
+	typedef test_group<llvolume_data> llvolume_test;
+	typedef llvolume_test::object llvolume_object;
+	tut::llvolume_test llvolume_testcase("llvolume");
+
+	template<> template<>
+	void llvolume_object::test<1>()
+		// shared volumes keep packed copies of their vertices, unique ones don't
+	{
+		makeVolumes();
+		for (U32 i = 0; i < mVolumes.size(); i++)
+		{
+			for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+			{
+				const LLVolumeFace& vf = mVolumes[i]->getVolumeFace(f);
+				ensure("packed", vf.hasPackedVertices());
+				for (U32 j = 0; j < vf.mVertices.size(); j++)
+				{
+					ensure_equals("position", LLVector3(vf.mPackedPositions[j].mV), vf.mVertices[j].mPosition);
+					ensure_equals("position w", vf.mPackedPositions[j].mV[VW], 1.f);
+					ensure_equals("normal", LLVector3(vf.mPackedNormals[j].mV), vf.mVertices[j].mNormal);
+					ensure_equals("normal w", vf.mPackedNormals[j].mV[VW], 0.f);
+					ensure_equals("texcoord", vf.mPackedTexCoords[j], vf.mVertices[j].mTexCoord);
+				}
+			}
+		}
+
+		LLPointer<LLVolume> unique = new LLVolume(LLVolumeParams(), 4.f, FALSE, TRUE);
+		ensure("unique", !unique->getVolumeFace(0).hasPackedVertices());
+	}
+
+	template<> template<>
+	void llvolume_object::test<2>()
+		// the scalar transforms do the same arithmetic as the per vertex path
+	{
+		makeVolumes();
+		std::vector<llvolume_vertex> out;
+		for (U32 i = 0; i < mVolumes.size(); i++)
+		{
+			for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+			{
+				const LLVolumeFace& vf = mVolumes[i]->getVolumeFace(f);
+				S32 count = (S32)vf.mVertices.size();
+				transform(vf, count, FALSE, out);
+				ensureAgreement("scalar", vf, count, out, 0.f);
+			}
+		}
+	}
+
+	template<> template<>
+	void llvolume_object::test<3>()
+		// the SSE2 transforms agree with the scalar ones
+	{
+		// Positions and normals are summed in a different order, and texture
+		// coordinates go through the rotation, scale and offset folded into
+		// one affine map, so the results are not bit for bit the same.  A
+		// few units in the last place is all the difference there should be;
+		// 1.e-6 is about eight.
+		const F32 TOLERANCE = 1.e-6f;
+
+		makeVolumes();
+		std::vector<llvolume_vertex> out;
+		for (U32 i = 0; i < mVolumes.size(); i++)
+		{
+			for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+			{
+				const LLVolumeFace& vf = mVolumes[i]->getVolumeFace(f);
+				S32 count = (S32)vf.mVertices.size();
+				transform(vf, count, TRUE, out);
+				ensureAgreement("sse2", vf, count, out, TOLERANCE);
+
+				// odd counts leave one texture coordinate for the scalar tail
+				for (S32 short_count = 1; short_count < 6 && short_count < count; short_count++)
+				{
+					transform(vf, short_count, TRUE, out);
+					ensureAgreement("sse2 short", vf, short_count, out, TOLERANCE);
+				}
+			}
+		}
+	}
+
+	template<> template<>
+	void llvolume_object::test<4>()
+		// per vertex against packed scalar against packed SSE2 timings
+	{
+		const S32 PASSES = 1000;
+		makeVolumes();
+
+		S32 num_vertices = 0;
+		S32 max_vertices = 0;
+		for (U32 i = 0; i < mVolumes.size(); i++)
+		{
+			for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+			{
+				S32 count = (S32)mVolumes[i]->getVolumeFace(f).mVertices.size();
+				num_vertices += count;
+				max_vertices = llmax(max_vertices, count);
+			}
+		}
+		std::vector<llvolume_vertex> out(max_vertices);
+
+		// what LLFace::getGeometryVolume() does without packed arrays
+		LLTimer timer;
+		for (S32 pass = 0; pass < PASSES; pass++)
+		{
+			for (U32 i = 0; i < mVolumes.size(); i++)
+			{
+				for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+				{
+					const LLVolumeFace& vf = mVolumes[i]->getVolumeFace(f);
+					for (U32 j = 0; j < vf.mVertices.size(); j++)
+					{
+						const LLVolumeFace::VertexData& v = vf.mVertices[j];
+						out[j].mPosition = v.mPosition * mMatVert;
+						out[j].mNormal = v.mNormal * mMatNormal;
+						out[j].mNormal.normVec();
+						out[j].mTexCoord = v.mTexCoord;
+						xform(out[j].mTexCoord);
+					}
+				}
+			}
+		}
+		F64 vertex_time = timer.getElapsedTimeF64() / PASSES;
+		LLVector3 last_position = out[0].mPosition;
+
+		F64 packed_time[2];
+		for (S32 sse2 = 0; sse2 < 2; sse2++)
+		{
+			timer.reset();
+			for (S32 pass = 0; pass < PASSES; pass++)
+			{
+				for (U32 i = 0; i < mVolumes.size(); i++)
+				{
+					for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+					{
+						const LLVolumeFace& vf = mVolumes[i]->getVolumeFace(f);
+						S32 count = (S32)vf.mVertices.size();
+						LLStrider<LLVector3> positions;
+						LLStrider<LLVector3> normals;
+						LLStrider<LLVector2> tex_coords;
+						positions = &out[0].mPosition;
+						normals = &out[0].mNormal;
+						tex_coords = &out[0].mTexCoord;
+						positions.setStride(sizeof(llvolume_vertex));
+						normals.setStride(sizeof(llvolume_vertex));
+						tex_coords.setStride(sizeof(llvolume_vertex));
+						if (sse2)
+						{
+							LLVolumeFace::transformPositionsSSE2(&vf.mPackedPositions[0], count, mMatVert, positions);
+							LLVolumeFace::transformNormalsSSE2(&vf.mPackedNormals[0], count, mMatNormal, normals);
+							LLVolumeFace::transformTexCoordsSSE2(&vf.mPackedTexCoords[0], count, mCosAng, mSinAng,
+																 mOffS, mOffT, mMagS, mMagT, tex_coords);
+						}
+						else
+						{
+							LLVolumeFace::transformPositions(&vf.mPackedPositions[0], count, mMatVert, positions);
+							LLVolumeFace::transformNormals(&vf.mPackedNormals[0], count, mMatNormal, normals);
+							LLVolumeFace::transformTexCoords(&vf.mPackedTexCoords[0], count, mCosAng, mSinAng,
+															 mOffS, mOffT, mMagS, mMagT, tex_coords);
+						}
+					}
+				}
+			}
+			packed_time[sse2] = timer.getElapsedTimeF64() / PASSES;
+			ensure("same last vertex", closeEnough(out[0].mPosition.mV[VX], last_position.mV[VX], 1.e-5f));
+		}
+
+		llinfos << num_vertices << " vertex transform: per vertex " << vertex_time * 1000.0
+				<< " ms, packed " << packed_time[0] * 1000.0
+				<< " ms, packed SSE2 " << packed_time[1] * 1000.0 << " ms" << llendl;
+	}
+
+	template<> template<>
+	void llvolume_object::test<5>()
+		// picking through the hierarchy finds the same triangle as testing every one
+	{
+		makeVolumes();
+		// a low detail box, whose faces are too small to be given a hierarchy
+		mVolumes.push_back(makeVolume(LL_PCODE_PROFILE_SQUARE, LL_PCODE_PATH_LINE, 0.f, 1.f));
+
+		const U32 NUM_SEGMENTS = 2000;
+		S32 small_faces = 0;
+		S32 hits = 0;
+		for (U32 i = 0; i < mVolumes.size(); i++)
+		{
+			for (S32 f = 0; f < mVolumes[i]->getNumVolumeFaces(); f++)
+			{
+				// picking needs a face it can build the hierarchy in
+				LLVolumeFace vf = mVolumes[i]->getVolumeFace(f);
+				if (vf.mIndices.size() < 32 * 3)
+				{
+					small_faces++;
+				}
+				makeSegments(vf, NUM_SEGMENTS);
+
+				for (U32 j = 0; j < NUM_SEGMENTS; j++)
+				{
+					F32 loop_t = 2.f;
+					F32 loop_a = 0.f;
+					F32 loop_b = 0.f;
+					S32 loop_tri = vf.lineSegmentIntersect(mStarts[j], mDirs[j], FALSE, loop_t, loop_a, loop_b);
+
+					F32 bvh_t = 2.f;
+					F32 bvh_a = 0.f;
+					F32 bvh_b = 0.f;
+					S32 bvh_tri = vf.lineSegmentIntersect(mStarts[j], mDirs[j], TRUE, bvh_t, bvh_a, bvh_b);
+					ensure("hierarchy built", vf.hasBVH());
+
+					ensure_equals("triangle", bvh_tri, loop_tri);
+					ensure_equals("closest_t", bvh_t, loop_t);
+					ensure_equals("a", bvh_a, loop_a);
+					ensure_equals("b", bvh_b, loop_b);
+
+					if (loop_tri >= 0)
+					{
+						hits++;
+
+						// nothing is hit nearer than a closer hit found earlier
+						F32 nearer_t = loop_t * 0.5f;
+						ensure_equals("nearer loop", vf.lineSegmentIntersect(mStarts[j], mDirs[j], FALSE, nearer_t, loop_a, loop_b), -1);
+						ensure_equals("nearer bvh", vf.lineSegmentIntersect(mStarts[j], mDirs[j], TRUE, nearer_t, bvh_a, bvh_b), -1);
+						ensure_equals("nearer t", nearer_t, loop_t * 0.5f);
+					}
+				}
+			}
+		}
+		ensure("some faces below the hierarchy threshold", small_faces > 0);
+		ensure("segments hit", hits > 0);
+	}
+
+	template<> template<>
+	void llvolume_object::test<6>()
+		// picking every triangle against picking through the hierarchy timings
+	{
+		LLPointer<LLVolume> sphere = makeVolume(LL_PCODE_PROFILE_CIRCLE_HALF, LL_PCODE_PATH_CIRCLE, 0.f, 4.f);
+		LLVolumeFace vf = sphere->getVolumeFace(0);
+		const U32 NUM_SEGMENTS = 2000;
+		makeSegments(vf, NUM_SEGMENTS);
+
+		S32 hits = 0;
+		F32 t, a, b;
+		LLTimer timer;
+		for (U32 i = 0; i < NUM_SEGMENTS; i++)
+		{
+			t = 2.f;
+			hits += vf.lineSegmentIntersect(mStarts[i], mDirs[i], FALSE, t, a, b) >= 0 ? 1 : 0;
+		}
+		F64 loop_time = timer.getElapsedTimeF64();
+
+		timer.reset();
+		vf.createBVH();
+		F64 build_time = timer.getElapsedTimeF64();
+
+		timer.reset();
+		for (U32 i = 0; i < NUM_SEGMENTS; i++)
+		{
+			t = 2.f;
+			hits -= vf.lineSegmentIntersect(mStarts[i], mDirs[i], TRUE, t, a, b) >= 0 ? 1 : 0;
+		}
+		F64 bvh_time = timer.getElapsedTimeF64();
+
+		llinfos << NUM_SEGMENTS << " picks on " << vf.mIndices.size() / 3 << " triangles: every triangle "
+				<< loop_time * 1000.0 << " ms, hierarchy " << bvh_time * 1000.0
+				<< " ms after " << build_time * 1000.0 << " ms to build" << llendl;
+		ensure_equals("same hits", hits, 0);
+	}
+}
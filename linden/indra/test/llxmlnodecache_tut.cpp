@@ -0,0 +1,141 @@
+/** 
+ * @file llxmlnodecache_tut.cpp
+ * @date 2009-07
+ * @brief Tests for the compiled XML node cache.
+ *
+ * $LicenseInfo:firstyear=2009&license=viewergpl$
+ * 
+ * Copyright (c) 2009, Linden Research, Inc.
+ * 
+ * Second Life Viewer Source Code
+ * The source code in this file ("Source Code") is provided by Linden Lab
+ * to you under the terms of the GNU General Public License, version 2.0
+ * ("GPL"), unless you have obtained a separate licensing agreement
+ * ("Other License"), formally executed by you and Linden Lab.  Terms of
+ * the GPL can be found in doc/GPL-license.txt in this distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/gplv2
+ * 
+ * There are special exceptions to the terms and conditions of the GPL as
+ * it is applied to this Source Code. View the full text of the exception
+ * in the file doc/FLOSS-exception.txt in this software distribution, or
+ * online at http://secondlifegrid.net/programs/open_source/licensing/flossexception
+ * 
+ * By copying, modifying or distributing this software, you acknowledge
+ * that you have read and understood your obligations described above,
+ * and agree to abide by those obligations.
+ * 
+ * ALL LINDEN LAB SOURCE CODE IS PROVIDED "AS IS." LINDEN LAB MAKES NO
+ * WARRANTIES, EXPRESS, IMPLIED OR OTHERWISE, REGARDING ITS ACCURACY,
+ * COMPLETENESS OR PERFORMANCE.
+ * $/LicenseInfo$
+ */
+#include <tut/tut.h>
+#include "linden_common.h"
+#include "lltut.h"
+
+#include <sstream>
+
+#include "lldir.h"
+#include "llfile.h"
+#include "llxmlnodecache.h"
+
+namespace tut
+{
+	struct llxmlnodecache_data
+	{
+		llxmlnodecache_data()
+		{
+			mFilename = gDirUtilp->getTempFilename();
+		}
+		~llxmlnodecache_data()
+		{
+			LLFile::remove(mFilename);
+			LLXMLNodeCache::clear();
+		}
+
+		void writeFile(const std::string& contents)
+		{
+			LLFILE* fp = LLFile::fopen(mFilename, "wb");
+			ensure("opened", fp != NULL);
+			fwrite(contents.c_str(), 1, contents.size(), fp);
+			fclose(fp);
+		}
+
+		static std::string toString(LLXMLNodePtr node)
+		{
+			std::ostringstream str;
+			node->writeToOstream(str);
+			return str.str();
+		}
+
+		std::string mFilename;
+	};
+	typedef test_group<llxmlnodecache_data> llxmlnodecache_test;
+	typedef llxmlnodecache_test::object llxmlnodecache_object;
+	tut::llxmlnodecache_test llxmlnodecache_testcase("llxmlnodecache");
+
+	template<> template<>
+	void llxmlnodecache_object::test<1>()
+		// trees rebuilt from the cache match the parser's
+	{
+		writeFile("<?xml version=\"1.0\" encoding=\"utf-8\" standalone=\"yes\" ?>\n"
+				  "<floater name=\"test\" title=\"Test &amp; more\" width=\"200\" version=\"1.2\">\n"
+				  "\t<button name=\"ok\" label=\"OK\" />\n"
+				  "\t<text name=\"note\" type=\"string\" length=\"1\">Some text</text>\n"
+				  "\t<button name=\"cancel\" label=\"Cancel\" />\n"
+				  "\t<panel name=\"empty\"/>\n"
+				  "</floater>\n");
+
+		LLXMLNodePtr parsed;
+		ensure("parsed", LLXMLNode::parseFile(mFilename, parsed, NULL));
+		LLXMLNodePtr first;
+		ensure("first", LLXMLNodeCache::parseFile(mFilename, first, NULL));
+		LLXMLNodePtr cached;
+		ensure("cached", LLXMLNodeCache::parseFile(mFilename, cached, NULL));
+
+		ensure("fresh tree", cached != first);
+		ensure_equals("contents", toString(cached), toString(parsed));
+		ensure_equals("children", cached->getChildCount(), parsed->getChildCount());
+		ensure_equals("version", cached->mVersionMinor, (U32)2);
+
+		LLXMLNodePtr child = cached->getFirstChild();
+		ensure("first child", child->hasName("button"));
+		child = child->getNextSibling();
+		ensure_equals("value", child->getValue(), std::string("Some text"));
+		ensure_equals("type", child->getType(), parsed->getFirstChild()->getNextSibling()->getType());
+		ensure_equals("last child type", cached->getFirstChild()->getNextSibling()->getNextSibling()->getNextSibling()->getType(),
+					  LLXMLNode::TYPE_CONTAINER);
+
+		std::string title;
+		ensure("attribute", cached->getAttributeString("title", title));
+		ensure_equals("title", title, std::string("Test & more"));
+	}
+
+	template<> template<>
+	void llxmlnodecache_object::test<2>()
+		// a changed file is parsed again
+	{
+		writeFile("<panel name=\"before\" />");
+		LLXMLNodePtr node;
+		ensure("first", LLXMLNodeCache::parseFile(mFilename, node, NULL));
+
+		writeFile("<panel name=\"after the change\" />");
+		ensure("second", LLXMLNodeCache::parseFile(mFilename, node, NULL));
+		std::string name;
+		node->getAttributeString("name", name);
+		ensure_equals("name", name, std::string("after the change"));
+	}
+
+	template<> template<>
+	void llxmlnodecache_object::test<3>()
+		// missing and broken files fail the way LLXMLNode::parseFile() does
+	{
+		LLXMLNodePtr node;
+		ensure("missing", !LLXMLNodeCache::parseFile(mFilename + "missing", node, NULL));
+		ensure("null node", node->isNull());
+
+		writeFile("not xml");
+		ensure("broken", !LLXMLNodeCache::parseFile(mFilename, node, NULL));
+		ensure("broken again", !LLXMLNodeCache::parseFile(mFilename, node, NULL));
+	}
+}
@@ -38,6 +38,7 @@
 #include "llmessageconfig.h"
 #include "llsdserialize.h"
 #include "llversionserver.h"
+#include "llpacketwindow.h"
 #include "message.h"
 #include "message_prehash.h"
 
@@ -142,5 +143,103 @@ namespace tut
 		gMessageSystem->dispatch(name, message, response);
 		ensure_equals(response->mStatus, 404);
 	}
+
+	template<> template<>
+	void LLMessageSystemTestObject::test<2>()
+		// packet id window grows on collision, then spills
+	{
+		LLPacketIDWindow<U64> window(4, 8);
+		window[1] = 10;
+		window[2] = 20;
+		ensure_equals("window size", window.getWindowSize(), 4U);
+		window[5] = 50;		// collides with 1, grows
+		ensure_equals("grown window", window.getWindowSize(), 8U);
+		window[9] = 90;		// collides with 1 again, at max size
+		ensure_equals("max window", window.getWindowSize(), 8U);
+		ensure_equals("overflow", window.getOverflowCount(), 1);
+		window[LL_INVALID_PACKET_ID] = 7;
+		ensure_equals("count", window.size(), 5);
+
+		ensure_equals("find 1", *window.find(1), (U64)10);
+		ensure_equals("find 5", *window.find(5), (U64)50);
+		ensure_equals("find 9", *window.find(9), (U64)90);
+		ensure_equals("find invalid", *window.find(LL_INVALID_PACKET_ID), (U64)7);
+		ensure("missing", window.find(3) == NULL);
+
+		ensure("erase 1", window.erase(1));
+		ensure("erase 1 twice", !window.erase(1));
+		ensure("1 gone", window.find(1) == NULL);
+		ensure("9 kept", window.find(9) != NULL);
+
+		window.clear();
+		ensure("cleared", window.empty());
+		ensure("9 cleared", window.find(9) == NULL);
+	}
+
+	template<> template<>
+	void LLMessageSystemTestObject::test<3>()
+		// reliable packets stay in send order across acks and wraps
+	{
+		// never dereferenced by the window
+		U8 packets[8];
+		LLReliablePacket* packetp[8];
+		for (S32 i = 0; i < 8; ++i)
+		{
+			packetp[i] = (LLReliablePacket*)&packets[i];
+		}
+
+		LLReliablePacketWindow window;
+		ensure_equals("empty", window.getOldestID(), LL_INVALID_PACKET_ID);
+
+		// ids wrap from the top of the packet id range
+		window.add(0xFFFFFE, packetp[0], FALSE);
+		window.add(0xFFFFFF, packetp[1], TRUE);
+		window.add(0, packetp[2], FALSE);
+		window.add(1, packetp[3], FALSE);
+		ensure_equals("oldest", window.getOldestID(), (TPACKETID)0xFFFFFE);
+		ensure("final", window.isFinalRetry(0xFFFFFF));
+		ensure("not final", !window.isFinalRetry(0));
+
+		ensure("ack middle", window.remove(0) == packetp[2]);
+		ensure("ack twice", window.remove(0) == NULL);
+		ensure_equals("next after ack", window.getNextID(0xFFFFFF), (TPACKETID)1);
+
+		window.setFinalRetry(1);
+		ensure("now final", window.isFinalRetry(1));
+		ensure("find", window.find(1) == packetp[3]);
+
+		ensure("ack oldest", window.remove(0xFFFFFE) == packetp[0]);
+		ensure_equals("new oldest", window.getOldestID(), (TPACKETID)0xFFFFFF);
+		ensure("ack newest", window.remove(1) == packetp[3]);
+		window.add(2, packetp[4], FALSE);
+		ensure_equals("appended", window.getNextID(0xFFFFFF), (TPACKETID)2);
+		ensure_equals("size", window.size(), 2);
+	}
+
+	template<> template<>
+	void LLMessageSystemTestObject::test<4>()
+		// pending acks come off in order across a grow
+	{
+		LLPacketAckQueue acks;
+		TPACKETID next_in = 0;
+		TPACKETID next_out = 0;
+		for (S32 round = 0; round < 10; ++round)
+		{
+			for (S32 i = 0; i < 50; ++i)
+			{
+				acks.push(next_in++);
+			}
+			for (S32 i = 0; i < 30; ++i)
+			{
+				ensure_equals("ack order", acks[i], next_out + i);
+			}
+			acks.pop(30);
+			next_out += 30;
+		}
+		ensure_equals("queued", acks.size(), (S32)(next_in - next_out));
+		ensure_equals("front", acks[0], next_out);
+		acks.pop(1000);
+		ensure("drained", acks.empty());
+	}
 }
 